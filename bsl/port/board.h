@@ -4,6 +4,7 @@
 #include <drv.h>
 #include <lvgl.h>
 #include <lvgl/lv_port_disp.h>
+#include <lvgl/lv_port_mem.h>
 #include <ui.h>
 
 void print(lv_log_level_t level, const char *buf);
@@ -63,12 +63,20 @@ void lv_port_disp_init(void)
     lv_disp_set_rotation(disp, LV_DISPLAY_ROTATION_90);
     lv_display_set_flush_cb(disp, disp_flush);
 
+    /* Place layers and image cache on the memory tiers (custom allocator only) */
+    lv_port_mem_init_draw_buf();
+
     /* Example 1
      * One buffer for partial rendering*/
     LV_ATTRIBUTE_MEM_ALIGN
     static uint8_t buf_1_1[MY_DISP_HOR_RES * 128 * BYTE_PER_PIXEL];
     lv_display_set_buffers(disp, buf_1_1, NULL, sizeof(buf_1_1), LV_DISPLAY_RENDER_MODE_PARTIAL);
 
+    /* Merge nearby invalidated areas: a band costs about as much as 4 extra rows
+     * (measured by svl/bench/lv_inv_merge_bench.c), and a full area buffer
+     * no longer redraws the whole screen */
+    lv_display_set_area_merge_cost(disp, lv_display_get_horizontal_resolution(disp) * 4);
+
     // /* Example 2
     //  * Two buffers for partial rendering
     //  * In flush_cb DMA or similar hardware should be used to update the display in the background.*/
@@ -122,7 +130,10 @@ void disp_disable_update(void)
  *'lv_display_flush_ready()' has to be called when it's finished.*/
 static void disp_flush(lv_display_t *disp_drv, const lv_area_t *area, uint8_t *px_map)
 {
-    SCB_InvalidateDCache_by_Addr(px_map, (area->x2 - area->x1 + 1) * (area->y2 - area->y1 + 1) * 2);
+    /* The CPU copies px_map itself and reads it through the D-cache, so no
+     * maintenance is needed. Invalidating here dropped rendered pixels that
+     * were not written back yet. A DMA2D source has to be cleaned instead
+     * (SCB_CleanDCache_by_Addr), see rt_dma_buf_to_device(). */
     if (disp_flush_enabled)
     {
         lcd_fill_lvgl_rotated_sync(disp_drv, lv_display_get_rotation(disp_drv), area->x1, area->y1,
@@ -0,0 +1,168 @@
+/**
+ * @file lv_port_mem.c
+ *
+ * Memory port of LVGL on top of the tiered heap of the kernel.
+ * Select it with `LV_USE_STDLIB_MALLOC LV_STDLIB_CUSTOM` in lv_conf.h.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_port_mem.h"
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+#include "lvgl_private.h"
+#else
+#include "lvgl/lvgl_private.h"
+#endif
+#include <rtthread.h>
+
+#ifndef RT_USING_MEMTIER
+#error "lv_port_mem: RT_USING_MEMTIER is required. Define it in rtconfig.h"
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void * draw_buf_malloc_dma(size_t size, lv_color_format_t color_format);
+static void * draw_buf_malloc_bulk(size_t size, lv_color_format_t color_format);
+static void draw_buf_free(void * buf);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/* DTCM: small, hot objects. Not reachable by DMA2D/LTDC. */
+rt_align(RT_ALIGN_SIZE) static uint8_t mem_fast[LV_PORT_MEM_FAST_SIZE];
+
+/* AXI SRAM: layers and other buffers touched by DMA2D */
+rt_align(RT_ALIGN_SIZE) static __attribute__((section(".ram.heap"))) uint8_t mem_dma[LV_PORT_MEM_DMA_SIZE];
+
+/* SDRAM: image cache and other large, rarely touched blocks */
+rt_align(RT_ALIGN_SIZE) static __attribute__((section(".sdram.heap"))) uint8_t mem_bulk[LV_PORT_MEM_BULK_SIZE];
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_mem_init(void)
+{
+    /*The board may have attached its own tiers already*/
+    rt_memtier_attach(RT_MEMTIER_FAST, "lv_fast", mem_fast, sizeof(mem_fast));
+    rt_memtier_attach(RT_MEMTIER_DMA, "lv_dma", mem_dma, sizeof(mem_dma));
+    rt_memtier_attach(RT_MEMTIER_BULK, "lv_bulk", mem_bulk, sizeof(mem_bulk));
+}
+
+void lv_mem_deinit(void)
+{
+    return; /*The tiers outlive LVGL*/
+}
+
+lv_mem_pool_t lv_mem_add_pool(void * mem, size_t bytes)
+{
+    /*Not supported*/
+    LV_UNUSED(mem);
+    LV_UNUSED(bytes);
+    return NULL;
+}
+
+void lv_mem_remove_pool(lv_mem_pool_t pool)
+{
+    /*Not supported*/
+    LV_UNUSED(pool);
+    return;
+}
+
+void * lv_malloc_core(size_t size)
+{
+    return rt_memtier_alloc(size, RT_MEMTIER_AUTO);
+}
+
+void * lv_realloc_core(void * p, size_t new_size)
+{
+    return rt_memtier_realloc(p, new_size);
+}
+
+void lv_free_core(void * p)
+{
+    rt_memtier_free(p);
+}
+
+void lv_mem_monitor_core(lv_mem_monitor_t * mon_p)
+{
+    struct rt_memtier_info info;
+    uint8_t tier_class;
+
+    for(tier_class = 0; tier_class < RT_MEMTIER_CLASS_MAX; tier_class++) {
+        if(rt_memtier_get_info(tier_class, &info) != RT_EOK) continue;
+
+        mon_p->total_size += info.total;
+        mon_p->free_size += info.total - info.used;
+        mon_p->max_used += info.max_used;
+        mon_p->used_cnt += info.live_count;
+    }
+
+    if(mon_p->total_size > 0) {
+        mon_p->used_pct = 100 - (uint64_t)100U * mon_p->free_size / mon_p->total_size;
+    }
+}
+
+lv_result_t lv_mem_test_core(void)
+{
+    /*Not supported*/
+    return LV_RESULT_OK;
+}
+
+void lv_port_mem_init_draw_buf(void)
+{
+    /*Layers are blended by DMA2D, keep them in bus master reachable memory*/
+    lv_draw_buf_handlers_t * handlers = lv_draw_buf_get_handlers();
+    handlers->buf_malloc_cb = draw_buf_malloc_dma;
+    handlers->buf_free_cb = draw_buf_free;
+
+    handlers = lv_draw_buf_get_font_handlers();
+    handlers->buf_malloc_cb = draw_buf_malloc_dma;
+    handlers->buf_free_cb = draw_buf_free;
+
+    /*Decoded images can be large and are only read back, SDRAM is enough*/
+    handlers = lv_draw_buf_get_image_handlers();
+    handlers->buf_malloc_cb = draw_buf_malloc_bulk;
+    handlers->buf_free_cb = draw_buf_free;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void * draw_buf_malloc_dma(size_t size, lv_color_format_t color_format)
+{
+    LV_UNUSED(color_format);
+
+    /*Allocate larger memory to be sure it can be aligned as needed*/
+    return rt_memtier_alloc(size + LV_DRAW_BUF_ALIGN - 1, RT_MEMTIER_DMA);
+}
+
+static void * draw_buf_malloc_bulk(size_t size, lv_color_format_t color_format)
+{
+    LV_UNUSED(color_format);
+
+    return rt_memtier_alloc(size + LV_DRAW_BUF_ALIGN - 1, RT_MEMTIER_BULK);
+}
+
+static void draw_buf_free(void * buf)
+{
+    rt_memtier_free(buf);
+}
+
+#else /*LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM*/
+
+void lv_port_mem_init_draw_buf(void)
+{
+    return; /*The builtin allocator has a single pool*/
+}
+
+#endif /*LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM*/
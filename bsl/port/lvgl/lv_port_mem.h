@@ -0,0 +1,42 @@
+/**
+ * @file lv_port_mem.h
+ *
+ */
+
+#ifndef LV_PORT_MEM_H
+#define LV_PORT_MEM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+#include "lvgl.h"
+#else
+#include "lvgl/lvgl.h"
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+/* Size of the memory tiers used when LV_USE_STDLIB_MALLOC is LV_STDLIB_CUSTOM */
+#define LV_PORT_MEM_FAST_SIZE (32 * 1024)
+#define LV_PORT_MEM_DMA_SIZE  (256 * 1024)
+#define LV_PORT_MEM_BULK_SIZE (4 * 1024 * 1024)
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+/* Route the draw buffers of LVGL to the matching memory tier.
+ * Call it after lv_init(), it has no effect with the builtin allocator.
+ */
+void lv_port_mem_init_draw_buf(void);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_PORT_MEM_H*/
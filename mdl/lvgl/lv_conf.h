@@ -69,7 +69,9 @@
 
 #if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
     /** Size of memory available for `lv_malloc()` in bytes (>= 2kB) */
-    #define LV_MEM_SIZE (64 * 1024U) /**< [bytes] */
+    #ifndef LV_MEM_SIZE
+        #define LV_MEM_SIZE (64 * 1024U) /**< [bytes] */
+    #endif
 
     /** Size of the memory expand for `lv_malloc()` in bytes */
     #define LV_MEM_POOL_EXPAND_SIZE 0
@@ -106,8 +108,15 @@
  * - LV_OS_WINDOWS
  * - LV_OS_MQX
  * - LV_OS_SDL2
- * - LV_OS_CUSTOM */
-#define LV_USE_OS LV_OS_NONE
+ * - LV_OS_CUSTOM
+ * RT-Thread builds use its OSAL, the host benchmark passes LV_OS_PTHREAD. */
+#ifndef LV_USE_OS
+    #ifdef __RTTHREAD__
+        #define LV_USE_OS LV_OS_RTTHREAD
+    #else
+        #define LV_USE_OS LV_OS_NONE
+    #endif
+#endif
 
 #if LV_USE_OS == LV_OS_CUSTOM
     #define LV_OS_CUSTOM_INCLUDE <stdint.h>
@@ -151,10 +160,22 @@
  * Set it to 0 to have no limit. */
 #define LV_DRAW_LAYER_MAX_MEMORY 0 /**< No limit by default [bytes]*/
 
+/** Cut the draw tasks and their descriptors from chunks of this many bytes instead of
+ *  allocating each from the heap. A chunk is reused once all of its tasks are done,
+ *  the emptied chunks but one are freed after each refresh.
+ *  0: allocate every task from the heap */
+#ifndef LV_DRAW_TASK_POOL_CHUNK_SIZE
+    #define LV_DRAW_TASK_POOL_CHUNK_SIZE 0 /**< [bytes]*/
+#endif
+
 /** Stack size of drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
-#define LV_DRAW_THREAD_STACK_SIZE (0 * 1024) /**< [bytes]*/
+#if LV_USE_OS
+    #define LV_DRAW_THREAD_STACK_SIZE (8 * 1024) /**< [bytes]*/
+#else
+    #define LV_DRAW_THREAD_STACK_SIZE (0 * 1024) /**< [bytes]*/
+#endif
 
 /** Thread priority of the drawing task.
  *  Higher values mean higher priority.
@@ -178,7 +199,9 @@
     #define LV_DRAW_SW_SUPPORT_RGB565A8 0
     #define LV_DRAW_SW_SUPPORT_RGB888 1
     #define LV_DRAW_SW_SUPPORT_XRGB8888 0
-    #define LV_DRAW_SW_SUPPORT_ARGB8888 0
+    #ifndef LV_DRAW_SW_SUPPORT_ARGB8888
+        #define LV_DRAW_SW_SUPPORT_ARGB8888 0
+    #endif
     #define LV_DRAW_SW_SUPPORT_ARGB8888_PREMULTIPLIED 0
     #define LV_DRAW_SW_SUPPORT_L8 0
     #define LV_DRAW_SW_SUPPORT_AL88 0
@@ -192,7 +215,9 @@
     /** Set number of draw units.
      *  - > 1 requires operating system to be enabled in `LV_USE_OS`.
      *  - > 1 means multiple threads will render the screen in parallel. */
-    #define LV_DRAW_SW_DRAW_UNIT_CNT 1
+    #ifndef LV_DRAW_SW_DRAW_UNIT_CNT
+        #define LV_DRAW_SW_DRAW_UNIT_CNT 1
+    #endif
 
     /** Use Arm-2D to accelerate software (sw) rendering. */
     #define LV_USE_DRAW_ARM2D_SYNC 0
@@ -218,7 +243,15 @@
         #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
     #endif
 
-    #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_NONE
+    /** Accelerate the software blend functions:
+     *  - LV_DRAW_SW_ASM_NONE:   plain C
+     *  - LV_DRAW_SW_ASM_NEON:   NEON assembly of Cortex-A
+     *  - LV_DRAW_SW_ASM_HELIUM: Helium assembly of Cortex-M55/M85
+     *  - LV_DRAW_SW_ASM_SIMD:   RGB565 blending with opacity or masks with SSE2/AVX2 on x86 or the DSP extension of Cortex-M4/M7
+     *  - LV_DRAW_SW_ASM_CUSTOM: include LV_DRAW_SW_ASM_CUSTOM_INCLUDE */
+    #ifndef LV_USE_DRAW_SW_ASM
+        #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_NONE
+    #endif
 
     #if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
         #define  LV_DRAW_SW_ASM_CUSTOM_INCLUDE ""
@@ -474,6 +507,28 @@
 /** Add 2 x 32-bit variables to each `lv_obj_t` to speed up getting style properties */
 #define LV_OBJ_STYLE_CACHE 0
 
+/** Cache the resolved style properties of each object part in its current state.
+ *  A cached part takes about 4 bytes for each built-in property (~600 bytes).
+ *  Maximum bytes used by all objects, the other objects look up their styles as usual. 0: disable */
+#ifndef LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+    #define LV_OBJ_STYLE_RESOLVED_CACHE_SIZE 0
+#endif
+
+/** Keep the rendered image of the objects having `LV_OBJ_FLAG_CACHE_BITMAP` and draw that until they or their children change.
+ *  Objects not covering their area (e.g. rounded corners) need `LV_DRAW_SW_SUPPORT_ARGB8888`, else they are drawn as usual.
+ *  Maximum bytes used by the cached images, the images count in the heap of LVGL. 0: disable */
+#ifndef LV_OBJ_BITMAP_CACHE_SIZE
+    #define LV_OBJ_BITMAP_CACHE_SIZE 0
+#endif
+
+/** Keep the draw tasks created by `LV_EVENT_DRAW_MAIN` of each object and add copies of them
+ *  instead of sending the event again until the object is invalidated. Objects sending
+ *  `LV_EVENT_DRAW_TASK_ADDED` or drawing layers or masks are drawn as usual.
+ *  Maximum bytes used by the kept draw tasks of all objects, the other objects are drawn as usual. 0: disable */
+#ifndef LV_OBJ_RETAINED_DRAW_SIZE
+    #define LV_OBJ_RETAINED_DRAW_SIZE 0
+#endif
+
 /** Add `id` field to `lv_obj_t` */
 #define LV_USE_OBJ_ID 0
 
@@ -611,7 +666,9 @@
 #define LV_FONT_SIMSUN_14_CJK 0 /**< 1000 most common CJK radicals */
 #define LV_FONT_SIMSUN_16_CJK 0 /**< 1000 most common CJK radicals */
 #define LV_FONT_SOURCE_HAN_SANS_SC_14_CJK 0 /**< 1338 most common CJK radicals */
-#define LV_FONT_SOURCE_HAN_SANS_SC_16_CJK 0 /**< 1338 most common CJK radicals */
+#ifndef LV_FONT_SOURCE_HAN_SANS_SC_16_CJK
+    #define LV_FONT_SOURCE_HAN_SANS_SC_16_CJK 0 /**< 1338 most common CJK radicals */
+#endif
 
 /** Pixel perfect monospaced fonts */
 #define LV_FONT_UNSCII_8 0
@@ -637,6 +694,17 @@
 /** Enables/disables support for compressed fonts. */
 #define LV_USE_FONT_COMPRESSED 0
 
+/** Cache the glyph IDs of the last looked up letters in fonts having a `cache` (e.g. the built-in CJK fonts).
+ *  Number of entries per font, a power of 2, at least 32. */
+#define LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE 256
+
+/** Keep decoded glyph bitmaps of built-in and binary fonts in a shared cache of this many bytes.
+ *  Saves decoding the same glyphs again in every frame, useful for large and compressed fonts.
+ *  0: disable the cache. */
+#ifndef LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE
+    #define LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE 0
+#endif
+
 /** Enable drawing placeholders when glyph dsc is not found. */
 #define LV_USE_FONT_PLACEHOLDER 1
 
@@ -151,6 +151,12 @@
  * Set it to 0 to have no limit. */
 #define LV_DRAW_LAYER_MAX_MEMORY 0  /**< No limit by default [bytes]*/
 
+/** Cut the draw tasks and their descriptors from chunks of this many bytes instead of
+ *  allocating each from the heap. A chunk is reused once all of its tasks are done,
+ *  the emptied chunks but one are freed after each refresh.
+ *  0: allocate every task from the heap */
+#define LV_DRAW_TASK_POOL_CHUNK_SIZE 0 /**< [bytes]*/
+
 /** Stack size of drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -218,6 +224,12 @@
         #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
     #endif
 
+    /** Accelerate the software blend functions:
+     *  - LV_DRAW_SW_ASM_NONE:   plain C
+     *  - LV_DRAW_SW_ASM_NEON:   NEON assembly of Cortex-A
+     *  - LV_DRAW_SW_ASM_HELIUM: Helium assembly of Cortex-M55/M85
+     *  - LV_DRAW_SW_ASM_SIMD:   RGB565 blending with opacity or masks with SSE2/AVX2 on x86 or the DSP extension of Cortex-M4/M7
+     *  - LV_DRAW_SW_ASM_CUSTOM: include LV_DRAW_SW_ASM_CUSTOM_INCLUDE */
     #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_NONE
 
     #if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
@@ -474,6 +486,22 @@
 /** Add 2 x 32-bit variables to each `lv_obj_t` to speed up getting style properties */
 #define LV_OBJ_STYLE_CACHE      0
 
+/** Cache the resolved style properties of each object part in its current state.
+ *  A cached part takes about 4 bytes for each built-in property (~600 bytes).
+ *  Maximum bytes used by all objects, the other objects look up their styles as usual. 0: disable */
+#define LV_OBJ_STYLE_RESOLVED_CACHE_SIZE 0
+
+/** Keep the rendered image of the objects having `LV_OBJ_FLAG_CACHE_BITMAP` and draw that until they or their children change.
+ *  Objects not covering their area (e.g. rounded corners) need `LV_DRAW_SW_SUPPORT_ARGB8888`, else they are drawn as usual.
+ *  Maximum bytes used by the cached images, the images count in the heap of LVGL. 0: disable */
+#define LV_OBJ_BITMAP_CACHE_SIZE 0
+
+/** Keep the draw tasks created by `LV_EVENT_DRAW_MAIN` of each object and add copies of them
+ *  instead of sending the event again until the object is invalidated. Objects sending
+ *  `LV_EVENT_DRAW_TASK_ADDED` or drawing layers or masks are drawn as usual.
+ *  Maximum bytes used by the kept draw tasks of all objects, the other objects are drawn as usual. 0: disable */
+#define LV_OBJ_RETAINED_DRAW_SIZE 0
+
 /** Add `id` field to `lv_obj_t` */
 #define LV_USE_OBJ_ID           0
 
@@ -639,6 +667,15 @@
 /** Enables/disables support for compressed fonts. */
 #define LV_USE_FONT_COMPRESSED 0
 
+/** Cache the glyph IDs of the last looked up letters in fonts having a `cache` (e.g. the built-in CJK fonts).
+ *  Number of entries per font, a power of 2, at least 32. */
+#define LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE 256
+
+/** Keep decoded glyph bitmaps of built-in and binary fonts in a shared cache of this many bytes.
+ *  Saves decoding the same glyphs again in every frame, useful for large and compressed fonts.
+ *  0: disable the cache. */
+#define LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE 0
+
 /** Enable drawing placeholders when glyph dsc is not found. */
 #define LV_USE_FONT_PLACEHOLDER 1
 
@@ -57,6 +57,8 @@ extern "C" {
 #include "src/core/lv_obj_class_private.h"
 #include "src/core/lv_group_private.h"
 #include "src/core/lv_obj_event_private.h"
+#include "src/core/lv_obj_bitmap_cache_private.h"
+#include "src/core/lv_obj_retained_draw_private.h"
 #include "src/misc/lv_timer_private.h"
 #include "src/misc/lv_area_private.h"
 #include "src/misc/lv_fs_private.h"
@@ -22,6 +22,7 @@ extern "C" {
 #endif
 #include "../misc/lv_anim.h"
 #include "../misc/lv_area.h"
+#include "../misc/lv_array.h"
 #include "../misc/lv_color_op.h"
 #include "../misc/lv_ll.h"
 #include "../misc/lv_log.h"
@@ -31,9 +32,10 @@ extern "C" {
 #include "../others/sysmon/lv_sysmon.h"
 #include "../stdlib/builtin/lv_tlsf.h"
 
-#if LV_USE_FONT_COMPRESSED
 #include "../font/lv_font_fmt_txt_private.h"
-#endif
+#include "lv_obj_bitmap_cache_private.h"
+#include "lv_obj_retained_draw_private.h"
+#include "lv_refr_private.h"
 
 #if LV_USE_OS != LV_OS_NONE && defined(__linux__)
 #include "../osal/lv_linux_private.h"
@@ -87,6 +89,9 @@ typedef struct _lv_global_t {
 
     lv_ll_t disp_ll;
     lv_display_t * disp_refresh;
+    lv_layer_t * refr_occlusion_layer;      /**< The layer whose objects in `refr_occluded` are skipped*/
+    lv_array_t refr_occluded;               /**< Objects marked as covered in the area being drawn*/
+    lv_refr_occlusion_stats_t refr_occlusion_stats;
     lv_display_t * disp_default;
 
     lv_ll_t style_trans_ll;
@@ -94,6 +99,10 @@ typedef struct _lv_global_t {
     uint32_t style_custom_table_size;
     uint32_t style_last_custom_prop_id;
     uint8_t * style_custom_prop_flag_lookup_table;
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE > 0
+    uint32_t style_resolved_cache_size;
+    uint32_t style_resolved_gen;
+#endif
 
     lv_ll_t group_ll;
     lv_group_t * group_default;
@@ -126,6 +135,23 @@ typedef struct _lv_global_t {
     lv_cache_t * img_cache;
     lv_cache_t * img_header_cache;
 
+    lv_cache_t * font_fmt_txt_cache;
+    lv_font_fmt_txt_cache_stats_t font_fmt_txt_cache_stats;
+
+    lv_cache_t * obj_bitmap_cache;
+    lv_obj_bitmap_cache_stats_t obj_bitmap_cache_stats;
+    lv_array_t obj_bitmap_cache_drawn;
+    uint32_t obj_bitmap_cache_drawn_size;
+    const lv_obj_t * obj_bitmap_cache_building;
+    bool obj_bitmap_cache_build_invalidated;
+
+    lv_obj_retained_draw_stats_t obj_retained_draw_stats;
+#if LV_OBJ_RETAINED_DRAW_SIZE > 0
+    uint32_t obj_retained_draw_size;
+    uint8_t * obj_retained_draw_buf;
+    uint32_t obj_retained_draw_buf_size;
+#endif
+
     lv_draw_global_info_t draw_info;
     lv_ll_t draw_sw_blend_handler_ll;
 #if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
@@ -26,6 +26,8 @@
 #include "../tick/lv_tick.h"
 #include "../stdlib/lv_string.h"
 #include "lv_obj_draw_private.h"
+#include "lv_obj_bitmap_cache_private.h"
+#include "lv_obj_retained_draw_private.h"
 
 /*********************
  *      DEFINES
@@ -283,6 +285,9 @@ void lv_obj_remove_flag(lv_obj_t * obj, lv_obj_flag_t f)
 
     obj->flags &= (~f);
 
+    /*Don't keep a bitmap that won't be updated anymore*/
+    if(f & LV_OBJ_FLAG_CACHE_BITMAP) lv_obj_bitmap_cache_drop(obj);
+
     if(f & LV_OBJ_FLAG_HIDDEN) {
         lv_obj_invalidate(obj);
         lv_obj_mark_layout_as_dirty(lv_obj_get_parent(obj));
@@ -520,6 +525,10 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_obj_enable_style_refresh(false); /*No need to refresh the style because the object will be deleted*/
     lv_obj_remove_style_all(obj);
     lv_obj_enable_style_refresh(true);
+    lv_obj_style_free_resolved(obj);
+    lv_obj_retained_draw_free(obj);
+
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_CACHE_BITMAP)) lv_obj_bitmap_cache_drop(obj);
 
     /*Remove the animations from this object*/
     lv_anim_delete(obj, NULL);
@@ -916,6 +925,7 @@ static void update_obj_state(lv_obj_t * obj, lv_state_t new_state)
     /*If there is no difference in styles there is nothing else to do*/
     if(cmp_res == LV_STYLE_STATE_CMP_SAME) {
         obj->state = new_state;
+        lv_obj_style_invalidate_resolved();
         return;
     }
 
@@ -923,6 +933,7 @@ static void update_obj_state(lv_obj_t * obj, lv_state_t new_state)
     lv_obj_invalidate(obj);
 
     obj->state = new_state;
+    lv_obj_style_invalidate_resolved();
     lv_obj_update_layer_type(obj);
     lv_obj_style_transition_dsc_t * ts = lv_malloc_zeroed(sizeof(lv_obj_style_transition_dsc_t) * STYLE_TRANSITION_MAX);
     uint32_t tsi = 0;
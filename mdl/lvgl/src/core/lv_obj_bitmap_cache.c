@@ -0,0 +1,374 @@
+/**
+ * @file lv_obj_bitmap_cache.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_obj_bitmap_cache_private.h"
+#include "lv_obj_private.h"
+#include "lv_obj_event_private.h"
+#include "lv_obj_draw_private.h"
+#include "lv_refr_private.h"
+#include "lv_global.h"
+#include "../display/lv_display_private.h"
+#include "../draw/lv_draw_private.h"
+#include "../draw/lv_draw_buf_private.h"
+#include "../draw/lv_draw_image.h"
+#include "../misc/lv_area_private.h"
+#include "../misc/lv_assert.h"
+#include "../misc/lv_profiler.h"
+#include "../misc/cache/lv_cache.h"
+#include "../misc/cache/instance/lv_image_cache.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define bitmap_cache_p (LV_GLOBAL_DEFAULT()->obj_bitmap_cache)
+#define bitmap_cache_stats (LV_GLOBAL_DEFAULT()->obj_bitmap_cache_stats)
+#define drawn_entries (LV_GLOBAL_DEFAULT()->obj_bitmap_cache_drawn)
+#define drawn_size (LV_GLOBAL_DEFAULT()->obj_bitmap_cache_drawn_size)
+#define building_obj (LV_GLOBAL_DEFAULT()->obj_bitmap_cache_building)
+#define building_invalidated (LV_GLOBAL_DEFAULT()->obj_bitmap_cache_build_invalidated)
+
+#define CACHE_NAME  "OBJ_BITMAP"
+
+/*Objects not covering their area need an ARGB8888 bitmap, the software renderer must be able to blend it*/
+#if LV_USE_DRAW_SW && !LV_DRAW_SW_SUPPORT_ARGB8888
+    #define ALPHA_BITMAP_SUPPORTED 0
+#else
+    #define ALPHA_BITMAP_SUPPORTED 1
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    lv_cache_slot_size_t slot;
+    const lv_obj_t * obj;
+    lv_area_t area;         /**< Coordinates of the bitmap, the widget with its ext. draw size*/
+    lv_opa_t opa;           /**< Opacity of the layer the bitmap was rendered with*/
+    lv_color32_t recolor;   /**< Recolor of the layer the bitmap was rendered with*/
+    lv_draw_buf_t * draw_buf;
+} bitmap_cache_data_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_result_t render_bitmap(lv_layer_t * parent_layer, lv_obj_t * obj, lv_draw_buf_t * draw_buf,
+                                 const lv_area_t * area);
+static bool need_alpha(lv_layer_t * layer, lv_obj_t * obj, const lv_area_t * area);
+static lv_result_t keep_drawn(lv_cache_entry_t * entry);
+static bool bitmap_cache_create_cb(bitmap_cache_data_t * node, void * user_data);
+static void bitmap_cache_free_cb(bitmap_cache_data_t * node, void * user_data);
+static lv_cache_compare_res_t bitmap_cache_compare_cb(const bitmap_cache_data_t * lhs, const bitmap_cache_data_t * rhs);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_result_t lv_obj_bitmap_cache_init(uint32_t size)
+{
+    if(bitmap_cache_p != NULL) {
+        return LV_RESULT_OK;
+    }
+
+    bitmap_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+    sizeof(bitmap_cache_data_t), size, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) bitmap_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t) bitmap_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t) bitmap_cache_free_cb,
+    });
+
+    lv_cache_set_name(bitmap_cache_p, CACHE_NAME);
+    lv_array_init(&drawn_entries, 8, sizeof(lv_cache_entry_t *));
+    return bitmap_cache_p != NULL ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
+void lv_obj_bitmap_cache_deinit(void)
+{
+    if(bitmap_cache_p == NULL) return;
+
+    lv_obj_bitmap_cache_release_drawn();
+    lv_array_deinit(&drawn_entries);
+    lv_cache_destroy(bitmap_cache_p, NULL);
+    bitmap_cache_p = NULL;
+}
+
+void lv_obj_bitmap_cache_resize(uint32_t new_size, bool evict_now)
+{
+    if(bitmap_cache_p == NULL) return;
+
+    lv_cache_set_max_size(bitmap_cache_p, new_size, NULL);
+    if(evict_now) {
+        lv_cache_reserve(bitmap_cache_p, new_size, NULL);
+    }
+}
+
+void lv_obj_bitmap_cache_drop(const lv_obj_t * obj)
+{
+    if(bitmap_cache_p == NULL) return;
+
+    if(obj == NULL) {
+        lv_cache_drop_all(bitmap_cache_p, NULL);
+        return;
+    }
+
+    bitmap_cache_data_t search_key = {
+        .obj = obj,
+    };
+    lv_cache_drop(bitmap_cache_p, &search_key, NULL);
+}
+
+void lv_obj_bitmap_cache_get_stats(lv_obj_bitmap_cache_stats_t * stats)
+{
+    LV_ASSERT_NULL(stats);
+
+    *stats = bitmap_cache_stats;
+    stats->size = bitmap_cache_p ? (uint32_t)lv_cache_get_size(bitmap_cache_p, NULL) : 0;
+    stats->max_size = bitmap_cache_p ? (uint32_t)lv_cache_get_max_size(bitmap_cache_p, NULL) : 0;
+}
+
+void lv_obj_bitmap_cache_reset_stats(void)
+{
+    bitmap_cache_stats.hit_cnt = 0;
+    bitmap_cache_stats.miss_cnt = 0;
+}
+
+lv_result_t lv_obj_bitmap_cache_draw(lv_layer_t * layer, lv_obj_t * obj)
+{
+    if(bitmap_cache_p == NULL || !lv_cache_is_enabled(bitmap_cache_p)) return LV_RESULT_INVALID;
+
+    /*A cached widget inside a widget being cached is simply part of the outer bitmap*/
+    if(building_obj) return LV_RESULT_INVALID;
+
+    /*The children might be drawn out of the bitmap, and layers have their own buffer anyway*/
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) return LV_RESULT_INVALID;
+    if(lv_obj_get_layer_type(obj) != LV_LAYER_TYPE_NONE) return LV_RESULT_INVALID;
+    /*The bitmap is blitted normally, other blend modes need the real background*/
+    if(lv_obj_get_style_blend_mode(obj, LV_PART_MAIN) != LV_BLEND_MODE_NORMAL) return LV_RESULT_INVALID;
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+    if(!lv_matrix_is_identity(&layer->matrix)) return LV_RESULT_INVALID;
+#endif
+
+    lv_area_t area;
+    int32_t ext_draw_size = lv_obj_get_ext_draw_size(obj);
+    lv_obj_get_coords(obj, &area);
+    lv_area_increase(&area, ext_draw_size, ext_draw_size);
+
+    /*Nothing to draw, don't render it for nothing either*/
+    lv_area_t clip_area;
+    if(!lv_area_intersect(&clip_area, &layer->_clip_area, &area)) return LV_RESULT_OK;
+
+    bitmap_cache_data_t search_key = {
+        .obj = obj,
+    };
+
+    lv_cache_entry_t * entry = lv_cache_acquire(bitmap_cache_p, &search_key, NULL);
+    if(entry) {
+        /*Moved, resized or drawn with a different opacity: the bitmap is outdated*/
+        bitmap_cache_data_t * cached_data = lv_cache_entry_get_data(entry);
+        if(!lv_area_is_equal(&cached_data->area, &area) || cached_data->opa != layer->opa ||
+           !lv_color32_eq(cached_data->recolor, layer->recolor)) {
+            lv_cache_release(bitmap_cache_p, entry, NULL);
+            lv_cache_drop(bitmap_cache_p, &search_key, NULL);
+            entry = NULL;
+        }
+    }
+
+    if(entry) {
+        bitmap_cache_stats.hit_cnt++;
+    }
+    else {
+        bool alpha = need_alpha(layer, obj, &area);
+        if(alpha && !ALPHA_BITMAP_SUPPORTED) return LV_RESULT_INVALID;
+
+        lv_color_format_t cf = alpha ? LV_COLOR_FORMAT_ARGB8888 : LV_COLOR_FORMAT_NATIVE;
+        search_key.area = area;
+        search_key.opa = layer->opa;
+        search_key.recolor = layer->recolor;
+        search_key.slot.size = lv_draw_buf_width_to_stride(lv_area_get_width(&area), cf) * lv_area_get_height(&area);
+
+        /*The bitmaps drawn in this refresh can't be evicted until it's ready*/
+        if(drawn_size + search_key.slot.size > lv_cache_get_max_size(bitmap_cache_p, NULL)) return LV_RESULT_INVALID;
+
+        /*Make room first so the new bitmap doesn't need more memory than the budget*/
+        while(lv_cache_get_free_size(bitmap_cache_p, NULL) < search_key.slot.size) {
+            if(!lv_cache_evict_one(bitmap_cache_p, NULL)) return LV_RESULT_INVALID;
+        }
+
+        lv_draw_buf_t * draw_buf = lv_draw_buf_create(lv_area_get_width(&area), lv_area_get_height(&area), cf,
+                                                      LV_STRIDE_AUTO);
+        if(draw_buf == NULL) return LV_RESULT_INVALID;
+
+        bitmap_cache_stats.miss_cnt++;
+        if(render_bitmap(layer, obj, draw_buf, &area) != LV_RESULT_OK) {
+            lv_draw_buf_destroy(draw_buf);
+            return LV_RESULT_INVALID;
+        }
+        entry = lv_cache_acquire_or_create(bitmap_cache_p, &search_key, draw_buf);
+        if(entry == NULL || ((bitmap_cache_data_t *)lv_cache_entry_get_data(entry))->draw_buf != draw_buf) {
+            lv_draw_buf_destroy(draw_buf);
+            if(entry == NULL) return LV_RESULT_INVALID;
+        }
+    }
+
+    if(keep_drawn(entry) != LV_RESULT_OK) return LV_RESULT_INVALID;
+
+    bitmap_cache_data_t * cached_data = lv_cache_entry_get_data(entry);
+    lv_draw_image_dsc_t draw_dsc;
+    lv_draw_image_dsc_init(&draw_dsc);
+    draw_dsc.src = cached_data->draw_buf;
+    lv_draw_image(layer, &draw_dsc, &cached_data->area);
+
+    return LV_RESULT_OK;
+}
+
+void lv_obj_bitmap_cache_release_drawn(void)
+{
+    uint32_t i;
+    for(i = 0; i < lv_array_size(&drawn_entries); i++) {
+        lv_cache_entry_t ** entry = lv_array_at(&drawn_entries, i);
+        lv_cache_release(bitmap_cache_p, *entry, NULL);
+    }
+    lv_array_clear(&drawn_entries);
+    drawn_size = 0;
+}
+
+void lv_obj_bitmap_cache_invalidate(const lv_obj_t * obj)
+{
+    if(bitmap_cache_p == NULL) return;
+
+    while(obj) {
+        if(lv_obj_has_flag(obj, LV_OBJ_FLAG_CACHE_BITMAP)) {
+            if(obj == building_obj) building_invalidated = true;
+            else lv_obj_bitmap_cache_drop(obj);
+        }
+        obj = lv_obj_get_parent(obj);
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Render a widget with its children into a bitmap
+ * @param parent_layer  the layer the widget would be drawn to, its opacity and recolor are used
+ * @param obj           the widget to render
+ * @param draw_buf      the bitmap, its size is `area`
+ * @param area          coordinates of the bitmap
+ * @return              LV_RESULT_OK: rendered, LV_RESULT_INVALID: the widget changed while being rendered
+ */
+static lv_result_t render_bitmap(lv_layer_t * parent_layer, lv_obj_t * obj, lv_draw_buf_t * draw_buf,
+                                 const lv_area_t * area)
+{
+    LV_PROFILER_REFR_BEGIN;
+    lv_display_t * disp = lv_refr_get_disp_refreshing();
+
+    if(lv_color_format_has_alpha(draw_buf->header.cf)) lv_draw_buf_clear(draw_buf, NULL);
+
+    /*Like a tile of the display: a layer without parent, drawn to a given buffer*/
+    lv_layer_t layer;
+    lv_draw_layer_init(&layer, NULL, draw_buf->header.cf, area);
+    layer.draw_buf = draw_buf;
+    layer.opa = parent_layer->opa;
+    layer.recolor = parent_layer->recolor;
+
+    building_obj = obj;
+    building_invalidated = false;
+    lv_obj_redraw(&layer, obj);
+    building_obj = NULL;
+
+    while(layer.draw_task_head) {
+        lv_draw_dispatch_wait_for_request();
+        lv_draw_dispatch();
+    }
+
+    lv_layer_t * layer_i = disp->layer_head;
+    while(layer_i) {
+        if(layer_i->next == &layer) {
+            layer_i->next = layer.next;
+            break;
+        }
+        layer_i = layer_i->next;
+    }
+
+    if(disp->layer_deinit) disp->layer_deinit(disp, &layer);
+
+    lv_draw_buf_flush_cache(draw_buf, NULL);
+    LV_PROFILER_REFR_END;
+    return building_invalidated ? LV_RESULT_INVALID : LV_RESULT_OK;
+}
+
+/**
+ * Tell if the bitmap of a widget needs alpha channel, i.e. the widget doesn't cover all of it
+ */
+static bool need_alpha(lv_layer_t * layer, lv_obj_t * obj, const lv_area_t * area)
+{
+    if(layer->opa < LV_OPA_MAX) return true;
+
+    lv_cover_check_info_t info;
+    info.res = LV_COVER_RES_COVER;
+    info.area = area;
+    lv_obj_send_event(obj, LV_EVENT_COVER_CHECK, &info);
+    return info.res != LV_COVER_RES_COVER;
+}
+
+/**
+ * The draw task reads the bitmap later, keep it until the refresh is ready.
+ * Consumes the reference of `entry`, an entry is kept only once.
+ */
+static lv_result_t keep_drawn(lv_cache_entry_t * entry)
+{
+    uint32_t i;
+    for(i = 0; i < lv_array_size(&drawn_entries); i++) {
+        lv_cache_entry_t ** drawn = lv_array_at(&drawn_entries, i);
+        if(*drawn == entry) {
+            lv_cache_release(bitmap_cache_p, entry, NULL);
+            return LV_RESULT_OK;
+        }
+    }
+
+    if(lv_array_push_back(&drawn_entries, &entry) != LV_RESULT_OK) {
+        lv_cache_release(bitmap_cache_p, entry, NULL);
+        return LV_RESULT_INVALID;
+    }
+
+    bitmap_cache_data_t * cached_data = lv_cache_entry_get_data(entry);
+    drawn_size += cached_data->slot.size;
+    return LV_RESULT_OK;
+}
+
+static bool bitmap_cache_create_cb(bitmap_cache_data_t * node, void * user_data)
+{
+    /*Rendered before adding it, so the cache is not locked while drawing*/
+    node->draw_buf = user_data;
+    return true;
+}
+
+static void bitmap_cache_free_cb(bitmap_cache_data_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_image_cache_drop(node->draw_buf);
+    lv_draw_buf_destroy(node->draw_buf);
+}
+
+static lv_cache_compare_res_t bitmap_cache_compare_cb(const bitmap_cache_data_t * lhs, const bitmap_cache_data_t * rhs)
+{
+    if(lhs->obj != rhs->obj) {
+        return lhs->obj > rhs->obj ? 1 : -1;
+    }
+
+    return 0;
+}
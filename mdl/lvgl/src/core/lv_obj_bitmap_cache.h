@@ -0,0 +1,71 @@
+/**
+ * @file lv_obj_bitmap_cache.h
+ *
+ */
+
+#ifndef LV_OBJ_BITMAP_CACHE_H
+#define LV_OBJ_BITMAP_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../misc/lv_types.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** Statistics of the bitmap cache of the widgets having `LV_OBJ_FLAG_CACHE_BITMAP`*/
+typedef struct {
+    uint32_t hit_cnt;       /**< Number of times a cached bitmap was drawn instead of the widget*/
+    uint32_t miss_cnt;      /**< Number of times the widget had to be rendered into a new bitmap*/
+    uint32_t size;          /**< Bytes used by the cached bitmaps*/
+    uint32_t max_size;      /**< The byte budget of the cache*/
+} lv_obj_bitmap_cache_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Change the byte budget of the bitmap cache of the widgets.
+ * @param new_size  the new size in bytes, 0 disables the cache
+ * @param evict_now true: free the bitmaps above the new size right away
+ */
+void lv_obj_bitmap_cache_resize(uint32_t new_size, bool evict_now);
+
+/**
+ * Drop the cached bitmap of a widget. The widget is rendered again when it's drawn next time.
+ * Needed only if the widget changes without invalidating itself, e.g. a custom draw event reads external data.
+ * @param obj       pointer to a widget, NULL to drop all the bitmaps
+ */
+void lv_obj_bitmap_cache_drop(const lv_obj_t * obj);
+
+/**
+ * Get the hit/miss counters and the size of the bitmap cache of the widgets
+ * @param stats     store the statistics here
+ */
+void lv_obj_bitmap_cache_get_stats(lv_obj_bitmap_cache_stats_t * stats);
+
+/**
+ * Clear the hit/miss counters of the bitmap cache of the widgets
+ */
+void lv_obj_bitmap_cache_reset_stats(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_OBJ_BITMAP_CACHE_H*/
@@ -0,0 +1,72 @@
+/**
+ * @file lv_obj_bitmap_cache_private.h
+ *
+ */
+
+#ifndef LV_OBJ_BITMAP_CACHE_PRIVATE_H
+#define LV_OBJ_BITMAP_CACHE_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_obj_bitmap_cache.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create the bitmap cache of the widgets
+ * @param size      byte budget of the cache, 0: disabled until resized
+ * @return          LV_RESULT_OK: the cache is created
+ */
+lv_result_t lv_obj_bitmap_cache_init(uint32_t size);
+
+/**
+ * Delete the bitmap cache of the widgets
+ */
+void lv_obj_bitmap_cache_deinit(void);
+
+/**
+ * Draw a widget having `LV_OBJ_FLAG_CACHE_BITMAP` from its cached bitmap.
+ * The widget with its children is rendered into a new bitmap if it's not cached yet or its area,
+ * opacity or recolor has changed since.
+ * @param layer     the layer to draw to, `layer->opa` and `layer->recolor` are already applied for `obj`
+ * @param obj       the widget to draw
+ * @return          LV_RESULT_OK: drawn, LV_RESULT_INVALID: can't be cached, draw the widget normally
+ */
+lv_result_t lv_obj_bitmap_cache_draw(lv_layer_t * layer, lv_obj_t * obj);
+
+/**
+ * Release the bitmaps drawn since the last call. Call it when all the draw tasks of the refresh are ready.
+ */
+void lv_obj_bitmap_cache_release_drawn(void);
+
+/**
+ * Drop the cached bitmaps of a widget and its parents as the widget has changed
+ * @param obj       the invalidated widget
+ */
+void lv_obj_bitmap_cache_invalidate(const lv_obj_t * obj);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_OBJ_BITMAP_CACHE_PRIVATE_H*/
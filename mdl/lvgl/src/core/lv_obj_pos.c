@@ -12,6 +12,7 @@
 #include "lv_obj_draw_private.h"
 #include "lv_obj_style_private.h"
 #include "lv_obj_private.h"
+#include "lv_obj_bitmap_cache_private.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
 #include "lv_refr_private.h"
@@ -823,6 +824,10 @@ void lv_obj_invalidate_area(const lv_obj_t * obj, const lv_area_t * area)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    /*Even if it's not visible now, the cached bitmaps of the object and its parents are outdated*/
+    lv_obj_bitmap_cache_invalidate(obj);
+    lv_obj_retained_draw_free((lv_obj_t *)obj);
+
     lv_display_t * disp   = lv_obj_get_display(obj);
     if(!lv_display_is_invalidation_enabled(disp)) return;
 
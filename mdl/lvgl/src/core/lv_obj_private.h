@@ -60,6 +60,12 @@ struct _lv_obj_t {
 #if LV_OBJ_STYLE_CACHE
     uint32_t style_main_prop_is_set;
     uint32_t style_other_prop_is_set;
+#endif
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE > 0
+    lv_obj_style_resolved_t * style_resolved;   /**< Resolved style properties of the parts, see `LV_OBJ_STYLE_RESOLVED_CACHE_SIZE`*/
+#endif
+#if LV_OBJ_RETAINED_DRAW_SIZE > 0
+    lv_obj_retained_draw_t * retained_draw;     /**< Draw tasks of the last `LV_EVENT_DRAW_MAIN`, see `LV_OBJ_RETAINED_DRAW_SIZE`*/
 #endif
     void * user_data;
 #if LV_USE_OBJ_ID
@@ -76,6 +82,8 @@ struct _lv_obj_t {
     uint16_t h_layout   : 1;
     uint16_t w_layout   : 1;
     uint16_t is_deleting : 1;
+    uint16_t occluded : 1;      /**< Covered in the area being drawn, skip it with its children*/
+    uint16_t main_occluded : 1; /**< Its own drawing is covered in the area being drawn, skip `LV_EVENT_DRAW_MAIN`*/
 };
 
 
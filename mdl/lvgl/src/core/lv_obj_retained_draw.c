@@ -0,0 +1,358 @@
+/**
+ * @file lv_obj_retained_draw.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_obj_retained_draw_private.h"
+#include "lv_obj_private.h"
+#include "lv_global.h"
+#include "../draw/lv_draw_private.h"
+#include "../misc/lv_area_private.h"
+#include "../misc/lv_profiler.h"
+#include "../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#if LV_OBJ_RETAINED_DRAW_SIZE > 0
+#define retained_size (LV_GLOBAL_DEFAULT()->obj_retained_draw_size)
+#define record_buf (LV_GLOBAL_DEFAULT()->obj_retained_draw_buf)
+#define record_buf_size (LV_GLOBAL_DEFAULT()->obj_retained_draw_buf_size)
+#endif
+#define retained_stats (LV_GLOBAL_DEFAULT()->obj_retained_draw_stats)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+#if LV_OBJ_RETAINED_DRAW_SIZE > 0
+/** A kept draw task, followed by its descriptor and the text of local label descriptors*/
+typedef struct {
+    lv_area_t area;
+    lv_area_t real_area;
+    lv_area_t clip_area;    /**< The clip area of the task created for the whole object*/
+    uint32_t size;          /**< Bytes used by the task, its descriptor and its text*/
+    lv_draw_task_type_t type;
+} retained_task_t;
+
+/** State of a recording while the draw events are sent*/
+typedef struct {
+    lv_layer_t * layer;
+    lv_area_t clip_area;    /**< The clip area of the layer, the tasks are drawn only here*/
+    uint32_t size;          /**< Bytes used in `record_buf`*/
+    uint32_t task_cnt;
+    bool failed;            /**< A task can't be kept or they don't fit, the object has to be drawn with its events*/
+} recorder_t;
+#endif
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void send_draw_main_events(lv_layer_t * layer, lv_obj_t * obj);
+#if LV_OBJ_RETAINED_DRAW_SIZE > 0
+    static void record(lv_layer_t * layer, lv_obj_t * obj, const lv_area_t * coords_ext);
+    static void replay(lv_layer_t * layer, const lv_obj_retained_draw_t * retained);
+    static bool record_cb(lv_draw_task_t * t, void * user_data);
+    static uint32_t get_dsc_size(lv_draw_task_type_t type);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+#define ALIGN_SIZE(s)   LV_ALIGN_UP(s, 8)
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_obj_retained_draw_deinit(void)
+{
+#if LV_OBJ_RETAINED_DRAW_SIZE > 0
+    lv_free(record_buf);
+    record_buf = NULL;
+    record_buf_size = 0;
+#endif
+}
+
+void lv_obj_retained_draw_main(lv_layer_t * layer, lv_obj_t * obj, const lv_area_t * coords_ext)
+{
+#if LV_OBJ_RETAINED_DRAW_SIZE > 0
+    lv_draw_global_info_t * info = &LV_GLOBAL_DEFAULT()->draw_info;
+
+    /*Drawn while another object is recorded, the tasks can't be told apart*/
+    if(info->record_cb == record_cb) {
+        recorder_t * recorder = info->record_user_data;
+        recorder->failed = true;
+        send_draw_main_events(layer, obj);
+        return;
+    }
+
+    lv_obj_retained_draw_t * retained = obj->retained_draw;
+    if(retained) {
+        if(!lv_area_is_equal(&retained->coords, coords_ext) || retained->opa != layer->opa ||
+           !lv_color32_eq(retained->recolor, layer->recolor)) {
+            lv_obj_retained_draw_free(obj);
+            retained = NULL;
+        }
+    }
+
+    if(retained) {
+        if(retained->replayable) replay(layer, retained);
+        else send_draw_main_events(layer, obj);
+        return;
+    }
+
+    if(!lv_obj_has_flag(obj, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS) &&
+       retained_size + sizeof(lv_obj_retained_draw_t) <= LV_OBJ_RETAINED_DRAW_SIZE) {
+        record(layer, obj, coords_ext);
+        return;
+    }
+#else
+    LV_UNUSED(coords_ext);
+#endif
+
+    send_draw_main_events(layer, obj);
+}
+
+void lv_obj_retained_draw_free(lv_obj_t * obj)
+{
+#if LV_OBJ_RETAINED_DRAW_SIZE > 0
+    lv_obj_retained_draw_t * retained = obj->retained_draw;
+    if(retained == NULL) return;
+
+    retained_size -= retained->size;
+    lv_free(retained);
+    obj->retained_draw = NULL;
+#else
+    LV_UNUSED(obj);
+#endif
+}
+
+void lv_obj_retained_draw_get_stats(lv_obj_retained_draw_stats_t * stats)
+{
+    *stats = retained_stats;
+#if LV_OBJ_RETAINED_DRAW_SIZE > 0
+    stats->size = retained_size;
+#endif
+}
+
+void lv_obj_retained_draw_reset_stats(void)
+{
+    lv_memzero(&retained_stats, sizeof(retained_stats));
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void send_draw_main_events(lv_layer_t * layer, lv_obj_t * obj)
+{
+    lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN_BEGIN, layer);
+    lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN, layer);
+    lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN_END, layer);
+}
+
+#if LV_OBJ_RETAINED_DRAW_SIZE > 0
+
+/**
+ * Send the draw events with the whole object in the clip area and keep the created tasks.
+ * The tasks are drawn right away, clipped to the original clip area.
+ */
+static void record(lv_layer_t * layer, lv_obj_t * obj, const lv_area_t * coords_ext)
+{
+    LV_PROFILER_REFR_BEGIN;
+    recorder_t recorder;
+    lv_memzero(&recorder, sizeof(recorder));
+    recorder.layer = layer;
+    recorder.clip_area = layer->_clip_area;
+
+    /*The object might skip the parts out of the clip area, but the tasks should be usable on any area*/
+    layer->_clip_area = *coords_ext;
+    lv_draw_set_record_cb(record_cb, &recorder);
+    send_draw_main_events(layer, obj);
+    lv_draw_set_record_cb(NULL, NULL);
+    layer->_clip_area = recorder.clip_area;
+
+    /*An object which can't be replayed is remembered too, to not record it again until it changes*/
+    uint32_t size = sizeof(lv_obj_retained_draw_t) + (recorder.failed ? 0 : recorder.size);
+    if(retained_size + size > LV_OBJ_RETAINED_DRAW_SIZE) {
+        LV_PROFILER_REFR_END;
+        return;
+    }
+
+    lv_obj_retained_draw_t * retained = lv_malloc(size);
+    if(retained == NULL) {
+        LV_PROFILER_REFR_END;
+        return;
+    }
+
+    retained->coords = *coords_ext;
+    retained->opa = layer->opa;
+    retained->recolor = layer->recolor;
+    retained->replayable = !recorder.failed;
+    retained->size = size;
+    retained->task_cnt = recorder.failed ? 0 : recorder.task_cnt;
+    if(retained->task_cnt) lv_memcpy(retained->tasks, record_buf, recorder.size);
+
+    obj->retained_draw = retained;
+    retained_size += size;
+    retained_stats.record_cnt++;
+    LV_PROFILER_REFR_END;
+}
+
+/**
+ * Add copies of the kept tasks which are visible on the clip area of the layer
+ */
+static void replay(lv_layer_t * layer, const lv_obj_retained_draw_t * retained)
+{
+    LV_PROFILER_REFR_BEGIN;
+    const uint8_t * p = retained->tasks;
+    uint32_t i;
+    for(i = 0; i < retained->task_cnt; i++) {
+        const retained_task_t * rt = (const retained_task_t *)p;
+        p += rt->size;
+
+        lv_area_t clip_area;
+        if(!lv_area_intersect(&clip_area, &rt->clip_area, &layer->_clip_area) ||
+           !lv_area_is_on(&rt->real_area, &clip_area)) {
+            retained_stats.skip_cnt++;
+            continue;
+        }
+
+        const uint8_t * dsc = (const uint8_t *)rt + ALIGN_SIZE(sizeof(retained_task_t));
+        uint32_t dsc_size = get_dsc_size(rt->type);
+
+        lv_draw_task_t * t = lv_draw_add_task(layer, &rt->area, rt->type);
+        lv_memcpy(t->draw_dsc, dsc, dsc_size);
+        /*The recorded descriptor points to the layer of the recording*/
+        ((lv_draw_dsc_base_t *)t->draw_dsc)->layer = layer;
+        t->_real_area = rt->real_area;
+        t->clip_area = clip_area;
+
+        /*The task frees its text when it's ready*/
+        lv_draw_label_dsc_t * label_dsc = lv_draw_task_get_label_dsc(t);
+        if(label_dsc && label_dsc->text_local) {
+            label_dsc->text = lv_strdup((const char *)dsc + ALIGN_SIZE(dsc_size));
+            LV_ASSERT_MALLOC(label_dsc->text);
+        }
+
+        lv_draw_finalize_task_creation(layer, t);
+        retained_stats.task_cnt++;
+    }
+
+    retained_stats.replay_cnt++;
+    LV_PROFILER_REFR_END;
+}
+
+/**
+ * Keep a copy of a new draw task and clip it to the area which is really drawn now
+ */
+static bool record_cb(lv_draw_task_t * t, void * user_data)
+{
+    recorder_t * recorder = user_data;
+
+    /*E.g. the tasks of a layer created by the object*/
+    if(t->target_layer != recorder->layer) {
+        recorder->failed = true;
+        return true;
+    }
+
+    lv_area_t clip_area_obj = t->clip_area;
+    bool visible = lv_area_intersect(&t->clip_area, &clip_area_obj, &recorder->clip_area) &&
+                   lv_area_is_on(&t->_real_area, &t->clip_area);
+
+    /*Layers have to be blended even if they are out of the clip area*/
+    if(t->type == LV_DRAW_TASK_TYPE_LAYER) {
+        recorder->failed = true;
+        return true;
+    }
+
+    if(recorder->failed) return visible;
+
+    /*Masks are added to the whole layer and other tasks might own resources*/
+    uint32_t dsc_size = get_dsc_size(t->type);
+    if(dsc_size == 0) {
+        recorder->failed = true;
+        return visible;
+    }
+
+    const char * text = NULL;
+    uint32_t text_size = 0;
+    lv_draw_label_dsc_t * label_dsc = lv_draw_task_get_label_dsc(t);
+    if(label_dsc && label_dsc->text_local) {
+        text = label_dsc->text;
+        text_size = lv_strlen(text) + 1;
+    }
+
+    uint32_t size = ALIGN_SIZE(sizeof(retained_task_t)) + ALIGN_SIZE(dsc_size) + ALIGN_SIZE(text_size);
+    if(retained_size + sizeof(lv_obj_retained_draw_t) + recorder->size + size > LV_OBJ_RETAINED_DRAW_SIZE) {
+        recorder->failed = true;
+        return visible;
+    }
+
+    /*The buffer is reused by all the recordings*/
+    if(recorder->size + size > record_buf_size) {
+        uint32_t new_size = LV_MAX(record_buf_size * 2, recorder->size + size);
+        uint8_t * new_buf = lv_realloc(record_buf, new_size);
+        if(new_buf == NULL) {
+            recorder->failed = true;
+            return visible;
+        }
+        record_buf = new_buf;
+        record_buf_size = new_size;
+    }
+
+    retained_task_t * rt = (retained_task_t *)(record_buf + recorder->size);
+    rt->area = t->area;
+    rt->real_area = t->_real_area;
+    rt->clip_area = clip_area_obj;
+    rt->size = size;
+    rt->type = t->type;
+
+    uint8_t * dsc = (uint8_t *)rt + ALIGN_SIZE(sizeof(retained_task_t));
+    lv_memcpy(dsc, t->draw_dsc, dsc_size);
+    if(text) lv_memcpy(dsc + ALIGN_SIZE(dsc_size), text, text_size);
+
+    recorder->size += size;
+    recorder->task_cnt++;
+
+    return visible;
+}
+
+/**
+ * Get the size of the descriptor of the draw tasks which can be kept
+ * @return      the size, 0 for the tasks which can't be kept
+ */
+static uint32_t get_dsc_size(lv_draw_task_type_t type)
+{
+    switch(type) {
+        case LV_DRAW_TASK_TYPE_FILL:
+            return sizeof(lv_draw_fill_dsc_t);
+        case LV_DRAW_TASK_TYPE_BORDER:
+            return sizeof(lv_draw_border_dsc_t);
+        case LV_DRAW_TASK_TYPE_BOX_SHADOW:
+            return sizeof(lv_draw_box_shadow_dsc_t);
+        case LV_DRAW_TASK_TYPE_LETTER:
+            return sizeof(lv_draw_letter_dsc_t);
+        case LV_DRAW_TASK_TYPE_LABEL:
+            return sizeof(lv_draw_label_dsc_t);
+        case LV_DRAW_TASK_TYPE_IMAGE:
+            return sizeof(lv_draw_image_dsc_t);
+        case LV_DRAW_TASK_TYPE_LINE:
+            return sizeof(lv_draw_line_dsc_t);
+        case LV_DRAW_TASK_TYPE_ARC:
+            return sizeof(lv_draw_arc_dsc_t);
+        case LV_DRAW_TASK_TYPE_TRIANGLE:
+            return sizeof(lv_draw_triangle_dsc_t);
+        default:
+            return 0;
+    }
+}
+
+#endif /*LV_OBJ_RETAINED_DRAW_SIZE > 0*/
@@ -0,0 +1,93 @@
+/**
+ * @file lv_obj_retained_draw_private.h
+ *
+ */
+
+#ifndef LV_OBJ_RETAINED_DRAW_PRIVATE_H
+#define LV_OBJ_RETAINED_DRAW_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../misc/lv_area.h"
+#include "../misc/lv_color.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** Statistics of the draw tasks kept by the objects, see `LV_OBJ_RETAINED_DRAW_SIZE`*/
+typedef struct {
+    uint32_t record_cnt;    /**< Number of times the draw events were sent and their draw tasks were kept*/
+    uint32_t replay_cnt;    /**< Number of times the kept draw tasks were added instead of sending the draw events*/
+    uint32_t task_cnt;      /**< Number of draw tasks added by the replays*/
+    uint32_t skip_cnt;      /**< Number of kept draw tasks not added by the replays as they were out of the clip area*/
+    uint32_t size;          /**< Bytes used by the kept draw tasks*/
+} lv_obj_retained_draw_stats_t;
+
+#if LV_OBJ_RETAINED_DRAW_SIZE > 0
+/** The draw tasks created by the `LV_EVENT_DRAW_MAIN` events of an object*/
+struct _lv_obj_retained_draw_t {
+    lv_area_t coords;       /**< Coordinates of the object with its ext. draw size when the tasks were created*/
+    lv_color32_t recolor;   /**< Recolor of the layer when the tasks were created*/
+    lv_opa_t opa;           /**< Opacity of the layer when the tasks were created*/
+    uint8_t replayable : 1; /**< 0: the tasks couldn't be kept, send the draw events*/
+    uint32_t size;          /**< Bytes allocated for this structure and the tasks*/
+    uint32_t task_cnt;
+    uint8_t tasks[];        /**< The tasks with their descriptors one after the other*/
+};
+#endif
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Free the memory used to keep draw tasks
+ */
+void lv_obj_retained_draw_deinit(void);
+
+/**
+ * Send the `LV_EVENT_DRAW_MAIN_BEGIN`, `LV_EVENT_DRAW_MAIN` and `LV_EVENT_DRAW_MAIN_END` events to an object,
+ * or add the draw tasks they created last time if the object hasn't changed since.
+ * @param layer         the layer to draw to, its clip area is already set to the object
+ * @param obj           the object to draw
+ * @param coords_ext    coordinates of the object with its ext. draw size
+ */
+void lv_obj_retained_draw_main(lv_layer_t * layer, lv_obj_t * obj, const lv_area_t * coords_ext);
+
+/**
+ * Free the draw tasks kept by an object as it has changed
+ * @param obj           pointer to an object
+ */
+void lv_obj_retained_draw_free(lv_obj_t * obj);
+
+/**
+ * Get the statistics of the draw tasks kept by the objects
+ * @param stats         store the statistics here
+ */
+void lv_obj_retained_draw_get_stats(lv_obj_retained_draw_stats_t * stats);
+
+/**
+ * Clear the counters of the draw tasks kept by the objects
+ */
+void lv_obj_retained_draw_reset_stats(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_OBJ_RETAINED_DRAW_PRIVATE_H*/
@@ -23,6 +23,8 @@
 #define style_trans_ll_p &(LV_GLOBAL_DEFAULT()->style_trans_ll)
 #define _style_custom_prop_flag_lookup_table LV_GLOBAL_DEFAULT()->style_custom_prop_flag_lookup_table
 #define STYLE_PROP_SHIFTED(prop) ((uint32_t)1 << ((prop) >> 3))
+#define style_resolved_size LV_GLOBAL_DEFAULT()->style_resolved_cache_size
+#define style_resolved_gen LV_GLOBAL_DEFAULT()->style_resolved_gen
 
 /**********************
  *      TYPEDEFS
@@ -55,6 +57,9 @@ static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector
 static lv_obj_style_t * get_trans_style(lv_obj_t * obj, lv_part_t part);
 static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
                                     lv_style_value_t * v);
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE > 0
+static lv_obj_style_resolved_t * get_resolved(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop);
+#endif
 static void report_style_change_core(void * style, lv_obj_t * obj);
 static void refresh_children_style(lv_obj_t * obj);
 static bool trans_delete(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, trans_t * tr_limit);
@@ -260,6 +265,8 @@ void lv_obj_remove_style_all(lv_obj_t * obj)
 
 void lv_obj_report_style_change(lv_style_t * style)
 {
+    lv_obj_style_invalidate_resolved();
+
     if(!style_refr) return;
     lv_display_t * d = lv_display_get_next(NULL);
 
@@ -276,6 +283,10 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    /*Even if not refreshed now, the next look ups have to see the new values.
+     *The children might inherit them, so outdate all objects.*/
+    lv_obj_style_invalidate_resolved();
+
     if(!style_refr) return;
 
     LV_PROFILER_STYLE_BEGIN;
@@ -331,14 +342,28 @@ lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_
 {
     LV_ASSERT_NULL(obj)
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE > 0
+    lv_obj_style_resolved_t * res = get_resolved(obj, part, prop);
+    uint32_t word = prop >> 5;
+    uint32_t bit = (uint32_t)1 << (prop & 0x1F);
+    if(res && (res->checked[word] & bit)) return res->values[prop];
+#endif
+
     lv_style_selector_t selector = part | obj->state;
     lv_style_value_t value_act = { .ptr = NULL };
     lv_style_res_t found;
 
     found = get_selector_style_prop(obj, selector, prop, &value_act);
-    if(found == LV_STYLE_RES_FOUND) return value_act;
+    if(found != LV_STYLE_RES_FOUND) value_act = lv_style_prop_get_default(prop);
 
-    return lv_style_prop_get_default(prop);
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE > 0
+    if(res) {
+        res->values[prop] = value_act;
+        res->checked[word] |= bit;
+    }
+#endif
+
+    return value_act;
 }
 
 bool lv_obj_has_style_prop(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop)
@@ -681,6 +706,29 @@ lv_color32_t lv_obj_get_style_recolor_recursive(const lv_obj_t * obj, lv_part_t
     return result;
 }
 
+void lv_obj_style_invalidate_resolved(void)
+{
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE > 0
+    style_resolved_gen++;
+#endif
+}
+
+void lv_obj_style_free_resolved(lv_obj_t * obj)
+{
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE > 0
+    lv_obj_style_resolved_t * res = obj->style_resolved;
+    while(res) {
+        lv_obj_style_resolved_t * next = res->next;
+        lv_free(res);
+        style_resolved_size -= sizeof(lv_obj_style_resolved_t);
+        res = next;
+    }
+    obj->style_resolved = NULL;
+#else
+    LV_UNUSED(obj);
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -811,6 +859,47 @@ static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_style_selector_t se
     else return LV_STYLE_RES_NOT_FOUND;
 }
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE > 0
+/**
+ * Get where to keep the resolved value of a property of an object's part.
+ * Allocate it on the first look up of the part while the memory limit allows it.
+ * @param obj       pointer to an object
+ * @param part      the part whose property is looked up
+ * @param prop      the property
+ * @return          the resolved values of the part or NULL if the property shouldn't be cached
+ */
+static lv_obj_style_resolved_t * get_resolved(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
+{
+    /*Transitions look up other states and skip the transition styles, don't cache them*/
+    if(prop >= LV_STYLE_NUM_BUILT_IN_PROPS || obj->skip_trans || obj->is_deleting) return NULL;
+
+    lv_obj_t * obj_mut = (lv_obj_t *)obj;
+    lv_obj_style_resolved_t * res = obj_mut->style_resolved;
+    while(res && res->part != part) res = res->next;
+
+    if(res == NULL) {
+        if(style_resolved_size + sizeof(lv_obj_style_resolved_t) > LV_OBJ_STYLE_RESOLVED_CACHE_SIZE) return NULL;
+
+        res = lv_malloc(sizeof(lv_obj_style_resolved_t));
+        if(res == NULL) return NULL;
+        style_resolved_size += sizeof(lv_obj_style_resolved_t);
+
+        res->part = part;
+        res->gen = style_resolved_gen - 1;
+        res->next = obj_mut->style_resolved;
+        obj_mut->style_resolved = res;
+    }
+
+    if(res->gen != style_resolved_gen || res->state != obj->state) {
+        lv_memzero(res->checked, sizeof(res->checked));
+        res->gen = style_resolved_gen;
+        res->state = obj->state;
+    }
+
+    return res;
+}
+#endif
+
 /**
  * Refresh the style of all children of an object. (Called recursively)
  * @param style refresh objects only with this
@@ -882,6 +971,7 @@ static bool trans_delete(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, t
                     lv_style_remove_prop((lv_style_t *)obj->styles[i].style, tr->prop);
                 }
             }
+            lv_obj_style_invalidate_resolved();
 
             /*Free the transition descriptor too*/
             lv_anim_delete(tr, NULL);
@@ -1010,6 +1100,7 @@ static void trans_anim_completed_cb(lv_anim_t * a)
 
                 lv_obj_style_t * obj_style = &obj->styles[i];
                 lv_style_remove_prop((lv_style_t *)obj_style->style, prop);
+                lv_obj_style_invalidate_resolved();
 
                 if(lv_style_is_empty(obj->styles[i].style)) {
                     lv_obj_remove_style(obj, (lv_style_t *)obj_style->style, obj_style->selector);
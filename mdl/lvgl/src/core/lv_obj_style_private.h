@@ -31,6 +31,18 @@ struct _lv_obj_style_t {
     uint32_t is_trans : 1;
 };
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE > 0
+/** The built-in style properties of an object part resolved in a given state, with inheritance and defaults*/
+struct _lv_obj_style_resolved_t {
+    lv_obj_style_resolved_t * next;     /**< The next part of the object*/
+    lv_part_t part;
+    lv_state_t state;                   /**< The values are valid in this state only*/
+    uint32_t gen;                       /**< ... and until the styles change, see `lv_obj_style_invalidate_resolved`*/
+    uint32_t checked[(LV_STYLE_NUM_BUILT_IN_PROPS + 31) / 32];  /**< The value of the property is resolved*/
+    lv_style_value_t values[LV_STYLE_NUM_BUILT_IN_PROPS];       /**< As `lv_obj_get_style_prop` returns them*/
+};
+#endif
+
 struct _lv_obj_style_transition_dsc_t {
     uint16_t time;
     uint16_t delay;
@@ -57,6 +69,19 @@ void lv_obj_style_init(void);
  */
 void lv_obj_style_deinit(void);
 
+/**
+ * Outdate the resolved style properties of all objects.
+ * Called by LVGL when the styles, the state or the parent of an object change.
+ */
+void lv_obj_style_invalidate_resolved(void);
+
+/**
+ * Free the resolved style properties of an object.
+ * Called by LVGL when the object is deleted.
+ * @param obj       pointer to an object
+ */
+void lv_obj_style_free_resolved(lv_obj_t * obj);
+
 /**
  * Used internally to create a style transition
  * @param obj
@@ -13,6 +13,8 @@
 #include "../draw/lv_draw_mask_private.h"
 #include "lv_obj_private.h"
 #include "lv_obj_event_private.h"
+#include "lv_obj_bitmap_cache_private.h"
+#include "lv_obj_retained_draw_private.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
 #include "../tick/lv_tick.h"
@@ -31,15 +33,31 @@
 
 /*Display being refreshed*/
 #define disp_refr LV_GLOBAL_DEFAULT()->disp_refresh
+#define occlusion_layer LV_GLOBAL_DEFAULT()->refr_occlusion_layer
+#define occluded_objs LV_GLOBAL_DEFAULT()->refr_occluded
+#define occlusion_stats LV_GLOBAL_DEFAULT()->refr_occlusion_stats
+
+/*Number of opaque areas collected to find the covered objects*/
+#define OCCLUDER_MAX 8
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+/*Opaque areas of the objects drawn after the current one*/
+typedef struct {
+    lv_area_t areas[OCCLUDER_MAX];
+    uint32_t cnt;
+} occluders_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static void lv_refr_join_area(void);
+static void join_area_by_cost(void);
+static void inv_area_merge_cheapest(lv_display_t * disp, const lv_area_t * area_p);
+static int64_t area_merge_gain(lv_display_t * disp, const lv_area_t * a1, const lv_area_t * a2);
+static int64_t area_refr_cost(lv_display_t * disp, const lv_area_t * area_p);
 static void refr_invalid_areas(void);
 static void refr_sync_areas(void);
 static void refr_area(const lv_area_t * area_p, int32_t y_offset);
@@ -47,8 +65,19 @@ static void refr_configured_layer(lv_layer_t * layer);
 static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
 static void refr_obj_and_children(lv_layer_t * layer, lv_obj_t * top_obj);
 static void refr_obj(lv_layer_t * layer, lv_obj_t * obj);
+static void occlusion_mark(lv_layer_t * layer, bool bottom);
+static void occlusion_mark_obj(lv_obj_t * obj, const lv_area_t * clip, bool opaque, occluders_t * occ);
+static void occlusion_mark_add(lv_obj_t * obj, bool main_only);
+static void occlusion_clear(void);
+static lv_cover_res_t occlusion_cover_check(lv_obj_t * obj, const lv_area_t * area);
+static bool occluders_cover(const occluders_t * occ, const lv_area_t * area);
+static void occluders_add(occluders_t * occ, const lv_area_t * area);
 static uint32_t get_max_row(lv_display_t * disp, int32_t area_w, int32_t area_h);
+static uint32_t flush_ready_tiles(lv_layer_t * layer, const lv_area_t * area_p, int32_t tile_h, uint32_t tile_cnt,
+                                  uint32_t flushed_cnt, uint32_t ready_cnt, bool wait);
 static void draw_buf_flush(lv_display_t * disp);
+static void flush_area(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map, bool last);
+static bool tile_flush_is_enabled(lv_display_t * disp);
 static void call_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
 static void wait_for_flushing(lv_display_t * disp);
 
@@ -74,10 +103,12 @@ static void wait_for_flushing(lv_display_t * disp);
  */
 void lv_refr_init(void)
 {
+    lv_array_init(&occluded_objs, 16, sizeof(lv_obj_t *));
 }
 
 void lv_refr_deinit(void)
 {
+    lv_array_deinit(&occluded_objs);
 }
 
 void lv_refr_now(lv_display_t * disp)
@@ -116,9 +147,10 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj)
     /*If the object is visible on the current clip area*/
     layer->_clip_area = clip_coords_for_obj;
 
-    lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN_BEGIN, layer);
-    lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN, layer);
-    lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN_END, layer);
+    /*Skip the main drawing if its children or the objects drawn later cover it*/
+    if(!obj->main_occluded || layer != occlusion_layer) {
+        lv_obj_retained_draw_main(layer, obj, &obj_coords_ext);
+    }
 #if LV_USE_REFR_DEBUG
     lv_color_t debug_color = lv_color_make(lv_rand(0, 0xFF), lv_rand(0, 0xFF), lv_rand(0, 0xFF));
     lv_draw_rect_dsc_t draw_dsc;
@@ -319,13 +351,19 @@ void lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
     }
 
     /*Save the area*/
-    lv_area_t * tmp_area_p = &com_area;
-    if(disp->inv_p >= LV_INV_BUF_SIZE) { /*If no place for the area add the screen*/
-        disp->inv_p = 0;
-        tmp_area_p = &scr_area;
+    if(disp->inv_p >= LV_INV_BUF_SIZE && disp->area_merge_cost > 0) {
+        /*If no place merge the pair which grows the least*/
+        inv_area_merge_cheapest(disp, &com_area);
+    }
+    else {
+        lv_area_t * tmp_area_p = &com_area;
+        if(disp->inv_p >= LV_INV_BUF_SIZE) { /*If no place for the area add the screen*/
+            disp->inv_p = 0;
+            tmp_area_p = &scr_area;
+        }
+        lv_area_copy(&disp->inv_areas[disp->inv_p], tmp_area_p);
+        disp->inv_p++;
     }
-    lv_area_copy(&disp->inv_areas[disp->inv_p], tmp_area_p);
-    disp->inv_p++;
 
     lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
 }
@@ -348,6 +386,16 @@ void lv_refr_set_disp_refreshing(lv_display_t * disp)
     disp_refr = disp;
 }
 
+void lv_refr_get_occlusion_stats(lv_refr_occlusion_stats_t * stats)
+{
+    *stats = occlusion_stats;
+}
+
+void lv_refr_reset_occlusion_stats(void)
+{
+    lv_memzero(&occlusion_stats, sizeof(occlusion_stats));
+}
+
 void lv_display_refr_timer(lv_timer_t * tmr)
 {
     LV_PROFILER_REFR_BEGIN;
@@ -420,6 +468,8 @@ void lv_display_refr_timer(lv_timer_t * tmr)
     lv_memzero(disp_refr->inv_area_joined, sizeof(disp_refr->inv_area_joined));
     disp_refr->inv_p = 0;
 
+    lv_draw_task_pool_frame_end();
+
 refr_finish:
 
 #if LV_DRAW_SW_COMPLEX == 1
@@ -442,6 +492,12 @@ refr_finish:
 static void lv_refr_join_area(void)
 {
     LV_PROFILER_REFR_BEGIN;
+    if(disp_refr->area_merge_cost > 0) {
+        join_area_by_cost();
+        LV_PROFILER_REFR_END;
+        return;
+    }
+
     uint32_t join_from;
     uint32_t join_in;
     lv_area_t joined_area;
@@ -475,6 +531,153 @@ static void lv_refr_join_area(void)
     LV_PROFILER_REFR_END;
 }
 
+/**
+ * Greedily merge the pair of areas which saves the most until no merge saves anything.
+ * Every area remembers its best partner, so after a merge only the areas which
+ * pointed to the merged ones are searched again.
+ */
+static void join_area_by_cost(void)
+{
+    int64_t best_gain[LV_INV_BUF_SIZE];
+    uint32_t best_with[LV_INV_BUF_SIZE];
+    uint32_t cnt = disp_refr->inv_p;
+    uint32_t i;
+    uint32_t j;
+
+    for(i = 0; i < cnt; i++) {
+        best_gain[i] = 0;
+        best_with[i] = i;
+        for(j = 0; j < cnt; j++) {
+            if(j == i) continue;
+            int64_t gain = area_merge_gain(disp_refr, &disp_refr->inv_areas[i], &disp_refr->inv_areas[j]);
+            if(gain > best_gain[i]) {
+                best_gain[i] = gain;
+                best_with[i] = j;
+            }
+        }
+    }
+
+    while(1) {
+        uint32_t join_in = 0;
+        int64_t gain_max = 0;
+        for(i = 0; i < cnt; i++) {
+            if(disp_refr->inv_area_joined[i] == 0 && best_gain[i] > gain_max) {
+                gain_max = best_gain[i];
+                join_in = i;
+            }
+        }
+        if(gain_max <= 0) break;
+
+        uint32_t join_from = best_with[join_in];
+        lv_area_join(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_in],
+                     &disp_refr->inv_areas[join_from]);
+        disp_refr->inv_area_joined[join_from] = 1;
+
+        /*The gains with the grown area changed, the others are still valid*/
+        for(i = 0; i < cnt; i++) {
+            if(disp_refr->inv_area_joined[i]) continue;
+
+            bool search = i == join_in || best_with[i] == join_in || best_with[i] == join_from;
+            if(!search) {
+                int64_t gain = area_merge_gain(disp_refr, &disp_refr->inv_areas[i], &disp_refr->inv_areas[join_in]);
+                if(gain > best_gain[i]) {
+                    best_gain[i] = gain;
+                    best_with[i] = join_in;
+                }
+                continue;
+            }
+
+            best_gain[i] = 0;
+            best_with[i] = i;
+            for(j = 0; j < cnt; j++) {
+                if(j == i || disp_refr->inv_area_joined[j]) continue;
+                int64_t gain = area_merge_gain(disp_refr, &disp_refr->inv_areas[i], &disp_refr->inv_areas[j]);
+                if(gain > best_gain[i]) {
+                    best_gain[i] = gain;
+                    best_with[i] = j;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Make room for a new area in a full buffer by merging the two areas, the new one included,
+ * whose bounding box adds the least cost.
+ * @param disp      pointer to a display with a full area buffer
+ * @param area_p    the new area
+ */
+static void inv_area_merge_cheapest(lv_display_t * disp, const lv_area_t * area_p)
+{
+    /*Index `LV_INV_BUF_SIZE` is the new area*/
+    uint32_t cnt = LV_INV_BUF_SIZE + 1;
+    uint32_t best_i = 0;
+    uint32_t best_j = LV_INV_BUF_SIZE;
+    int64_t best_gain = area_merge_gain(disp, &disp->inv_areas[0], area_p);
+    uint32_t i;
+    uint32_t j;
+    for(i = 0; i < cnt; i++) {
+        const lv_area_t * a1 = i < LV_INV_BUF_SIZE ? &disp->inv_areas[i] : area_p;
+        for(j = i + 1; j < cnt; j++) {
+            const lv_area_t * a2 = j < LV_INV_BUF_SIZE ? &disp->inv_areas[j] : area_p;
+            int64_t gain = area_merge_gain(disp, a1, a2);
+            if(gain > best_gain) {
+                best_gain = gain;
+                best_i = i;
+                best_j = j;
+            }
+        }
+    }
+
+    /*Either the new area goes into an old one or it takes the place of the merged one*/
+    if(best_j == LV_INV_BUF_SIZE) {
+        lv_area_join(&disp->inv_areas[best_i], &disp->inv_areas[best_i], area_p);
+    }
+    else {
+        lv_area_join(&disp->inv_areas[best_i], &disp->inv_areas[best_i], &disp->inv_areas[best_j]);
+        lv_area_copy(&disp->inv_areas[best_j], area_p);
+    }
+}
+
+/**
+ * How much cheaper it is to refresh the bounding box of two areas than both of them
+ * @param disp      pointer to a display
+ * @param a1        pointer to an area
+ * @param a2        pointer to an other area
+ * @return          the saved cost, negative if the merge costs more
+ */
+static int64_t area_merge_gain(lv_display_t * disp, const lv_area_t * a1, const lv_area_t * a2)
+{
+    lv_area_t joined_area;
+    lv_area_join(&joined_area, a1, a2);
+    return area_refr_cost(disp, a1) + area_refr_cost(disp, a2) - area_refr_cost(disp, &joined_area);
+}
+
+/**
+ * Estimate the cost of refreshing an area: its pixels and `area_merge_cost` for each band
+ * of the draw buffer it's split into. Like `get_max_row()` without asking the rounder.
+ * @param disp      pointer to a display
+ * @param area_p    pointer to an area
+ * @return          the cost in pixels
+ */
+static int64_t area_refr_cost(lv_display_t * disp, const lv_area_t * area_p)
+{
+    int32_t w = lv_area_get_width(area_p);
+    int32_t h = lv_area_get_height(area_p);
+    int32_t band_cnt = 1;
+
+    if(disp->render_mode == LV_DISPLAY_RENDER_MODE_PARTIAL && disp->buf_act) {
+        uint32_t stride = lv_draw_buf_width_to_stride(w, disp->color_format);
+        uint32_t overhead = LV_COLOR_INDEXED_PALETTE_SIZE(disp->color_format) * sizeof(lv_color32_t);
+        if(stride > 0 && disp->buf_act->data_size > overhead) {
+            int32_t max_row = (int32_t)((disp->buf_act->data_size - overhead) / stride);
+            if(max_row > 0) band_cnt = (h + max_row - 1) / max_row;
+        }
+    }
+
+    return (int64_t)w * h + (int64_t)band_cnt * disp->area_merge_cost;
+}
+
 /**
  * Refresh the sync areas
  */
@@ -654,6 +857,9 @@ static void refr_invalid_areas(void)
         }
     }
 
+    /*All draw tasks are ready, the cached bitmaps they used can be evicted again*/
+    lv_obj_bitmap_cache_release_drawn();
+
     lv_display_send_event(disp_refr, LV_EVENT_RENDER_READY, NULL);
     disp_refr->rendering_in_progress = false;
     LV_PROFILER_REFR_END;
@@ -758,10 +964,14 @@ static void refr_area(const lv_area_t * area_p, int32_t y_offset)
         }
 
 
-        /*Wait until all tiles are ready and destroy remove them*/
+        /*Wait until all tiles are ready and destroy remove them.
+         *If enabled flush each tile right away, the later ones are rendered meanwhile.*/
+        bool flush_tiles = tile_flush_is_enabled(disp_refr);
+        uint32_t flushed_cnt = 0;
         for(i = 0; i < tile_cnt; i++) {
             lv_layer_t * tile_layer = &tile_layers[i];
             while(tile_layer->draw_task_head) {
+                if(flush_tiles) flushed_cnt = flush_ready_tiles(layer, area_p, tile_h, tile_cnt, flushed_cnt, i, false);
                 lv_draw_dispatch_wait_for_request();
                 lv_draw_dispatch();
             }
@@ -777,7 +987,9 @@ static void refr_area(const lv_area_t * area_p, int32_t y_offset)
 
             if(disp_refr->layer_deinit) disp_refr->layer_deinit(disp_refr, tile_layer);
         }
+        if(flush_tiles) flush_ready_tiles(layer, area_p, tile_h, tile_cnt, flushed_cnt, tile_cnt, true);
         lv_free(tile_layers);
+        disp_refr->tiles_flushed = flush_tiles;
     }
 
     disp_refr->refreshed_area = *area_p;
@@ -869,6 +1081,9 @@ static void refr_configured_layer(lv_layer_t * layer)
         top_prev_scr = lv_refr_get_top_obj(&layer->_clip_area, disp_refr->prev_scr);
     }
 
+    /*Find the objects covered by the ones drawn after them*/
+    if(disp_refr->occlusion_culling) occlusion_mark(layer, top_act_scr == NULL && top_prev_scr == NULL);
+
     /*Draw a bottom layer background if there is no top object*/
     if(top_act_scr == NULL && top_prev_scr == NULL) {
         refr_obj_and_children(layer, lv_display_get_layer_bottom(disp_refr));
@@ -899,9 +1114,187 @@ static void refr_configured_layer(lv_layer_t * layer)
     refr_obj_and_children(layer, lv_display_get_layer_top(disp_refr));
     refr_obj_and_children(layer, lv_display_get_layer_sys(disp_refr));
 
+    if(occlusion_layer == layer) occlusion_clear();
+
     LV_PROFILER_REFR_END;
 }
 
+/**
+ * Mark the objects which are covered on the clip area of a layer by opaque objects drawn after them.
+ * The objects are visited in the reverse order of drawing, collecting the areas covered so far.
+ * @param layer     the layer to be drawn
+ * @param bottom    true: the bottom layer is drawn too
+ */
+static void occlusion_mark(lv_layer_t * layer, bool bottom)
+{
+    occluders_t occ;
+    occ.cnt = 0;
+    occlusion_layer = layer;
+    occlusion_stats.area_cnt++;
+
+    const lv_area_t * clip = &layer->_clip_area;
+    occlusion_mark_obj(lv_display_get_layer_sys(disp_refr), clip, true, &occ);
+    occlusion_mark_obj(lv_display_get_layer_top(disp_refr), clip, true, &occ);
+    if(disp_refr->draw_prev_over_act) {
+        occlusion_mark_obj(disp_refr->prev_scr, clip, true, &occ);
+        occlusion_mark_obj(disp_refr->act_scr, clip, true, &occ);
+    }
+    else {
+        occlusion_mark_obj(disp_refr->act_scr, clip, true, &occ);
+        occlusion_mark_obj(disp_refr->prev_scr, clip, true, &occ);
+    }
+    if(bottom) occlusion_mark_obj(lv_display_get_layer_bottom(disp_refr), clip, true, &occ);
+}
+
+/**
+ * Mark an object and its children if they are covered, then add the area it covers.
+ * @param obj       the object, NULL is ignored
+ * @param clip      the clip area of the object like in `lv_obj_redraw`
+ * @param opaque    false if a parent makes the object transparent or masks it
+ * @param occ       the areas covered by the objects drawn after this one
+ */
+static void occlusion_mark_obj(lv_obj_t * obj, const lv_area_t * clip, bool opaque, occluders_t * occ)
+{
+    if(obj == NULL) return;
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return;
+    if(lv_obj_get_style_opa_layered(obj, LV_PART_MAIN) <= LV_OPA_MIN) return;
+
+    lv_area_t obj_coords_ext;
+    lv_obj_get_coords(obj, &obj_coords_ext);
+    int32_t ext_draw_size = lv_obj_get_ext_draw_size(obj);
+    lv_area_increase(&obj_coords_ext, ext_draw_size, ext_draw_size);
+
+    /*The object and its children draw only here*/
+    lv_area_t clip_coords_for_obj;
+    if(!lv_area_intersect(&clip_coords_for_obj, clip, &obj_coords_ext)) return;
+
+    /*A transformed object is drawn out of its area*/
+    lv_layer_type_t layer_type = lv_obj_get_layer_type(obj);
+    if(layer_type == LV_LAYER_TYPE_TRANSFORM) return;
+
+    if(occluders_cover(occ, &clip_coords_for_obj)) {
+        occlusion_mark_add(obj, false);
+        return;
+    }
+
+    /*The children are drawn to an other layer or from a bitmap, leave them as they are*/
+    if(layer_type != LV_LAYER_TYPE_NONE || lv_obj_has_flag(obj, LV_OBJ_FLAG_CACHE_BITMAP)) return;
+
+    opaque = opaque && lv_obj_get_style_opa(obj, LV_PART_MAIN) >= LV_OPA_MAX;
+
+    lv_area_t obj_area;
+    lv_cover_res_t cover = LV_COVER_RES_NOT_COVER;
+    if(opaque && lv_area_intersect(&obj_area, &clip_coords_for_obj, &obj->coords)) {
+        cover = occlusion_cover_check(obj, &obj_area);
+    }
+
+    const lv_area_t * obj_coords;
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) {
+        obj_coords = &obj_coords_ext;
+    }
+    else {
+        obj_coords = &obj->coords;
+    }
+    lv_area_t clip_coords_for_children;
+    if(lv_area_intersect(&clip_coords_for_children, &clip_coords_for_obj, obj_coords)) {
+        /*The rounded corners are masked on an other layer*/
+        bool opaque_children = opaque && cover != LV_COVER_RES_MASKED &&
+                               !lv_obj_get_style_clip_corner(obj, LV_PART_MAIN);
+        int32_t i;
+        int32_t child_cnt = lv_obj_get_child_count(obj);
+        for(i = child_cnt - 1; i >= 0; i--) {
+            lv_obj_t * child = obj->spec_attr->children[i];
+            occlusion_mark_obj(child, &clip_coords_for_children, opaque_children, occ);
+        }
+    }
+
+    if(occluders_cover(occ, &clip_coords_for_obj)) {
+        occlusion_mark_add(obj, true);
+        return;
+    }
+
+    if(cover == LV_COVER_RES_COVER) {
+        occluders_add(occ, &obj_area);
+    }
+    else if(cover == LV_COVER_RES_NOT_COVER && opaque) {
+        /*A rounded object still covers the band between its corners*/
+        int32_t radius = lv_obj_get_style_radius(obj, LV_PART_MAIN);
+        int32_t short_side = LV_MIN(lv_area_get_width(&obj->coords), lv_area_get_height(&obj->coords));
+        radius = LV_MIN(radius, short_side >> 1);
+        if(radius <= 0) return;
+
+        lv_area_t band = obj->coords;
+        band.y1 += radius;
+        band.y2 -= radius;
+        if(!lv_area_intersect(&band, &band, &clip_coords_for_obj)) return;
+        if(occlusion_cover_check(obj, &band) == LV_COVER_RES_COVER) {
+            occluders_add(occ, &band);
+        }
+    }
+}
+
+static void occlusion_mark_add(lv_obj_t * obj, bool main_only)
+{
+    if(lv_array_push_back(&occluded_objs, &obj) != LV_RESULT_OK) return;
+
+    if(main_only) {
+        obj->main_occluded = 1;
+        occlusion_stats.main_cnt++;
+    }
+    else {
+        obj->occluded = 1;
+        occlusion_stats.obj_cnt++;
+    }
+}
+
+static void occlusion_clear(void)
+{
+    uint32_t i;
+    for(i = 0; i < lv_array_size(&occluded_objs); i++) {
+        lv_obj_t ** obj = lv_array_at(&occluded_objs, i);
+        (*obj)->occluded = 0;
+        (*obj)->main_occluded = 0;
+    }
+    lv_array_clear(&occluded_objs);
+    occlusion_layer = NULL;
+}
+
+static lv_cover_res_t occlusion_cover_check(lv_obj_t * obj, const lv_area_t * area)
+{
+    lv_cover_check_info_t info;
+    info.res = LV_COVER_RES_COVER;
+    info.area = area;
+    lv_obj_send_event(obj, LV_EVENT_COVER_CHECK, &info);
+    return info.res;
+}
+
+static bool occluders_cover(const occluders_t * occ, const lv_area_t * area)
+{
+    uint32_t i;
+    for(i = 0; i < occ->cnt; i++) {
+        if(lv_area_is_in(area, &occ->areas[i], 0)) return true;
+    }
+    return false;
+}
+
+/*If there is no free slot replace the smallest area*/
+static void occluders_add(occluders_t * occ, const lv_area_t * area)
+{
+    if(occ->cnt < OCCLUDER_MAX) {
+        occ->areas[occ->cnt] = *area;
+        occ->cnt++;
+        return;
+    }
+
+    uint32_t min_i = 0;
+    uint32_t i;
+    for(i = 1; i < OCCLUDER_MAX; i++) {
+        if(lv_area_get_size(&occ->areas[i]) < lv_area_get_size(&occ->areas[min_i])) min_i = i;
+    }
+
+    if(lv_area_get_size(area) > lv_area_get_size(&occ->areas[min_i])) occ->areas[min_i] = *area;
+}
+
 /**
  * Search the most top object which fully covers an area
  * @param area_p pointer to an area
@@ -1189,6 +1582,9 @@ static void refr_obj(lv_layer_t * layer, lv_obj_t * obj)
 {
     if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return;
 
+    /*Covered by the objects drawn after it*/
+    if(obj->occluded && layer == occlusion_layer) return;
+
     /*If `opa_layered != LV_OPA_COVER` draw the widget on a new layer and blend that layer with the given opacity.*/
     const lv_opa_t opa_layered = lv_obj_get_style_opa_layered(obj, LV_PART_MAIN);
     if(opa_layered <= LV_OPA_MIN) return;
@@ -1206,7 +1602,9 @@ static void refr_obj(lv_layer_t * layer, lv_obj_t * obj)
 
     lv_layer_type_t layer_type = lv_obj_get_layer_type(obj);
     if(layer_type == LV_LAYER_TYPE_NONE) {
-        lv_obj_redraw(layer, obj);
+        if(!lv_obj_has_flag(obj, LV_OBJ_FLAG_CACHE_BITMAP) || lv_obj_bitmap_cache_draw(layer, obj) != LV_RESULT_OK) {
+            lv_obj_redraw(layer, obj);
+        }
     }
 #if LV_DRAW_TRANSFORM_USE_MATRIX
     /*If the layer opa is full then use the matrix transform*/
@@ -1354,24 +1752,24 @@ static void draw_buf_flush(lv_display_t * disp)
         lv_draw_dispatch();
     }
 
-    /* In double buffered mode wait until the other buffer is freed
-     * and driver is ready to receive the new buffer.
-     * If we need to wait here it means that the content of one buffer is being sent to display
-     * and other buffer already contains the new rendered image. */
-    if(lv_display_is_double_buffered(disp)) {
-        wait_for_flushing(disp_refr);
-    }
-
-    disp->flushing = 1;
-
-    if(disp->last_area && disp->last_part) disp->flushing_last = 1;
-    else disp->flushing_last = 0;
+    bool flushing_last = disp->last_area && disp->last_part;
 
-    bool flushing_last = disp->flushing_last;
+    /*The tiles of this area were flushed one by one already*/
+    if(disp->tiles_flushed) {
+        disp->tiles_flushed = 0;
+    }
+    else {
+        /* In double buffered mode wait until the other buffer is freed
+         * and driver is ready to receive the new buffer.
+         * If we need to wait here it means that the content of one buffer is being sent to display
+         * and other buffer already contains the new rendered image. */
+        if(lv_display_is_double_buffered(disp)) {
+            wait_for_flushing(disp_refr);
+        }
 
-    if(disp->flush_cb) {
-        call_flush_cb(disp, &disp->refreshed_area, layer->draw_buf->data);
+        flush_area(disp, &disp->refreshed_area, layer->draw_buf->data, flushing_last);
     }
+
     /*If there are 2 buffers swap them. With direct mode swap only on the last area*/
     if(lv_display_is_double_buffered(disp) && (disp->render_mode != LV_DISPLAY_RENDER_MODE_DIRECT || flushing_last)) {
         if(disp->buf_act == disp->buf_1) {
@@ -1386,6 +1784,65 @@ static void draw_buf_flush(lv_display_t * disp)
     }
 }
 
+/**
+ * Flush the rendered tiles in order while the display is free.
+ * @param layer         the display's layer the tiles are rendered to
+ * @param area_p        the area divided into tiles
+ * @param tile_h        height of a tile, the last one takes the remaining rows
+ * @param tile_cnt      number of tiles
+ * @param flushed_cnt   number of tiles flushed already
+ * @param ready_cnt     number of tiles rendered already
+ * @param wait          true: wait for the display to flush all the ready tiles
+ * @return              number of tiles flushed
+ */
+static uint32_t flush_ready_tiles(lv_layer_t * layer, const lv_area_t * area_p, int32_t tile_h, uint32_t tile_cnt,
+                                  uint32_t flushed_cnt, uint32_t ready_cnt, bool wait)
+{
+    while(flushed_cnt < ready_cnt) {
+        /*Only one flush can be in progress. Without `flush_wait_cb` it can be polled and
+         *the other tiles are rendered meanwhile. `flushing` is cleared only after `flush_wait_cb`
+         *has consumed the end of the flush, so call it right away; the draw units keep
+         *rendering the later tiles while it blocks.*/
+        if(disp_refr->flushing) {
+            if(!wait && disp_refr->flush_wait_cb == NULL) break;
+            wait_for_flushing(disp_refr);
+        }
+
+        /*A tile is a band of whole rows so its pixels are continuous in the buffer*/
+        int32_t y1 = area_p->y1 + (int32_t)flushed_cnt * tile_h;
+        int32_t y2 = flushed_cnt == tile_cnt - 1 ? area_p->y2 : y1 + tile_h - 1;
+        lv_area_t tile_area;
+        lv_area_set(&tile_area, area_p->x1, y1, area_p->x2, y2);
+        uint8_t * px_map = layer->draw_buf->data + (tile_area.y1 - layer->buf_area.y1) * layer->draw_buf->header.stride;
+
+        flush_area(disp_refr, &tile_area, px_map,
+                   disp_refr->last_area && disp_refr->last_part && flushed_cnt == tile_cnt - 1);
+        flushed_cnt++;
+    }
+
+    return flushed_cnt;
+}
+
+static void flush_area(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map, bool last)
+{
+    disp->flushing = 1;
+    disp->flushing_last = last ? 1 : 0;
+
+    if(disp->flush_cb) {
+        call_flush_cb(disp, area, px_map);
+    }
+}
+
+/**
+ * Tiles can be flushed one by one if they are bands of whole rows of a buffer
+ * which holds only the area being refreshed.
+ */
+static bool tile_flush_is_enabled(lv_display_t * disp)
+{
+    return disp->tile_flush && disp->render_mode == LV_DISPLAY_RENDER_MODE_PARTIAL &&
+           !lv_display_get_matrix_rotation(disp);
+}
+
 static void call_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
 {
     LV_PROFILER_REFR_BEGIN;
@@ -24,6 +24,13 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/** Statistics of skipping the covered objects, see `lv_display_set_occlusion_culling`*/
+typedef struct {
+    uint32_t area_cnt;      /**< Number of areas drawn with the covered objects skipped*/
+    uint32_t obj_cnt;       /**< Number of objects not drawn with their children as they were covered*/
+    uint32_t main_cnt;      /**< Number of objects without `LV_EVENT_DRAW_MAIN` as their own area was covered*/
+} lv_refr_occlusion_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -58,6 +65,17 @@ lv_display_t * lv_refr_get_disp_refreshing(void);
  */
 void lv_refr_set_disp_refreshing(lv_display_t * disp);
 
+/**
+ * Get the statistics of skipping the covered objects
+ * @param stats store the statistics here
+ */
+void lv_refr_get_occlusion_stats(lv_refr_occlusion_stats_t * stats);
+
+/**
+ * Clear the counters of skipping the covered objects
+ */
+void lv_refr_reset_occlusion_stats(void);
+
 /**********************
  *      MACROS
  **********************/
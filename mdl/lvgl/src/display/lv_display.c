@@ -590,6 +590,54 @@ uint32_t lv_display_get_tile_cnt(lv_display_t * disp)
     return disp->tile_cnt;
 }
 
+void lv_display_set_tile_flush(lv_display_t * disp, bool en)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    disp->tile_flush = en;
+}
+
+bool lv_display_get_tile_flush(lv_display_t * disp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return false;
+
+    return disp->tile_flush;
+}
+
+void lv_display_set_area_merge_cost(lv_display_t * disp, uint32_t cost)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    disp->area_merge_cost = cost;
+}
+
+uint32_t lv_display_get_area_merge_cost(lv_display_t * disp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return 0;
+
+    return disp->area_merge_cost;
+}
+
+void lv_display_set_occlusion_culling(lv_display_t * disp, bool en)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    disp->occlusion_culling = en;
+}
+
+bool lv_display_get_occlusion_culling(lv_display_t * disp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return false;
+
+    return disp->occlusion_culling;
+}
+
 void lv_display_set_antialiasing(lv_display_t * disp, bool en)
 {
     if(disp == NULL) disp = lv_display_get_default();
@@ -357,6 +357,59 @@ void lv_display_set_tile_cnt(lv_display_t * disp, uint32_t tile_cnt);
  */
 uint32_t lv_display_get_tile_cnt(lv_display_t * disp);
 
+/**
+ * Flush each tile as soon as its draw tasks are done instead of flushing the whole area
+ * once every tile is ready. It lets the flush run while the other tiles are still rendered.
+ * Only used in `LV_DISPLAY_RENDER_MODE_PARTIAL` without matrix rotation, where a tile is
+ * a band of whole rows in the buffer. `flush_cb` is called once per tile.
+ * @param disp              pointer to a display
+ * @param en                true: flush the tiles one by one
+ */
+void lv_display_set_tile_flush(lv_display_t * disp, bool en);
+
+/**
+ * Get whether the tiles are flushed one by one
+ * @param disp              pointer to a display
+ * @return                  true: the tiles are flushed as soon as they are ready
+ */
+bool lv_display_get_tile_flush(lv_display_t * disp);
+
+/**
+ * Merge the invalidated areas by their cost instead of joining only the overlapping ones.
+ * An area costs its pixels plus `cost` for every band of the draw buffer it is rendered in,
+ * as each band walks the object tree and calls `flush_cb` again. Two areas are merged if
+ * their bounding box costs less, even if they don't touch. When the buffer of the
+ * invalidated areas is full the pair which grows the least is merged instead of
+ * redrawing the whole screen.
+ * @param disp              pointer to a display
+ * @param cost              overhead of an area in pixels, 0: join only overlapping areas (default)
+ */
+void lv_display_set_area_merge_cost(lv_display_t * disp, uint32_t cost);
+
+/**
+ * Get the overhead of an area used to merge the invalidated areas
+ * @param disp              pointer to a display
+ * @return                  overhead of an area in pixels, 0: only overlapping areas are joined
+ */
+uint32_t lv_display_get_area_merge_cost(lv_display_t * disp);
+
+/**
+ * Skip the objects fully covered by opaque objects drawn after them in each refreshed area.
+ * Before drawing an area the object tree is walked from the top, collecting the opaque areas
+ * of the objects (by `LV_EVENT_COVER_CHECK`). An object hidden by them isn't drawn with its
+ * children, and an object hidden only by its children doesn't get `LV_EVENT_DRAW_MAIN`.
+ * @param disp              pointer to a display
+ * @param en                true: skip the covered objects, false: draw every object (default)
+ */
+void lv_display_set_occlusion_culling(lv_display_t * disp, bool en);
+
+/**
+ * Get whether the covered objects are skipped during refresh
+ * @param disp              pointer to a display
+ * @return                  true: the covered objects are not drawn
+ */
+bool lv_display_get_occlusion_culling(lv_display_t * disp);
+
 /**
  * Enable anti-aliasing for the render engine
  * @param disp      pointer to a display
@@ -93,6 +93,9 @@ struct _lv_display_t {
     lv_display_render_mode_t render_mode;
     uint32_t antialiasing : 1;       /**< 1: anti-aliasing is enabled on this display.*/
     uint32_t tile_cnt     : 8;       /**< Divide the display buffer into these number of tiles */
+    uint32_t tile_flush   : 1;       /**< 1: Flush each tile as soon as it's rendered */
+    uint32_t tiles_flushed : 1;      /**< 1: The tiles of the refreshed area were flushed already */
+    uint32_t occlusion_culling : 1;  /**< 1: Don't draw the objects covered by opaque objects above them */
     uint32_t stride_is_auto : 1;     /**< 1: The stride of the buffers was not set explicitly. */
 
 
@@ -106,6 +109,7 @@ struct _lv_display_t {
     uint8_t inv_area_joined[LV_INV_BUF_SIZE];
     uint32_t inv_p;
     int32_t inv_en_cnt;
+    uint32_t area_merge_cost;   /**< Cost of one more area or band in pixels, 0: join only overlapping areas */
 
     /** Double buffer sync areas (redrawn during last refresh) */
     lv_ll_t sync_areas;
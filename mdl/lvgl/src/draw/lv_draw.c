@@ -26,6 +26,12 @@
  *      DEFINES
  *********************/
 #define _draw_info LV_GLOBAL_DEFAULT()->draw_info
+#define pool_stats LV_GLOBAL_DEFAULT()->draw_info.task_pool_stats
+
+#if LV_DRAW_TASK_POOL_CHUNK_SIZE > 0
+    #define CHUNK_HEADER_SIZE   LV_ALIGN_UP(sizeof(lv_draw_task_chunk_t), 8)
+    #define CHUNK_BUF_SIZE      (LV_DRAW_TASK_POOL_CHUNK_SIZE - CHUNK_HEADER_SIZE)
+#endif
 
 /**********************
  *      TYPEDEFS
@@ -36,8 +42,20 @@
  **********************/
 static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check);
 static void cleanup_task(lv_draw_task_t * t, lv_display_t * disp);
+static lv_draw_task_t * task_alloc(size_t size);
+static void task_free(lv_draw_task_t * t);
+#if LV_DRAW_TASK_POOL_CHUNK_SIZE > 0
+    static void chunk_free_list(lv_draw_task_chunk_t * chunk);
+#endif
 static inline size_t get_draw_dsc_size(lv_draw_task_type_t type);
 static lv_draw_task_t * get_first_available_task(lv_layer_t * layer);
+static lv_draw_task_index_t * task_index_create(lv_layer_t * layer);
+static void task_index_delete(lv_layer_t * layer);
+static void task_index_insert(lv_draw_task_index_t * index, lv_draw_task_t * t);
+static void task_index_update(lv_draw_task_index_t * index, lv_draw_task_t * t);
+static void task_index_remove(lv_draw_task_index_t * index, lv_draw_task_t * t);
+static uint32_t task_index_get_node_cnt(const lv_draw_task_index_t * index, const lv_area_t * area);
+static uint8_t task_index_get_bin(int32_t coord, int32_t start, int32_t bin_size);
 
 #if LV_LOG_LEVEL <= LV_LOG_LEVEL_INFO
 static inline uint32_t get_layer_size_kb(uint32_t size_byte)
@@ -80,6 +98,14 @@ void lv_draw_deinit(void)
         lv_free(cur_unit);
     }
     _draw_info.unit_head = NULL;
+
+#if LV_DRAW_TASK_POOL_CHUNK_SIZE > 0
+    /*The chunks of the unfinished tasks are lost with the heap*/
+    lv_free(_draw_info.task_chunk_act);
+    _draw_info.task_chunk_act = NULL;
+    chunk_free_list(_draw_info.task_chunk_free);
+    _draw_info.task_chunk_free = NULL;
+#endif
 }
 
 void * lv_draw_create_unit(size_t size)
@@ -101,7 +127,18 @@ lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords,
     LV_PROFILER_DRAW_BEGIN;
     size_t dsc_size = get_draw_dsc_size(type);
     LV_ASSERT_FORMAT_MSG(dsc_size > 0, "Draw task size is 0 for type %d", type);
-    lv_draw_task_t * new_task = lv_malloc_zeroed(LV_ALIGN_UP(sizeof(lv_draw_task_t), 8) + dsc_size);
+
+    /*Only `lv_draw_get_next_available_task` checks the overlapping tasks. It's used by the
+     *threaded software renderer and when there are more draw units.
+     *Create the index only for an empty layer as all of its tasks need to be in it.*/
+    if(layer->draw_task_head == NULL && layer->task_index == NULL && (LV_USE_OS || _draw_info.unit_cnt > 1)) {
+        layer->task_index = task_index_create(layer);
+    }
+
+    /*Allocate the bin nodes with the task, the real area is rarely larger than the area*/
+    size_t task_size = LV_ALIGN_UP(sizeof(lv_draw_task_t), 8) + LV_ALIGN_UP(dsc_size, 8);
+    uint32_t node_cnt = layer->task_index ? task_index_get_node_cnt(layer->task_index, coords) : 0;
+    lv_draw_task_t * new_task = task_alloc(task_size + node_cnt * sizeof(lv_draw_task_index_node_t));
     LV_ASSERT_MALLOC(new_task);
     new_task->area = *coords;
     new_task->_real_area = *coords;
@@ -114,6 +151,16 @@ lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords,
     new_task->draw_dsc = (uint8_t *)new_task + LV_ALIGN_UP(sizeof(lv_draw_task_t), 8);
     new_task->state = LV_DRAW_TASK_STATE_QUEUED;
 
+    if(node_cnt > 0) {
+        new_task->index_node_buf = (lv_draw_task_index_node_t *)((uint8_t *)new_task + task_size);
+        new_task->index_node_buf_cnt = (uint8_t)node_cnt;
+    }
+
+    if(layer->task_index) {
+        new_task->index_seq = layer->task_index->seq++;
+        task_index_insert(layer->task_index, new_task);
+    }
+
     /*Find the tail*/
     if(layer->draw_task_head == NULL) {
         layer->draw_task_head = new_task;
@@ -137,6 +184,12 @@ void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
 
     lv_draw_global_info_t * info = &_draw_info;
 
+    if(info->record_cb && !info->record_cb(t, info->record_user_data)) {
+        t->state = LV_DRAW_TASK_STATE_READY;
+        LV_PROFILER_DRAW_END;
+        return;
+    }
+
     /*Send LV_EVENT_DRAW_TASK_ADDED and dispatch only on the "main" draw_task
      *and not on the draw tasks added in the event.
      *Sending LV_EVENT_DRAW_TASK_ADDED events might cause recursive event sends and besides
@@ -149,6 +202,9 @@ void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
             info->task_running = false;
         }
 
+        /*The real area is final now, it might be larger than the area the task was added with*/
+        if(layer->task_index) task_index_update(layer->task_index, t);
+
         /*Let the draw units set their preference score*/
         t->preference_score = 100;
         t->preferred_draw_unit_id = 0;
@@ -172,6 +228,8 @@ void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
         }
     }
     else {
+        if(layer->task_index) task_index_update(layer->task_index, t);
+
         /*Let the draw units set their preference score*/
         t->preference_score = 100;
         t->preferred_draw_unit_id = 0;
@@ -190,6 +248,42 @@ void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
     LV_PROFILER_DRAW_END;
 }
 
+void lv_draw_set_record_cb(lv_draw_record_cb_t cb, void * user_data)
+{
+    _draw_info.record_cb = cb;
+    _draw_info.record_user_data = user_data;
+}
+
+void lv_draw_task_pool_frame_end(void)
+{
+#if LV_DRAW_TASK_POOL_CHUNK_SIZE > 0
+    /*Give the memory back between the frames but keep a chunk to start the next one*/
+    if(_draw_info.task_chunk_free) {
+        chunk_free_list(_draw_info.task_chunk_free->next);
+        _draw_info.task_chunk_free->next = NULL;
+    }
+#endif
+
+    if(pool_stats.frame_task_cnt > pool_stats.frame_task_max) pool_stats.frame_task_max = pool_stats.frame_task_cnt;
+    pool_stats.frame_task_cnt = 0;
+}
+
+void lv_draw_task_pool_get_stats(lv_draw_task_pool_stats_t * stats)
+{
+    *stats = pool_stats;
+}
+
+void lv_draw_task_pool_reset_stats(void)
+{
+    pool_stats.task_cnt = 0;
+    pool_stats.task_live_max = pool_stats.task_live_cnt;
+    pool_stats.frame_task_cnt = 0;
+    pool_stats.frame_task_max = 0;
+    pool_stats.chunk_max = pool_stats.chunk_cnt;
+    pool_stats.chunk_alloc_cnt = 0;
+    pool_stats.heap_cnt = 0;
+}
+
 void lv_draw_wait_for_finish(void)
 {
 #if LV_USE_OS
@@ -241,6 +335,7 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
     while(t) {
         t_next = t->next;
         if(t->state == LV_DRAW_TASK_STATE_READY) {
+            if(layer->task_index) task_index_remove(layer->task_index, t);
             cleanup_task(t, disp);
             remove_task = true;
             if(t_prev != NULL)
@@ -254,6 +349,9 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
         t = t_next;
     }
 
+    /*Start a new index when new tasks are added*/
+    if(layer->draw_task_head == NULL && layer->task_index) task_index_delete(layer);
+
     bool task_dispatched = false;
 
     /*This layer is ready, enable blending its buffer*/
@@ -525,6 +623,31 @@ void lv_draw_task_get_area(const lv_draw_task_t * t, lv_area_t * area)
 static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check)
 {
     LV_PROFILER_DRAW_BEGIN;
+
+    /*Check only the older tasks in the bins of `t_check`, the overlapping ones are there for sure*/
+    lv_draw_task_index_t * index = layer->task_index;
+    if(index && !index->broken && t_check->index_nodes) {
+        uint32_t x, y;
+        for(y = t_check->index_y1; y <= t_check->index_y2; y++) {
+            for(x = t_check->index_x1; x <= t_check->index_x2; x++) {
+                lv_draw_task_index_node_t * node = index->bins[y * LV_DRAW_TASK_INDEX_GRID + x].head;
+                while(node && node->task->index_seq < t_check->index_seq) {
+                    lv_draw_task_t * t = node->task;
+                    if(t->state != LV_DRAW_TASK_STATE_READY) {
+                        lv_area_t a;
+                        if(lv_area_intersect(&a, &t->_real_area, &t_check->_real_area)) {
+                            LV_PROFILER_DRAW_END;
+                            return false;
+                        }
+                    }
+                    node = node->next;
+                }
+            }
+        }
+        LV_PROFILER_DRAW_END;
+        return true;
+    }
+
     lv_draw_task_t * t = layer->draw_task_head;
 
     /*If t_check is outside of the older tasks then it's independent*/
@@ -626,6 +749,8 @@ static void cleanup_task(lv_draw_task_t * t, lv_display_t * disp)
 
         /*Remove the layer from  the display's*/
         if(disp) {
+            task_index_delete(layer_drawn);
+
             lv_layer_t * l2 = disp->layer_head;
             while(l2) {
                 if(l2->next == layer_drawn) {
@@ -649,10 +774,109 @@ static void cleanup_task(lv_draw_task_t * t, lv_display_t * disp)
         draw_label_dsc->text = NULL;
     }
 
-    lv_free(t);
+    task_free(t);
     LV_PROFILER_DRAW_END;
 }
 
+/**
+ * Allocate a zeroed draw task with its descriptor.
+ * The tasks are cut from chunks in the order they are added and usually cleaned up in the same
+ * order, so a chunk is emptied at once and reused without touching the heap.
+ * @param size      size of the task and its descriptor in bytes
+ * @return          the new task or NULL if out of memory
+ */
+static lv_draw_task_t * task_alloc(size_t size)
+{
+    lv_draw_task_t * t = NULL;
+
+#if LV_DRAW_TASK_POOL_CHUNK_SIZE > 0
+    size = LV_ALIGN_UP(size, 8);
+    lv_draw_task_chunk_t * chunk = _draw_info.task_chunk_act;
+    if(size <= CHUNK_BUF_SIZE && (chunk == NULL || chunk->used + size > CHUNK_BUF_SIZE)) {
+        /*The full chunk is put to the free list by its last task*/
+        chunk = _draw_info.task_chunk_free;
+        if(chunk) {
+            _draw_info.task_chunk_free = chunk->next;
+        }
+        else {
+            chunk = lv_malloc(LV_DRAW_TASK_POOL_CHUNK_SIZE);
+            if(chunk) {
+                chunk->used = 0;
+                chunk->task_cnt = 0;
+                pool_stats.chunk_cnt++;
+                pool_stats.chunk_alloc_cnt++;
+                if(pool_stats.chunk_cnt > pool_stats.chunk_max) pool_stats.chunk_max = pool_stats.chunk_cnt;
+            }
+        }
+        _draw_info.task_chunk_act = chunk;
+    }
+
+    if(size <= CHUNK_BUF_SIZE && chunk) {
+        t = (lv_draw_task_t *)((uint8_t *)chunk + CHUNK_HEADER_SIZE + chunk->used);
+        lv_memzero(t, size);
+        t->chunk = chunk;
+        chunk->used += size;
+        chunk->task_cnt++;
+    }
+#endif
+
+    if(t == NULL) {
+        t = lv_malloc_zeroed(size);
+        if(t == NULL) return NULL;
+        pool_stats.heap_cnt++;
+    }
+
+    pool_stats.task_cnt++;
+    pool_stats.frame_task_cnt++;
+    pool_stats.task_live_cnt++;
+    if(pool_stats.task_live_cnt > pool_stats.task_live_max) pool_stats.task_live_max = pool_stats.task_live_cnt;
+
+    return t;
+}
+
+/**
+ * Free a draw task allocated by `task_alloc`
+ * @param t         pointer to a draw task
+ */
+static void task_free(lv_draw_task_t * t)
+{
+    pool_stats.task_live_cnt--;
+
+#if LV_DRAW_TASK_POOL_CHUNK_SIZE > 0
+    lv_draw_task_chunk_t * chunk = t->chunk;
+    if(chunk) {
+        chunk->task_cnt--;
+        if(chunk->task_cnt > 0) return;
+
+        /*All tasks of the chunk are done: reset it in one step*/
+        chunk->used = 0;
+        if(chunk == _draw_info.task_chunk_act) return;
+
+        chunk->next = _draw_info.task_chunk_free;
+        _draw_info.task_chunk_free = chunk;
+        return;
+    }
+#endif
+
+    lv_free(t);
+}
+
+#if LV_DRAW_TASK_POOL_CHUNK_SIZE > 0
+/**
+ * Free a list of emptied chunks
+ * @param chunk     the first chunk of the list, can be NULL
+ */
+static void chunk_free_list(lv_draw_task_chunk_t * chunk)
+{
+    while(chunk) {
+        lv_draw_task_chunk_t * next = chunk->next;
+        lv_free(chunk);
+        pool_stats.chunk_cnt--;
+        chunk = next;
+    }
+}
+#endif
+
 static lv_draw_task_t * get_first_available_task(lv_layer_t * layer)
 {
     LV_PROFILER_DRAW_BEGIN;
@@ -681,3 +905,151 @@ static lv_draw_task_t * get_first_available_task(lv_layer_t * layer)
     LV_PROFILER_DRAW_END;
     return t;
 }
+
+static lv_draw_task_index_t * task_index_create(lv_layer_t * layer)
+{
+    lv_draw_task_index_t * index = lv_malloc_zeroed(sizeof(lv_draw_task_index_t));
+    LV_ASSERT_MALLOC(index);
+    if(index == NULL) return NULL;
+
+    index->area = layer->buf_area;
+    index->bin_w = LV_MAX(1, (lv_area_get_width(&index->area) + LV_DRAW_TASK_INDEX_GRID - 1) / LV_DRAW_TASK_INDEX_GRID);
+    index->bin_h = LV_MAX(1, (lv_area_get_height(&index->area) + LV_DRAW_TASK_INDEX_GRID - 1) / LV_DRAW_TASK_INDEX_GRID);
+
+    return index;
+}
+
+static void task_index_delete(lv_layer_t * layer)
+{
+    if(layer->task_index == NULL) return;
+
+    /*Normally all the tasks are removed already*/
+    lv_draw_task_t * t = layer->draw_task_head;
+    while(t) {
+        task_index_remove(layer->task_index, t);
+        t = t->next;
+    }
+
+    lv_free(layer->task_index);
+    layer->task_index = NULL;
+}
+
+/**
+ * Add a draw task to the bins covered by its `_real_area`
+ * @param index     the task index of the layer
+ * @param t         the draw task with `index_seq` set
+ */
+static void task_index_insert(lv_draw_task_index_t * index, lv_draw_task_t * t)
+{
+    t->index_x1 = task_index_get_bin(t->_real_area.x1, index->area.x1, index->bin_w);
+    t->index_y1 = task_index_get_bin(t->_real_area.y1, index->area.y1, index->bin_h);
+    t->index_x2 = task_index_get_bin(t->_real_area.x2, index->area.x1, index->bin_w);
+    t->index_y2 = task_index_get_bin(t->_real_area.y2, index->area.y1, index->bin_h);
+
+    uint32_t node_cnt = (t->index_x2 - t->index_x1 + 1) * (t->index_y2 - t->index_y1 + 1);
+    if(node_cnt <= t->index_node_buf_cnt) {
+        t->index_nodes = t->index_node_buf;
+    }
+    else {
+        t->index_nodes = lv_malloc(node_cnt * sizeof(lv_draw_task_index_node_t));
+        LV_ASSERT_MALLOC(t->index_nodes);
+        if(t->index_nodes == NULL) {
+            index->broken = true;
+            return;
+        }
+    }
+
+    lv_draw_task_index_node_t * node = t->index_nodes;
+    uint32_t x, y;
+    for(y = t->index_y1; y <= t->index_y2; y++) {
+        for(x = t->index_x1; x <= t->index_x2; x++) {
+            lv_draw_task_index_bin_t * bin = &index->bins[y * LV_DRAW_TASK_INDEX_GRID + x];
+
+            /*Usually it's the newest task, else find its place from the end*/
+            lv_draw_task_index_node_t * prev = bin->tail;
+            while(prev && prev->task->index_seq > t->index_seq) prev = prev->prev;
+
+            node->task = t;
+            node->prev = prev;
+            node->next = prev ? prev->next : bin->head;
+            if(node->next) node->next->prev = node;
+            else bin->tail = node;
+            if(prev) prev->next = node;
+            else bin->head = node;
+
+            node++;
+        }
+    }
+}
+
+/**
+ * Move a draw task to other bins if its `_real_area` was changed since it was added
+ * @param index     the task index of the layer
+ * @param t         the draw task
+ */
+static void task_index_update(lv_draw_task_index_t * index, lv_draw_task_t * t)
+{
+    if(t->index_nodes &&
+       t->index_x1 == task_index_get_bin(t->_real_area.x1, index->area.x1, index->bin_w) &&
+       t->index_y1 == task_index_get_bin(t->_real_area.y1, index->area.y1, index->bin_h) &&
+       t->index_x2 == task_index_get_bin(t->_real_area.x2, index->area.x1, index->bin_w) &&
+       t->index_y2 == task_index_get_bin(t->_real_area.y2, index->area.y1, index->bin_h)) {
+        return;
+    }
+
+    task_index_remove(index, t);
+    task_index_insert(index, t);
+}
+
+static void task_index_remove(lv_draw_task_index_t * index, lv_draw_task_t * t)
+{
+    if(t->index_nodes == NULL) return;
+
+    lv_draw_task_index_node_t * node = t->index_nodes;
+    uint32_t x, y;
+    for(y = t->index_y1; y <= t->index_y2; y++) {
+        for(x = t->index_x1; x <= t->index_x2; x++) {
+            lv_draw_task_index_bin_t * bin = &index->bins[y * LV_DRAW_TASK_INDEX_GRID + x];
+            if(node->prev) node->prev->next = node->next;
+            else bin->head = node->next;
+            if(node->next) node->next->prev = node->prev;
+            else bin->tail = node->prev;
+
+            node++;
+        }
+    }
+
+    if(t->index_nodes != t->index_node_buf) lv_free(t->index_nodes);
+    t->index_nodes = NULL;
+}
+
+/**
+ * Get the number of bins covered by an area
+ * @param index     the task index of the layer
+ * @param area      an area on the layer
+ * @return          number of bins
+ */
+static uint32_t task_index_get_node_cnt(const lv_draw_task_index_t * index, const lv_area_t * area)
+{
+    int32_t w = task_index_get_bin(area->x2, index->area.x1, index->bin_w) -
+                task_index_get_bin(area->x1, index->area.x1, index->bin_w) + 1;
+    int32_t h = task_index_get_bin(area->y2, index->area.y1, index->bin_h) -
+                task_index_get_bin(area->y1, index->area.y1, index->bin_h) + 1;
+    return w > 0 && h > 0 ? (uint32_t)(w * h) : 0;
+}
+
+/**
+ * Get the bin of a coordinate. It's clamped to the edges so overlapping areas
+ * out of the indexed area still share a bin.
+ * @param coord     an X or Y coordinate
+ * @param start     the first coordinate of the indexed area
+ * @param bin_size  the width or height of a bin
+ * @return          index of the bin in the row or column
+ */
+static uint8_t task_index_get_bin(int32_t coord, int32_t start, int32_t bin_size)
+{
+    if(coord <= start) return 0;
+
+    int32_t bin = (coord - start) / bin_size;
+    return bin < LV_DRAW_TASK_INDEX_GRID ? (uint8_t)bin : LV_DRAW_TASK_INDEX_GRID - 1;
+}
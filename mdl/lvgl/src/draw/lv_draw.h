@@ -115,6 +115,10 @@ struct _lv_layer_t  {
     /** Linked list of draw tasks */
     lv_draw_task_t * draw_task_head;
 
+    /** Bins of the unfinished draw tasks to find the overlapping ones quickly.
+     *  Used only if draw tasks are rendered in parallel.*/
+    lv_draw_task_index_t * task_index;
+
     lv_layer_t * parent;
     lv_layer_t * next;
     bool all_tasks_added;
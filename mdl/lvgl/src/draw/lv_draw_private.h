@@ -26,10 +26,74 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/** The layers are divided into this many bins horizontally and vertically to index the draw tasks*/
+#define LV_DRAW_TASK_INDEX_GRID     8
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/** A draw task in a bin of the layer's task index*/
+typedef struct _lv_draw_task_index_node_t {
+    lv_draw_task_t * task;
+    struct _lv_draw_task_index_node_t * prev;
+    struct _lv_draw_task_index_node_t * next;
+} lv_draw_task_index_node_t;
+
+typedef struct {
+    lv_draw_task_index_node_t * head;
+    lv_draw_task_index_node_t * tail;
+} lv_draw_task_index_bin_t;
+
+/**
+ * The unfinished draw tasks of a layer in the bins their `_real_area` covers, in the order of creation.
+ * An older task overlapping a task has to be in one of the bins of that task.
+ */
+struct _lv_draw_task_index_t {
+    /** The area divided into bins. Areas out of it go to the bins on the edge*/
+    lv_area_t area;
+    int32_t bin_w;
+    int32_t bin_h;
+
+    /** Sequence number of the next draw task*/
+    uint32_t seq;
+
+    /** A draw task couldn't be indexed, check the older tasks one by one until the layer is empty*/
+    bool broken;
+
+    lv_draw_task_index_bin_t bins[LV_DRAW_TASK_INDEX_GRID * LV_DRAW_TASK_INDEX_GRID];
+};
+
+/**
+ * Called when the creation of a draw task is finalized, see `lv_draw_set_record_cb`
+ * @param t         the new draw task, its descriptor is final
+ * @param user_data the `user_data` set with the callback
+ * @return          true: draw the task, false: drop it
+ */
+typedef bool (*lv_draw_record_cb_t)(lv_draw_task_t * t, void * user_data);
+
+#if LV_DRAW_TASK_POOL_CHUNK_SIZE > 0
+/** A block the draw tasks are cut from one after the other, see `LV_DRAW_TASK_POOL_CHUNK_SIZE`*/
+typedef struct _lv_draw_task_chunk_t {
+    struct _lv_draw_task_chunk_t * next;    /**< The next emptied chunk*/
+    uint32_t used;          /**< Bytes cut from the chunk since it was emptied*/
+    uint32_t task_cnt;      /**< Tasks in the chunk which are not cleaned up yet*/
+} lv_draw_task_chunk_t;
+#endif
+
+/** Statistics of allocating the draw tasks*/
+typedef struct {
+    uint32_t task_cnt;          /**< Number of draw tasks added*/
+    uint32_t task_live_cnt;     /**< Number of draw tasks not cleaned up yet*/
+    uint32_t task_live_max;     /**< The most draw tasks which were not cleaned up at the same time*/
+    uint32_t frame_task_cnt;    /**< Number of draw tasks added during the current refresh*/
+    uint32_t frame_task_max;    /**< The most draw tasks added during one refresh*/
+    uint32_t chunk_cnt;         /**< Number of chunks allocated now*/
+    uint32_t chunk_max;         /**< The most chunks allocated at the same time*/
+    uint32_t chunk_alloc_cnt;   /**< Number of times a chunk was allocated from the heap*/
+    uint32_t heap_cnt;          /**< Number of draw tasks allocated from the heap one by one*/
+} lv_draw_task_pool_stats_t;
+
 struct _lv_draw_task_t {
     lv_draw_task_t * next;
 
@@ -81,6 +145,27 @@ struct _lv_draw_task_t {
      */
     uint8_t preference_score;
 
+    /** One node for each bin the task is in, or NULL if the task is not indexed*/
+    lv_draw_task_index_node_t * index_nodes;
+
+    /** Nodes allocated with the task for the bins of the area it was added with, `index_nodes` uses
+     *  them unless the real area covers more bins*/
+    lv_draw_task_index_node_t * index_node_buf;
+    uint8_t index_node_buf_cnt;
+
+    /** Order of creation in the layer's task index*/
+    uint32_t index_seq;
+
+    /** The bins covered by the task*/
+    uint8_t index_x1;
+    uint8_t index_y1;
+    uint8_t index_x2;
+    uint8_t index_y2;
+
+#if LV_DRAW_TASK_POOL_CHUNK_SIZE > 0
+    /** The chunk the task was cut from, or NULL if it was allocated from the heap*/
+    lv_draw_task_chunk_t * chunk;
+#endif
 };
 
 struct _lv_draw_mask_t {
@@ -184,12 +269,44 @@ typedef struct {
 #endif
     lv_mutex_t circle_cache_mutex;
     bool task_running;
+    lv_draw_record_cb_t record_cb;
+    void * record_user_data;
+#if LV_DRAW_TASK_POOL_CHUNK_SIZE > 0
+    lv_draw_task_chunk_t * task_chunk_act;      /**< The new draw tasks are cut from this chunk*/
+    lv_draw_task_chunk_t * task_chunk_free;     /**< List of the emptied chunks kept for the next ones*/
+#endif
+    lv_draw_task_pool_stats_t task_pool_stats;
 } lv_draw_global_info_t;
 
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Get every new draw task before it's passed to the draw units, e.g. to keep a copy of it.
+ * The callback can also change the clip area of the task or drop it.
+ * @param cb        the callback, NULL to stop
+ * @param user_data passed to `cb`
+ */
+void lv_draw_set_record_cb(lv_draw_record_cb_t cb, void * user_data);
+
+/**
+ * Called when a refresh has finished. Free the emptied chunks of the draw tasks except one
+ * and count the draw tasks of the refresh as one frame in the statistics.
+ */
+void lv_draw_task_pool_frame_end(void);
+
+/**
+ * Get the statistics of allocating the draw tasks
+ * @param stats     store the statistics here
+ */
+void lv_draw_task_pool_get_stats(lv_draw_task_pool_stats_t * stats);
+
+/**
+ * Clear the counters of allocating the draw tasks, the tasks and chunks allocated now are kept
+ */
+void lv_draw_task_pool_reset_stats(void);
+
 /**********************
  *      MACROS
  **********************/
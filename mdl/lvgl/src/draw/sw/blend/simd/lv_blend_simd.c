@@ -0,0 +1,485 @@
+/**
+ * @file lv_blend_simd.c
+ *
+ * RGB565 blending with packed integer SIMD: 16 pixels per AVX2 register,
+ * 8 per SSE2 register or 2 per 32 bit register with the DSP extension of
+ * Cortex-M4/M7. The kernels are written once on top of a few primitives
+ * per instruction set.
+ *
+ * Every channel is mixed in its own 16 bit lane as
+ * `bg + ((fg - bg) * mix5 >> 5)` with `mix5 = (mix + 4) >> 3`, which is
+ * what `lv_color_16_16_mix()` computes in one 32 bit word, so the results
+ * are bit exact with the scalar blend.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_blend_simd.h"
+#if LV_BLEND_SIMD
+
+#include "../lv_draw_sw_blend_private.h"
+#include "../../../../misc/lv_color.h"
+
+#if LV_BLEND_SIMD_AVX2
+    #include <immintrin.h>
+#elif LV_BLEND_SIMD_SSE2
+    #include <emmintrin.h>
+#else
+    #include <arm_acle.h>
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#if LV_BLEND_SIMD_AVX2
+    #define VEC_PX      16
+#elif LV_BLEND_SIMD_SSE2
+    #define VEC_PX      8
+#else
+    #define VEC_PX      2
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+#if LV_BLEND_SIMD_AVX2
+    typedef __m256i vec_t;
+#elif LV_BLEND_SIMD_SSE2
+    typedef __m128i vec_t;
+#else
+    typedef uint32_t vec_t;
+#endif
+
+/*Aligned room for the pixels of a partial vector*/
+typedef union {
+    vec_t v;
+    uint16_t px[VEC_PX];
+} vec_px_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static inline int32_t vec_span(const uint16_t * dest, int32_t remaining);
+static inline vec_t vec_load(const uint16_t * p);
+static inline void vec_store(uint16_t * p, vec_t v);
+static inline vec_t vec_load_mask(const lv_opa_t * p);
+static inline vec_t vec_splat(uint16_t v);
+static inline bool vec_all_eq(vec_t v, uint16_t c);
+static inline vec_t vec_mix5(vec_t mix);
+static inline vec_t vec_mask_opa(vec_t mask, lv_opa_t opa);
+static inline vec_t vec_mix(vec_t fg, vec_t bg, vec_t mix5);
+
+static inline vec_t vec_load_n(const uint16_t * p, int32_t n);
+static inline void vec_store_n(uint16_t * p, vec_t v, int32_t n);
+static inline vec_t vec_load_mask_n(const lv_opa_t * p, int32_t n);
+
+static inline void * drawbuf_next_row(const void * buf, uint32_t stride);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_result_t LV_ATTRIBUTE_FAST_MEM lv_color_blend_to_rgb565_with_opa_simd(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    vec_t color = vec_splat(lv_color_to_u16(dsc->color));
+    vec_t mix5 = vec_mix5(vec_splat(dsc->opa));
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        int32_t x;
+        int32_t n;
+        for(x = 0; x < w; x += n) {
+            n = vec_span(&dest_buf_u16[x], w - x);
+            vec_t bg = vec_load_n(&dest_buf_u16[x], n);
+            vec_store_n(&dest_buf_u16[x], vec_mix(color, bg, mix5), n);
+        }
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t LV_ATTRIBUTE_FAST_MEM lv_color_blend_to_rgb565_with_mask_simd(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    vec_t color = vec_splat(lv_color_to_u16(dsc->color));
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        int32_t x;
+        int32_t n;
+        for(x = 0; x < w; x += n) {
+            n = vec_span(&dest_buf_u16[x], w - x);
+            vec_t mask = vec_load_mask_n(&mask_buf[x], n);
+            /*Glyphs and anti-aliased edges are mostly fully covered or empty*/
+            if(vec_all_eq(mask, 0)) continue;
+            if(vec_all_eq(mask, LV_OPA_COVER)) {
+                vec_store_n(&dest_buf_u16[x], color, n);
+                continue;
+            }
+
+            vec_t bg = vec_load_n(&dest_buf_u16[x], n);
+            vec_store_n(&dest_buf_u16[x], vec_mix(color, bg, vec_mix5(mask)), n);
+        }
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        mask_buf += dsc->mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t LV_ATTRIBUTE_FAST_MEM lv_color_blend_to_rgb565_mix_mask_opa_simd(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    lv_opa_t opa = dsc->opa;
+    vec_t color = vec_splat(lv_color_to_u16(dsc->color));
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        int32_t x;
+        int32_t n;
+        for(x = 0; x < w; x += n) {
+            n = vec_span(&dest_buf_u16[x], w - x);
+            vec_t mask = vec_load_mask_n(&mask_buf[x], n);
+            if(vec_all_eq(mask, 0)) continue;
+
+            vec_t bg = vec_load_n(&dest_buf_u16[x], n);
+            vec_store_n(&dest_buf_u16[x], vec_mix(color, bg, vec_mix5(vec_mask_opa(mask, opa))), n);
+        }
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        mask_buf += dsc->mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t LV_ATTRIBUTE_FAST_MEM lv_rgb565_blend_normal_to_rgb565_with_opa_simd(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    /*RGB565_SWAPPED images are passed here too*/
+    if(dsc->src_color_format != LV_COLOR_FORMAT_RGB565) return LV_RESULT_INVALID;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const uint16_t * src_buf_u16 = dsc->src_buf;
+    vec_t mix5 = vec_mix5(vec_splat(dsc->opa));
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        int32_t x;
+        int32_t n;
+        for(x = 0; x < w; x += n) {
+            n = vec_span(&dest_buf_u16[x], w - x);
+            vec_t fg = vec_load_n(&src_buf_u16[x], n);
+            vec_t bg = vec_load_n(&dest_buf_u16[x], n);
+            vec_store_n(&dest_buf_u16[x], vec_mix(fg, bg, mix5), n);
+        }
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        src_buf_u16 = drawbuf_next_row(src_buf_u16, dsc->src_stride);
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t LV_ATTRIBUTE_FAST_MEM lv_rgb565_blend_normal_to_rgb565_with_mask_simd(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(dsc->src_color_format != LV_COLOR_FORMAT_RGB565) return LV_RESULT_INVALID;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const uint16_t * src_buf_u16 = dsc->src_buf;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        int32_t x;
+        int32_t n;
+        for(x = 0; x < w; x += n) {
+            n = vec_span(&dest_buf_u16[x], w - x);
+            vec_t mask = vec_load_mask_n(&mask_buf[x], n);
+            if(vec_all_eq(mask, 0)) continue;
+
+            vec_t fg = vec_load_n(&src_buf_u16[x], n);
+            if(vec_all_eq(mask, LV_OPA_COVER)) {
+                vec_store_n(&dest_buf_u16[x], fg, n);
+                continue;
+            }
+
+            vec_t bg = vec_load_n(&dest_buf_u16[x], n);
+            vec_store_n(&dest_buf_u16[x], vec_mix(fg, bg, vec_mix5(mask)), n);
+        }
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        src_buf_u16 = drawbuf_next_row(src_buf_u16, dsc->src_stride);
+        mask_buf += dsc->mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t LV_ATTRIBUTE_FAST_MEM lv_rgb565_blend_normal_to_rgb565_mix_mask_opa_simd(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(dsc->src_color_format != LV_COLOR_FORMAT_RGB565) return LV_RESULT_INVALID;
+
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const uint16_t * src_buf_u16 = dsc->src_buf;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    lv_opa_t opa = dsc->opa;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        int32_t x;
+        int32_t n;
+        for(x = 0; x < w; x += n) {
+            n = vec_span(&dest_buf_u16[x], w - x);
+            vec_t mask = vec_load_mask_n(&mask_buf[x], n);
+            if(vec_all_eq(mask, 0)) continue;
+
+            vec_t fg = vec_load_n(&src_buf_u16[x], n);
+            vec_t bg = vec_load_n(&dest_buf_u16[x], n);
+            vec_store_n(&dest_buf_u16[x], vec_mix(fg, bg, vec_mix5(vec_mask_opa(mask, opa))), n);
+        }
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        src_buf_u16 = drawbuf_next_row(src_buf_u16, dsc->src_stride);
+        mask_buf += dsc->mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_BLEND_SIMD_AVX2 || LV_BLEND_SIMD_SSE2
+
+#if LV_BLEND_SIMD_AVX2
+    #define vec_set1_16     _mm256_set1_epi16
+    #define vec_and         _mm256_and_si256
+    #define vec_or          _mm256_or_si256
+    #define vec_add16       _mm256_add_epi16
+    #define vec_sub16       _mm256_sub_epi16
+    #define vec_mullo16     _mm256_mullo_epi16
+    #define vec_srli16      _mm256_srli_epi16
+    #define vec_srai16      _mm256_srai_epi16
+    #define vec_slli16      _mm256_slli_epi16
+#else
+    #define vec_set1_16     _mm_set1_epi16
+    #define vec_and         _mm_and_si128
+    #define vec_or          _mm_or_si128
+    #define vec_add16       _mm_add_epi16
+    #define vec_sub16       _mm_sub_epi16
+    #define vec_mullo16     _mm_mullo_epi16
+    #define vec_srli16      _mm_srli_epi16
+    #define vec_srai16      _mm_srai_epi16
+    #define vec_slli16      _mm_slli_epi16
+#endif
+
+/*Unaligned loads are as fast as aligned ones on the same cache line, so simply take full vectors*/
+static inline int32_t vec_span(const uint16_t * dest, int32_t remaining)
+{
+    LV_UNUSED(dest);
+    return remaining < VEC_PX ? remaining : VEC_PX;
+}
+
+static inline vec_t vec_load(const uint16_t * p)
+{
+#if LV_BLEND_SIMD_AVX2
+    return _mm256_loadu_si256((const __m256i *)p);
+#else
+    return _mm_loadu_si128((const __m128i *)p);
+#endif
+}
+
+static inline void vec_store(uint16_t * p, vec_t v)
+{
+#if LV_BLEND_SIMD_AVX2
+    _mm256_storeu_si256((__m256i *)p, v);
+#else
+    _mm_storeu_si128((__m128i *)p, v);
+#endif
+}
+
+static inline vec_t vec_load_mask(const lv_opa_t * p)
+{
+#if LV_BLEND_SIMD_AVX2
+    return _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)p));
+#else
+    return _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)p), _mm_setzero_si128());
+#endif
+}
+
+static inline vec_t vec_splat(uint16_t v)
+{
+    return vec_set1_16((int16_t)v);
+}
+
+static inline bool vec_all_eq(vec_t v, uint16_t c)
+{
+#if LV_BLEND_SIMD_AVX2
+    return _mm256_movemask_epi8(_mm256_cmpeq_epi16(v, vec_splat(c))) == -1;
+#else
+    return _mm_movemask_epi8(_mm_cmpeq_epi16(v, vec_splat(c))) == 0xFFFF;
+#endif
+}
+
+static inline vec_t vec_mix5(vec_t mix)
+{
+    return vec_srli16(vec_add16(mix, vec_set1_16(4)), 3);
+}
+
+/*The product fits in 16 bits unsigned so the low half is enough*/
+static inline vec_t vec_mask_opa(vec_t mask, lv_opa_t opa)
+{
+    return vec_srli16(vec_mullo16(mask, vec_set1_16(opa)), 8);
+}
+
+static inline vec_t vec_mix(vec_t fg, vec_t bg, vec_t mix5)
+{
+    vec_t m5 = vec_set1_16(0x1F);
+    vec_t m6 = vec_set1_16(0x3F);
+
+    vec_t fr = vec_srli16(fg, 11);
+    vec_t br = vec_srli16(bg, 11);
+    vec_t fgr = vec_and(vec_srli16(fg, 5), m6);
+    vec_t bgr = vec_and(vec_srli16(bg, 5), m6);
+    vec_t fb = vec_and(fg, m5);
+    vec_t bb = vec_and(bg, m5);
+
+    /*The difference is in -63..63 so `* 32` still fits, the arithmetic shift floors like the scalar mix*/
+    vec_t r = vec_add16(br, vec_srai16(vec_mullo16(vec_sub16(fr, br), mix5), 5));
+    vec_t g = vec_add16(bgr, vec_srai16(vec_mullo16(vec_sub16(fgr, bgr), mix5), 5));
+    vec_t b = vec_add16(bb, vec_srai16(vec_mullo16(vec_sub16(fb, bb), mix5), 5));
+
+    return vec_or(vec_or(vec_slli16(r, 11), vec_slli16(g, 5)), b);
+}
+
+#else /*LV_BLEND_SIMD_DSP*/
+
+/*Go pixel by pixel until the destination is word aligned, the mask and the source can stay unaligned*/
+static inline int32_t vec_span(const uint16_t * dest, int32_t remaining)
+{
+    if(remaining < VEC_PX || ((lv_uintptr_t)dest & 0x3)) return 1;
+    return VEC_PX;
+}
+
+static inline vec_t vec_load(const uint16_t * p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 16);
+}
+
+static inline void vec_store(uint16_t * p, vec_t v)
+{
+    *(uint32_t *)p = v;
+}
+
+static inline vec_t vec_load_mask(const lv_opa_t * p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 16);
+}
+
+static inline vec_t vec_splat(uint16_t v)
+{
+    return (uint32_t)v * 0x00010001;
+}
+
+static inline bool vec_all_eq(vec_t v, uint16_t c)
+{
+    return v == vec_splat(c);
+}
+
+/*The lanes are at most 259 before the shift, nothing carries over*/
+static inline vec_t vec_mix5(vec_t mix)
+{
+    return ((mix + 0x00040004) >> 3) & 0x003F003F;
+}
+
+/*Both products fit in their 16 bit lane*/
+static inline vec_t vec_mask_opa(vec_t mask, lv_opa_t opa)
+{
+    return ((mask * opa) >> 8) & 0x00FF00FF;
+}
+
+static inline uint32_t lane_mix(uint32_t fg, uint32_t bg, uint32_t mix5)
+{
+    int32_t d = (int32_t)__ssub16((int32_t)fg, (int32_t)bg);
+    uint32_t lo = (uint32_t)(__smulbb(d, (int32_t)mix5) >> 5) & 0xFFFF;
+    uint32_t hi = (uint32_t)(__smultt(d, (int32_t)mix5) >> 5) << 16;
+    return (uint32_t)__sadd16((int32_t)(lo | hi), (int32_t)bg);
+}
+
+static inline vec_t vec_mix(vec_t fg, vec_t bg, vec_t mix5)
+{
+    uint32_t r = lane_mix((fg >> 11) & 0x001F001F, (bg >> 11) & 0x001F001F, mix5);
+    uint32_t g = lane_mix((fg >> 5) & 0x003F003F, (bg >> 5) & 0x003F003F, mix5);
+    uint32_t b = lane_mix(fg & 0x001F001F, bg & 0x001F001F, mix5);
+
+    return (r << 11) | (g << 5) | b;
+}
+
+#endif /*LV_BLEND_SIMD_DSP*/
+
+/*The last pixels of a row go through a zero padded copy*/
+static inline vec_t vec_load_n(const uint16_t * p, int32_t n)
+{
+    if(n == VEC_PX) return vec_load(p);
+
+    vec_px_t tmp = {0};
+    int32_t i;
+    for(i = 0; i < n; i++) tmp.px[i] = p[i];
+    return vec_load(tmp.px);
+}
+
+static inline void vec_store_n(uint16_t * p, vec_t v, int32_t n)
+{
+    if(n == VEC_PX) {
+        vec_store(p, v);
+        return;
+    }
+
+    vec_px_t tmp;
+    vec_store(tmp.px, v);
+    int32_t i;
+    for(i = 0; i < n; i++) p[i] = tmp.px[i];
+}
+
+/*Padding with 0 keeps the padded lanes transparent*/
+static inline vec_t vec_load_mask_n(const lv_opa_t * p, int32_t n)
+{
+    if(n == VEC_PX) return vec_load_mask(p);
+
+    lv_opa_t tmp[16] = {0};
+    int32_t i;
+    for(i = 0; i < n; i++) tmp[i] = p[i];
+    return vec_load_mask(tmp);
+}
+
+static inline void * LV_ATTRIBUTE_FAST_MEM drawbuf_next_row(const void * buf, uint32_t stride)
+{
+    return (void *)((uint8_t *)buf + stride);
+}
+
+#endif /*LV_BLEND_SIMD*/
@@ -0,0 +1,145 @@
+/**
+ * @file lv_blend_simd.h
+ *
+ */
+
+#ifndef LV_BLEND_SIMD_H
+#define LV_BLEND_SIMD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../../../lv_conf_internal.h"
+#include "../../../../misc/lv_types.h"
+
+/* pick the widest instruction set the compiler targets */
+#if defined(__AVX2__)
+#define LV_BLEND_SIMD_AVX2  1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LV_BLEND_SIMD_SSE2  1
+#elif defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP && defined(__ARM_FEATURE_SIMD32) && __ARM_FEATURE_SIMD32
+#define LV_BLEND_SIMD_DSP   1
+#endif
+
+/*The unused instruction sets are 0 so that `#if` works with -Wundef*/
+#ifndef LV_BLEND_SIMD_AVX2
+#define LV_BLEND_SIMD_AVX2  0
+#endif
+#ifndef LV_BLEND_SIMD_SSE2
+#define LV_BLEND_SIMD_SSE2  0
+#endif
+#ifndef LV_BLEND_SIMD_DSP
+#define LV_BLEND_SIMD_DSP   0
+#endif
+
+#if LV_USE_DRAW_SW && LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_SIMD && LV_DRAW_SW_SUPPORT_RGB565 && \
+    (LV_BLEND_SIMD_AVX2 || LV_BLEND_SIMD_SSE2 || LV_BLEND_SIMD_DSP)
+#define LV_BLEND_SIMD       1
+#else
+#define LV_BLEND_SIMD       0
+#endif
+
+#if LV_BLEND_SIMD
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*The plain fill and copy stay scalar, they are already bound by the memory*/
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_OPA(dsc) \
+    lv_color_blend_to_rgb565_with_opa_simd(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_MASK
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_MASK(dsc) \
+    lv_color_blend_to_rgb565_with_mask_simd(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB565_MIX_MASK_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_MIX_MASK_OPA(dsc) \
+    lv_color_blend_to_rgb565_mix_mask_opa_simd(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_OPA
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)  \
+    lv_rgb565_blend_normal_to_rgb565_with_opa_simd(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_MASK
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)  \
+    lv_rgb565_blend_normal_to_rgb565_with_mask_simd(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)  \
+    lv_rgb565_blend_normal_to_rgb565_mix_mask_opa_simd(dsc)
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Mix a color to an RGB565 area with `dsc->opa`
+ * @param dsc       the fill descriptor
+ * @return          LV_RESULT_OK: filled
+ */
+lv_result_t lv_color_blend_to_rgb565_with_opa_simd(lv_draw_sw_blend_fill_dsc_t * dsc);
+
+/**
+ * Mix a color to an RGB565 area through an A8 mask, e.g. a glyph
+ * @param dsc       the fill descriptor
+ * @return          LV_RESULT_OK: filled
+ */
+lv_result_t lv_color_blend_to_rgb565_with_mask_simd(lv_draw_sw_blend_fill_dsc_t * dsc);
+
+/**
+ * Mix a color to an RGB565 area through an A8 mask and with `dsc->opa`
+ * @param dsc       the fill descriptor
+ * @return          LV_RESULT_OK: filled
+ */
+lv_result_t lv_color_blend_to_rgb565_mix_mask_opa_simd(lv_draw_sw_blend_fill_dsc_t * dsc);
+
+/**
+ * Mix an RGB565 image to an RGB565 area with `dsc->opa`
+ * @param dsc       the image descriptor
+ * @return          LV_RESULT_OK: blended, LV_RESULT_INVALID: the source is not RGB565
+ */
+lv_result_t lv_rgb565_blend_normal_to_rgb565_with_opa_simd(lv_draw_sw_blend_image_dsc_t * dsc);
+
+/**
+ * Mix an RGB565 image to an RGB565 area through an A8 mask
+ * @param dsc       the image descriptor
+ * @return          LV_RESULT_OK: blended, LV_RESULT_INVALID: the source is not RGB565
+ */
+lv_result_t lv_rgb565_blend_normal_to_rgb565_with_mask_simd(lv_draw_sw_blend_image_dsc_t * dsc);
+
+/**
+ * Mix an RGB565 image to an RGB565 area through an A8 mask and with `dsc->opa`
+ * @param dsc       the image descriptor
+ * @return          LV_RESULT_OK: blended, LV_RESULT_INVALID: the source is not RGB565
+ */
+lv_result_t lv_rgb565_blend_normal_to_rgb565_mix_mask_opa_simd(lv_draw_sw_blend_image_dsc_t * dsc);
+
+#endif /*LV_BLEND_SIMD*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_BLEND_SIMD_H*/
@@ -137,6 +137,9 @@ void lv_binfont_destroy(lv_font_t * font)
     const lv_font_fmt_txt_dsc_t * dsc = font->dsc;
     if(dsc == NULL) return;
 
+    /*A new font might be loaded to the same address*/
+    if(dsc->cmaps != NULL) lv_font_fmt_txt_cache_drop(font);
+
     if(dsc->kern_classes == 0) {
         const lv_font_fmt_txt_kern_pair_t * kern_dsc = dsc->kern_dsc;
         if(NULL != kern_dsc) {
@@ -166,6 +169,7 @@ void lv_binfont_destroy(lv_font_t * font)
 
     lv_free((void *)dsc->glyph_bitmap);
     lv_free((void *)dsc->glyph_dsc);
+    lv_free(dsc->cache);
     lv_free((void *)dsc);
     lv_free(font);
 }
@@ -481,6 +485,8 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
 
     font->dsc = font_dsc;
 
+    font_dsc->cache = lv_malloc_zeroed(sizeof(lv_font_fmt_txt_glyph_cache_t));
+
     /*header*/
     int32_t header_length = read_label(fp, 0, "head");
     if(header_length < 0) {
@@ -14,6 +14,8 @@
 #include "../misc/lv_log.h"
 #include "../misc/lv_utils.h"
 #include "../stdlib/lv_mem.h"
+#include "../misc/cache/lv_cache.h"
+#include "../draw/lv_draw_buf_private.h"
 
 /*********************
  *      DEFINES
@@ -22,6 +24,21 @@
     #define font_rle LV_GLOBAL_DEFAULT()->font_fmt_rle
 #endif /*LV_USE_FONT_COMPRESSED*/
 
+#define bitmap_cache_p (LV_GLOBAL_DEFAULT()->font_fmt_txt_cache)
+#define bitmap_cache_stats (LV_GLOBAL_DEFAULT()->font_fmt_txt_cache_stats)
+#define font_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->font_draw_buf_handlers)
+
+#define CACHE_NAME  "FONT_FMT_TXT"
+
+/*Glyph ID cache entries keep the glyph ID in 16 bits and the rest of the letter in the other 16*/
+#define GLYPH_ID_CACHE_MASK     (LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE - 1)
+#define GLYPH_ID_CACHE_MAX_GID  0xFFFF
+#define GLYPH_ID_CACHE_MAX_CHAR 0x10FFFF
+
+#if LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE < 32 || (LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE & GLYPH_ID_CACHE_MASK)
+    #error "LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE must be a power of 2 and at least 32"
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -30,10 +47,24 @@ typedef struct {
     uint32_t gid_right;
 } kern_pair_ref_t;
 
+typedef struct {
+    lv_cache_slot_size_t slot;
+    const lv_font_fmt_txt_dsc_t * fdsc;
+    uint32_t gid;
+    lv_draw_buf_t * draw_buf;
+} bitmap_cache_data_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter);
+static uint32_t find_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter);
+static bool decode_bitmap(const lv_font_fmt_txt_dsc_t * fdsc, const lv_font_fmt_txt_glyph_dsc_t * gdsc,
+                          uint16_t stride_in, uint8_t * bitmap_out);
+static const void * get_cached_bitmap(lv_font_glyph_dsc_t * g_dsc, const lv_font_fmt_txt_dsc_t * fdsc, uint32_t gid);
+static bool bitmap_cache_create_cb(bitmap_cache_data_t * node, void * user_data);
+static void bitmap_cache_free_cb(bitmap_cache_data_t * node, void * user_data);
+static lv_cache_compare_res_t bitmap_cache_compare_cb(const bitmap_cache_data_t * lhs, const bitmap_cache_data_t * rhs);
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right);
 static int unicode_list_compare(const void * ref, const void * element);
 static int kern_pair_8_compare(const void * ref, const void * element);
@@ -99,12 +130,252 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
 
     if(g_dsc->req_raw_bitmap) return &fdsc->glyph_bitmap[gdsc->bitmap_index];
 
-    uint8_t * bitmap_out = draw_buf->data;
     int32_t gsize = (int32_t) gdsc->box_w * gdsc->box_h;
     if(gsize == 0) return NULL;
 
-    uint16_t stride_in = g_dsc->stride;
+    /*Decode the glyph only once while it's cached*/
+    if(bitmap_cache_p && lv_cache_is_enabled(bitmap_cache_p)) {
+        const void * cached = get_cached_bitmap(g_dsc, fdsc, gid);
+        if(cached) return cached;
+    }
+
+    if(decode_bitmap(fdsc, gdsc, g_dsc->stride, draw_buf->data)) {
+        lv_draw_buf_flush_cache(draw_buf, NULL);
+        return draw_buf;
+    }
+
+    /*If not returned earlier then the letter is not found in this font*/
+    return NULL;
+}
+
+bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
+                                   uint32_t unicode_letter_next)
+{
+    /*It fixes a strange compiler optimization issue: https://github.com/lvgl/lvgl/issues/4370*/
+    bool is_tab = unicode_letter == '\t';
+    if(is_tab) {
+        unicode_letter = ' ';
+    }
+    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    uint32_t gid = get_glyph_dsc_id(font, unicode_letter);
+    if(!gid) return false;
+
+    int8_t kvalue = 0;
+    if(fdsc->kern_dsc) {
+        uint32_t gid_next = get_glyph_dsc_id(font, unicode_letter_next);
+        if(gid_next) {
+            kvalue = get_kern_value(font, gid, gid_next);
+        }
+    }
+
+    /*Put together a glyph dsc*/
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
+
+    int32_t kv = ((int32_t)((int32_t)kvalue * fdsc->kern_scale) >> 4);
+
+    uint32_t adv_w = gdsc->adv_w;
+    if(is_tab) adv_w *= 2;
+
+    adv_w += kv;
+    adv_w  = (adv_w + (1 << 3)) >> 4;
+
+    dsc_out->adv_w = adv_w;
+    dsc_out->box_h = gdsc->box_h;
+    dsc_out->box_w = gdsc->box_w;
+    dsc_out->ofs_x = gdsc->ofs_x;
+    dsc_out->ofs_y = gdsc->ofs_y;
+
+    if(fdsc->stride == 0) dsc_out->stride = 0;
+    else {
+        /*e.g. font_dsc stride ==  4 means align to 4 byte boundary.
+         *In glyph_dsc store the actual line length in bytes*/
+        dsc_out->stride = LV_ROUND_UP(dsc_out->box_w, fdsc->stride);
+    }
+
+    dsc_out->format = (uint8_t)fdsc->bpp;
+    dsc_out->is_placeholder = false;
+    dsc_out->gid.index = gid;
+
+    if(is_tab) dsc_out->box_w = dsc_out->box_w * 2;
+
+    return true;
+}
+
+void lv_font_release_glyph_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * g_dsc)
+{
+    LV_UNUSED(font);
+
+    if(g_dsc->entry == NULL) return;
+
+    lv_cache_release(bitmap_cache_p, g_dsc->entry, NULL);
+    g_dsc->entry = NULL;
+}
+
+lv_result_t lv_font_fmt_txt_cache_init(uint32_t size)
+{
+    if(bitmap_cache_p != NULL) {
+        return LV_RESULT_OK;
+    }
+
+    bitmap_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+    sizeof(bitmap_cache_data_t), size, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) bitmap_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t) bitmap_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t) bitmap_cache_free_cb,
+    });
+
+    lv_cache_set_name(bitmap_cache_p, CACHE_NAME);
+    return bitmap_cache_p != NULL ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
+void lv_font_fmt_txt_cache_deinit(void)
+{
+    if(bitmap_cache_p == NULL) return;
+
+    lv_cache_destroy(bitmap_cache_p, NULL);
+    bitmap_cache_p = NULL;
+}
+
+void lv_font_fmt_txt_cache_resize(uint32_t new_size, bool evict_now)
+{
+    if(bitmap_cache_p == NULL) return;
+
+    lv_cache_set_max_size(bitmap_cache_p, new_size, NULL);
+    if(evict_now) {
+        lv_cache_reserve(bitmap_cache_p, new_size, NULL);
+    }
+}
+
+void lv_font_fmt_txt_cache_drop(const lv_font_t * font)
+{
+    if(bitmap_cache_p == NULL) return;
+
+    if(font == NULL) {
+        lv_cache_drop_all(bitmap_cache_p, NULL);
+        return;
+    }
+
+    /*Glyphs are keyed by font and ID, drop the IDs of the font one by one*/
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+    uint32_t glyph_cnt = 0;
+    uint16_t i;
+    for(i = 0; i < fdsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t * cmap = &fdsc->cmaps[i];
+        uint32_t end = cmap->glyph_id_start + (cmap->list_length ? cmap->list_length : cmap->range_length);
+        if(end > glyph_cnt) glyph_cnt = end;
+    }
+
+    bitmap_cache_data_t search_key = {
+        .fdsc = fdsc,
+    };
+    for(search_key.gid = 1; search_key.gid < glyph_cnt; search_key.gid++) {
+        lv_cache_drop(bitmap_cache_p, &search_key, NULL);
+    }
+}
+
+void lv_font_fmt_txt_cache_get_stats(lv_font_fmt_txt_cache_stats_t * stats)
+{
+    LV_ASSERT_NULL(stats);
+
+    *stats = bitmap_cache_stats;
+    stats->size = bitmap_cache_p ? (uint32_t)lv_cache_get_size(bitmap_cache_p, NULL) : 0;
+    stats->max_size = bitmap_cache_p ? (uint32_t)lv_cache_get_max_size(bitmap_cache_p, NULL) : 0;
+}
+
+void lv_font_fmt_txt_cache_reset_stats(void)
+{
+    bitmap_cache_stats.hit_cnt = 0;
+    bitmap_cache_stats.miss_cnt = 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
+{
+    if(letter == '\0') return 0;
+
+    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    lv_font_fmt_txt_glyph_cache_t * cache = fdsc->cache;
+    if(cache == NULL || letter > GLYPH_ID_CACHE_MAX_CHAR) return find_glyph_dsc_id(fdsc, letter);
+
+    /*Read and write the entry in one go as other threads might use it too*/
+    uint32_t tag = (letter / LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE + 1) << 16;
+    uint32_t entry = cache->entries[letter & GLYPH_ID_CACHE_MASK];
+    if((entry & 0xFFFF0000) == tag) {
+        cache->hit_cnt++;
+        return entry & 0xFFFF;
+    }
+
+    cache->miss_cnt++;
+    uint32_t glyph_id = find_glyph_dsc_id(fdsc, letter);
+    /*Missing letters are cached too as they are looked up in every fallback font*/
+    if(glyph_id <= GLYPH_ID_CACHE_MAX_GID) cache->entries[letter & GLYPH_ID_CACHE_MASK] = tag | glyph_id;
+
+    return glyph_id;
+}
+
+static uint32_t find_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter)
+{
+    uint16_t i;
+    for(i = 0; i < fdsc->cmap_num; i++) {
+
+        /*Relative code point*/
+        uint32_t rcp = letter - fdsc->cmaps[i].range_start;
+        if(rcp >= fdsc->cmaps[i].range_length) continue;
+        uint32_t glyph_id = 0;
+        if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY) {
+            glyph_id = fdsc->cmaps[i].glyph_id_start + rcp;
+        }
+        else if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL) {
+            const uint8_t * gid_ofs_8 = fdsc->cmaps[i].glyph_id_ofs_list;
+            /* The first character is always valid and should have offset = 0
+             * However if a character is missing it also has offset=0.
+             * So if there is a 0 not on the first position then it's a missing character */
+            if(gid_ofs_8[rcp] == 0 && letter != fdsc->cmaps[i].range_start) continue;
+            glyph_id = fdsc->cmaps[i].glyph_id_start + gid_ofs_8[rcp];
+        }
+        else if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY) {
+            uint16_t key = rcp;
+            uint16_t * p = lv_utils_bsearch(&key, fdsc->cmaps[i].unicode_list, fdsc->cmaps[i].list_length,
+                                            sizeof(fdsc->cmaps[i].unicode_list[0]), unicode_list_compare);
+
+            if(p) {
+                lv_uintptr_t ofs = p - fdsc->cmaps[i].unicode_list;
+                glyph_id = fdsc->cmaps[i].glyph_id_start + (uint32_t) ofs;
+            }
+        }
+        else if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL) {
+            uint16_t key = rcp;
+            uint16_t * p = lv_utils_bsearch(&key, fdsc->cmaps[i].unicode_list, fdsc->cmaps[i].list_length,
+                                            sizeof(fdsc->cmaps[i].unicode_list[0]), unicode_list_compare);
 
+            if(p) {
+                lv_uintptr_t ofs = p - fdsc->cmaps[i].unicode_list;
+                const uint16_t * gid_ofs_16 = fdsc->cmaps[i].glyph_id_ofs_list;
+                glyph_id = fdsc->cmaps[i].glyph_id_start + gid_ofs_16[ofs];
+            }
+        }
+
+        return glyph_id;
+    }
+
+    return 0;
+
+}
+
+/**
+ * Decode the bitmap of a glyph to A8
+ * @param fdsc          the font's descriptor
+ * @param gdsc          the glyph's descriptor
+ * @param stride_in     bytes in a line of the glyph's bitmap in the font, 0: no padding
+ * @param bitmap_out    store the A8 bitmap here with `lv_draw_buf_width_to_stride` aligned lines
+ * @return              true: the bitmap is decoded
+ */
+static bool decode_bitmap(const lv_font_fmt_txt_dsc_t * fdsc, const lv_font_fmt_txt_glyph_dsc_t * gdsc,
+                          uint16_t stride_in, uint8_t * bitmap_out)
+{
     if(fdsc->bitmap_format == LV_FONT_FMT_TXT_PLAIN) {
         const uint8_t * bitmap_in = &fdsc->glyph_bitmap[gdsc->bitmap_index];
         uint8_t * bitmap_out_tmp = bitmap_out;
@@ -197,8 +468,7 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
             }
         }
 
-        lv_draw_buf_flush_cache(draw_buf, NULL);
-        return draw_buf;
+        return true;
     }
     /*Handle compressed bitmap*/
     else {
@@ -206,126 +476,79 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
         bool prefilter = fdsc->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED;
         decompress(&fdsc->glyph_bitmap[gdsc->bitmap_index], bitmap_out, gdsc->box_w, gdsc->box_h,
                    (uint8_t)fdsc->bpp, prefilter);
-        lv_draw_buf_flush_cache(draw_buf, NULL);
-        return draw_buf;
+        return true;
 #else /*!LV_USE_FONT_COMPRESSED*/
         LV_LOG_WARN("Compressed fonts is used but LV_USE_FONT_COMPRESSED is not enabled in lv_conf.h");
-        return NULL;
+        return false;
 #endif
     }
-
-    /*If not returned earlier then the letter is not found in this font*/
-    return NULL;
 }
 
-bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
-                                   uint32_t unicode_letter_next)
+static const void * get_cached_bitmap(lv_font_glyph_dsc_t * g_dsc, const lv_font_fmt_txt_dsc_t * fdsc, uint32_t gid)
 {
-    /*It fixes a strange compiler optimization issue: https://github.com/lvgl/lvgl/issues/4370*/
-    bool is_tab = unicode_letter == '\t';
-    if(is_tab) {
-        unicode_letter = ' ';
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
+    bitmap_cache_data_t search_key = {
+        .fdsc = fdsc,
+        .gid = gid,
+    };
+    search_key.slot.size = lv_draw_buf_width_to_stride(gdsc->box_w, LV_COLOR_FORMAT_A8) * gdsc->box_h;
+
+    lv_cache_entry_t * entry = lv_cache_acquire(bitmap_cache_p, &search_key, NULL);
+    if(entry) {
+        bitmap_cache_stats.hit_cnt++;
     }
-    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
-    uint32_t gid = get_glyph_dsc_id(font, unicode_letter);
-    if(!gid) return false;
-
-    int8_t kvalue = 0;
-    if(fdsc->kern_dsc) {
-        uint32_t gid_next = get_glyph_dsc_id(font, unicode_letter_next);
-        if(gid_next) {
-            kvalue = get_kern_value(font, gid, gid_next);
-        }
+    else {
+        bitmap_cache_stats.miss_cnt++;
+        entry = lv_cache_acquire_or_create(bitmap_cache_p, &search_key, NULL);
+        if(entry == NULL) return NULL;
     }
 
-    /*Put together a glyph dsc*/
-    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
-
-    int32_t kv = ((int32_t)((int32_t)kvalue * fdsc->kern_scale) >> 4);
+    g_dsc->entry = entry;
+    bitmap_cache_data_t * cached_data = lv_cache_entry_get_data(entry);
+    return cached_data->draw_buf;
+}
 
-    uint32_t adv_w = gdsc->adv_w;
-    if(is_tab) adv_w *= 2;
+static bool bitmap_cache_create_cb(bitmap_cache_data_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
 
-    adv_w += kv;
-    adv_w  = (adv_w + (1 << 3)) >> 4;
+    const lv_font_fmt_txt_dsc_t * fdsc = node->fdsc;
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[node->gid];
+    uint16_t stride_in = fdsc->stride ? LV_ROUND_UP(gdsc->box_w, fdsc->stride) : 0;
 
-    dsc_out->adv_w = adv_w;
-    dsc_out->box_h = gdsc->box_h;
-    dsc_out->box_w = gdsc->box_w;
-    dsc_out->ofs_x = gdsc->ofs_x;
-    dsc_out->ofs_y = gdsc->ofs_y;
+    lv_draw_buf_t * draw_buf = lv_draw_buf_create_ex(font_draw_buf_handlers, gdsc->box_w, gdsc->box_h,
+                                                     LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+    if(draw_buf == NULL) return false;
 
-    if(fdsc->stride == 0) dsc_out->stride = 0;
-    else {
-        /*e.g. font_dsc stride ==  4 means align to 4 byte boundary.
-         *In glyph_dsc store the actual line length in bytes*/
-        dsc_out->stride = LV_ROUND_UP(dsc_out->box_w, fdsc->stride);
+    /*Runs with the cache locked, so the shared RLE state of compressed fonts is safe too*/
+    if(!decode_bitmap(fdsc, gdsc, stride_in, draw_buf->data)) {
+        lv_draw_buf_destroy(draw_buf);
+        return false;
     }
 
-    dsc_out->format = (uint8_t)fdsc->bpp;
-    dsc_out->is_placeholder = false;
-    dsc_out->gid.index = gid;
-
-    if(is_tab) dsc_out->box_w = dsc_out->box_w * 2;
-
+    lv_draw_buf_flush_cache(draw_buf, NULL);
+    node->draw_buf = draw_buf;
     return true;
 }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
-
-static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
+static void bitmap_cache_free_cb(bitmap_cache_data_t * node, void * user_data)
 {
-    if(letter == '\0') return 0;
-
-    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    LV_UNUSED(user_data);
 
-    uint16_t i;
-    for(i = 0; i < fdsc->cmap_num; i++) {
-
-        /*Relative code point*/
-        uint32_t rcp = letter - fdsc->cmaps[i].range_start;
-        if(rcp >= fdsc->cmaps[i].range_length) continue;
-        uint32_t glyph_id = 0;
-        if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY) {
-            glyph_id = fdsc->cmaps[i].glyph_id_start + rcp;
-        }
-        else if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL) {
-            const uint8_t * gid_ofs_8 = fdsc->cmaps[i].glyph_id_ofs_list;
-            /* The first character is always valid and should have offset = 0
-             * However if a character is missing it also has offset=0.
-             * So if there is a 0 not on the first position then it's a missing character */
-            if(gid_ofs_8[rcp] == 0 && letter != fdsc->cmaps[i].range_start) continue;
-            glyph_id = fdsc->cmaps[i].glyph_id_start + gid_ofs_8[rcp];
-        }
-        else if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY) {
-            uint16_t key = rcp;
-            uint16_t * p = lv_utils_bsearch(&key, fdsc->cmaps[i].unicode_list, fdsc->cmaps[i].list_length,
-                                            sizeof(fdsc->cmaps[i].unicode_list[0]), unicode_list_compare);
-
-            if(p) {
-                lv_uintptr_t ofs = p - fdsc->cmaps[i].unicode_list;
-                glyph_id = fdsc->cmaps[i].glyph_id_start + (uint32_t) ofs;
-            }
-        }
-        else if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL) {
-            uint16_t key = rcp;
-            uint16_t * p = lv_utils_bsearch(&key, fdsc->cmaps[i].unicode_list, fdsc->cmaps[i].list_length,
-                                            sizeof(fdsc->cmaps[i].unicode_list[0]), unicode_list_compare);
+    lv_draw_buf_destroy(node->draw_buf);
+}
 
-            if(p) {
-                lv_uintptr_t ofs = p - fdsc->cmaps[i].unicode_list;
-                const uint16_t * gid_ofs_16 = fdsc->cmaps[i].glyph_id_ofs_list;
-                glyph_id = fdsc->cmaps[i].glyph_id_start + gid_ofs_16[ofs];
-            }
-        }
+static lv_cache_compare_res_t bitmap_cache_compare_cb(const bitmap_cache_data_t * lhs, const bitmap_cache_data_t * rhs)
+{
+    if(lhs->fdsc != rhs->fdsc) {
+        return lhs->fdsc > rhs->fdsc ? 1 : -1;
+    }
 
-        return glyph_id;
+    if(lhs->gid != rhs->gid) {
+        return lhs->gid > rhs->gid ? 1 : -1;
     }
 
     return 0;
-
 }
 
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right)
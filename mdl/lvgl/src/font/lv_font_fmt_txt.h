@@ -147,6 +147,25 @@ typedef enum {
     LV_FONT_FMT_TXT_COMPRESSED_NO_PREFILTER = 2,
 } lv_font_fmt_txt_bitmap_format_t;
 
+/**
+ * Glyph IDs of the recently used letters of a font, indexed by the low bits of the letter.
+ * An entry is `(letter / LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE + 1) << 16 | glyph_id`, 0 if empty.
+ * The entries are single words so the render threads can use it without locking.
+ */
+typedef struct {
+    uint32_t entries[LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE];
+    uint32_t hit_cnt;   /**< Number of letters found in the cache. Not exact if more threads use the font*/
+    uint32_t miss_cnt;  /**< Number of letters searched in the cmaps*/
+} lv_font_fmt_txt_glyph_cache_t;
+
+/** Statistics of the decoded bitmap cache of the built-in fonts*/
+typedef struct {
+    uint32_t hit_cnt;       /**< Number of bitmaps found in the cache*/
+    uint32_t miss_cnt;      /**< Number of bitmaps decoded*/
+    uint32_t size;          /**< Bytes used by the cached bitmaps*/
+    uint32_t max_size;      /**< The byte budget of the cache*/
+} lv_font_fmt_txt_cache_stats_t;
+
 /** Describe store for additional data for fonts */
 typedef struct {
     /** The bitmaps of all glyphs */
@@ -191,6 +210,9 @@ typedef struct {
      * 4, 8, 16, 32, 64: each line is padded to the given byte boundaries
      */
     uint8_t stride;
+
+    /** Cache of the glyph IDs. Optional, NULL: search the cmaps for every letter*/
+    lv_font_fmt_txt_glyph_cache_t * cache;
 } lv_font_fmt_txt_dsc_t;
 
 typedef struct {
@@ -224,6 +246,39 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
 bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
                                    uint32_t unicode_letter_next);
 
+/**
+ * Used as `release_glyph` callback in lvgl's native font format.
+ * Releases the cached bitmap returned by `lv_font_get_bitmap_fmt_txt`.
+ * Called for the built-in fonts even if they don't set `release_glyph`.
+ * @param font      pointer to font
+ * @param g_dsc     the glyph descriptor whose bitmap was used
+ */
+void lv_font_release_glyph_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * g_dsc);
+
+/**
+ * Change the byte budget of the decoded bitmap cache of the built-in fonts.
+ * @param new_size  the new size in bytes, 0 disables the cache
+ * @param evict_now true: evict the bitmaps above the new size immediately
+ */
+void lv_font_fmt_txt_cache_resize(uint32_t new_size, bool evict_now);
+
+/**
+ * Drop the decoded bitmaps of a font from the cache
+ * @param font      pointer to a built-in font, NULL to drop all the bitmaps
+ */
+void lv_font_fmt_txt_cache_drop(const lv_font_t * font);
+
+/**
+ * Get the hit/miss counters and the size of the decoded bitmap cache of the built-in fonts
+ * @param stats     store the statistics here
+ */
+void lv_font_fmt_txt_cache_get_stats(lv_font_fmt_txt_cache_stats_t * stats);
+
+/**
+ * Clear the hit/miss counters of the decoded bitmap cache
+ */
+void lv_font_fmt_txt_cache_reset_stats(void);
+
 /**********************
  *      MACROS
  **********************/
@@ -45,6 +45,18 @@ typedef struct {
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Create the decoded bitmap cache of the built-in fonts
+ * @param size      byte budget of the cache, 0: disabled until resized
+ * @return          LV_RESULT_OK: the cache is created
+ */
+lv_result_t lv_font_fmt_txt_cache_init(uint32_t size);
+
+/**
+ * Delete the decoded bitmap cache of the built-in fonts
+ */
+void lv_font_fmt_txt_cache_deinit(void);
+
 /**********************
  *      MACROS
  **********************/
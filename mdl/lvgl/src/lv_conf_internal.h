@@ -28,6 +28,7 @@
 #define LV_DRAW_SW_ASM_NONE         0
 #define LV_DRAW_SW_ASM_NEON         1
 #define LV_DRAW_SW_ASM_HELIUM       2
+#define LV_DRAW_SW_ASM_SIMD         3
 #define LV_DRAW_SW_ASM_CUSTOM       255
 
 #define LV_NEMA_HAL_CUSTOM          0
@@ -366,6 +367,18 @@
     #endif
 #endif
 
+/** Cut the draw tasks and their descriptors from chunks of this many bytes instead of
+ *  allocating each from the heap. A chunk is reused once all of its tasks are done,
+ *  the emptied chunks but one are freed after each refresh.
+ *  0: allocate every task from the heap */
+#ifndef LV_DRAW_TASK_POOL_CHUNK_SIZE
+    #ifdef CONFIG_LV_DRAW_TASK_POOL_CHUNK_SIZE
+        #define LV_DRAW_TASK_POOL_CHUNK_SIZE CONFIG_LV_DRAW_TASK_POOL_CHUNK_SIZE
+    #else
+        #define LV_DRAW_TASK_POOL_CHUNK_SIZE 0 /**< [bytes]*/
+    #endif
+#endif
+
 /** Stack size of drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -615,6 +628,12 @@
         #endif
     #endif
 
+    /** Accelerate the software blend functions:
+     *  - LV_DRAW_SW_ASM_NONE:   plain C
+     *  - LV_DRAW_SW_ASM_NEON:   NEON assembly of Cortex-A
+     *  - LV_DRAW_SW_ASM_HELIUM: Helium assembly of Cortex-M55/M85
+     *  - LV_DRAW_SW_ASM_SIMD:   RGB565 blending with opacity or masks with SSE2/AVX2 on x86 or the DSP extension of Cortex-M4/M7
+     *  - LV_DRAW_SW_ASM_CUSTOM: include LV_DRAW_SW_ASM_CUSTOM_INCLUDE */
     #ifndef LV_USE_DRAW_SW_ASM
         #ifdef CONFIG_LV_USE_DRAW_SW_ASM
             #define LV_USE_DRAW_SW_ASM CONFIG_LV_USE_DRAW_SW_ASM
@@ -1355,6 +1374,40 @@
     #endif
 #endif
 
+/** Cache the resolved style properties of each object part in its current state.
+ *  A cached part takes about 4 bytes for each built-in property (~600 bytes).
+ *  Maximum bytes used by all objects, the other objects look up their styles as usual. 0: disable */
+#ifndef LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+    #ifdef CONFIG_LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+        #define LV_OBJ_STYLE_RESOLVED_CACHE_SIZE CONFIG_LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+    #else
+        #define LV_OBJ_STYLE_RESOLVED_CACHE_SIZE 0
+    #endif
+#endif
+
+/** Keep the rendered image of the objects having `LV_OBJ_FLAG_CACHE_BITMAP` and draw that until they or their children change.
+ *  Objects not covering their area (e.g. rounded corners) need `LV_DRAW_SW_SUPPORT_ARGB8888`, else they are drawn as usual.
+ *  Maximum bytes used by the cached images, the images count in the heap of LVGL. 0: disable */
+#ifndef LV_OBJ_BITMAP_CACHE_SIZE
+    #ifdef CONFIG_LV_OBJ_BITMAP_CACHE_SIZE
+        #define LV_OBJ_BITMAP_CACHE_SIZE CONFIG_LV_OBJ_BITMAP_CACHE_SIZE
+    #else
+        #define LV_OBJ_BITMAP_CACHE_SIZE 0
+    #endif
+#endif
+
+/** Keep the draw tasks created by `LV_EVENT_DRAW_MAIN` of each object and add copies of them
+ *  instead of sending the event again until the object is invalidated. Objects sending
+ *  `LV_EVENT_DRAW_TASK_ADDED` or drawing layers or masks are drawn as usual.
+ *  Maximum bytes used by the kept draw tasks of all objects, the other objects are drawn as usual. 0: disable */
+#ifndef LV_OBJ_RETAINED_DRAW_SIZE
+    #ifdef CONFIG_LV_OBJ_RETAINED_DRAW_SIZE
+        #define LV_OBJ_RETAINED_DRAW_SIZE CONFIG_LV_OBJ_RETAINED_DRAW_SIZE
+    #else
+        #define LV_OBJ_RETAINED_DRAW_SIZE 0
+    #endif
+#endif
+
 /** Add `id` field to `lv_obj_t` */
 #ifndef LV_USE_OBJ_ID
     #ifdef CONFIG_LV_USE_OBJ_ID
@@ -1906,6 +1959,27 @@
     #endif
 #endif
 
+/** Cache the glyph IDs of the last looked up letters in fonts having a `cache` (e.g. the built-in CJK fonts).
+ *  Number of entries per font, a power of 2, at least 32. */
+#ifndef LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE
+    #ifdef CONFIG_LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE
+        #define LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE CONFIG_LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE
+    #else
+        #define LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE 256
+    #endif
+#endif
+
+/** Keep decoded glyph bitmaps of built-in and binary fonts in a shared cache of this many bytes.
+ *  Saves decoding the same glyphs again in every frame, useful for large and compressed fonts.
+ *  0: disable the cache. */
+#ifndef LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE
+    #ifdef CONFIG_LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE
+        #define LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE CONFIG_LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE
+    #else
+        #define LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE 0
+    #endif
+#endif
+
 /** Enable drawing placeholders when glyph dsc is not found. */
 #ifndef LV_USE_FONT_PLACEHOLDER
     #ifdef LV_KCONFIG_PRESENT
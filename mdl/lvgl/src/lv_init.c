@@ -11,6 +11,9 @@
 #include "misc/lv_anim_private.h"
 #include "draw/lv_image_decoder_private.h"
 #include "draw/lv_draw_buf_private.h"
+#include "font/lv_font_fmt_txt_private.h"
+#include "core/lv_obj_bitmap_cache_private.h"
+#include "core/lv_obj_retained_draw_private.h"
 #include "core/lv_refr_private.h"
 #include "core/lv_obj_style_private.h"
 #include "core/lv_group_private.h"
@@ -280,6 +283,9 @@ void lv_init(void)
     lv_image_decoder_init(LV_CACHE_DEF_SIZE, LV_IMAGE_HEADER_CACHE_DEF_CNT);
     lv_bin_decoder_init();  /*LVGL built-in binary image decoder*/
 
+    lv_font_fmt_txt_cache_init(LV_FONT_FMT_TXT_BITMAP_CACHE_SIZE);
+    lv_obj_bitmap_cache_init(LV_OBJ_BITMAP_CACHE_SIZE);
+
 #if LV_USE_DRAW_VG_LITE
     lv_draw_vg_lite_init();
 #endif
@@ -439,6 +445,10 @@ void lv_deinit(void)
     lv_theme_mono_deinit();
 #endif
 
+    lv_font_fmt_txt_cache_deinit();
+    lv_obj_bitmap_cache_deinit();
+    lv_obj_retained_draw_deinit();
+
     lv_image_decoder_deinit();
 
     lv_refr_deinit();
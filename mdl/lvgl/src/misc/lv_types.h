@@ -120,6 +120,7 @@ typedef struct _lv_display_t lv_display_t;
 typedef struct _lv_layer_t lv_layer_t;
 typedef struct _lv_draw_unit_t lv_draw_unit_t;
 typedef struct _lv_draw_task_t lv_draw_task_t;
+typedef struct _lv_draw_task_index_t lv_draw_task_index_t;
 
 typedef struct _lv_indev_t lv_indev_t;
 
@@ -183,6 +184,10 @@ typedef struct _lv_draw_mask_rect_dsc_t lv_draw_mask_rect_dsc_t;
 
 typedef struct _lv_obj_style_t lv_obj_style_t;
 
+typedef struct _lv_obj_style_resolved_t lv_obj_style_resolved_t;
+
+typedef struct _lv_obj_retained_draw_t lv_obj_retained_draw_t;
+
 typedef struct _lv_obj_style_transition_dsc_t lv_obj_style_transition_dsc_t;
 
 typedef struct _lv_hit_test_info_t lv_hit_test_info_t;
@@ -161,6 +161,68 @@ static unsigned int _atoi(const char ** str)
     return i;
 }
 
+// two digit table for the decimal conversions, "00" to "99"
+static const char _digit_pairs[200] = {
+    '0', '0', '0', '1', '0', '2', '0', '3', '0', '4', '0', '5', '0', '6', '0', '7', '0', '8', '0', '9',
+    '1', '0', '1', '1', '1', '2', '1', '3', '1', '4', '1', '5', '1', '6', '1', '7', '1', '8', '1', '9',
+    '2', '0', '2', '1', '2', '2', '2', '3', '2', '4', '2', '5', '2', '6', '2', '7', '2', '8', '2', '9',
+    '3', '0', '3', '1', '3', '2', '3', '3', '3', '4', '3', '5', '3', '6', '3', '7', '3', '8', '3', '9',
+    '4', '0', '4', '1', '4', '2', '4', '3', '4', '4', '4', '5', '4', '6', '4', '7', '4', '8', '4', '9',
+    '5', '0', '5', '1', '5', '2', '5', '3', '5', '4', '5', '5', '5', '6', '5', '7', '5', '8', '5', '9',
+    '6', '0', '6', '1', '6', '2', '6', '3', '6', '4', '6', '5', '6', '6', '6', '7', '6', '8', '6', '9',
+    '7', '0', '7', '1', '7', '2', '7', '3', '7', '4', '7', '5', '7', '6', '7', '7', '7', '8', '7', '9',
+    '8', '0', '8', '1', '8', '2', '8', '3', '8', '4', '8', '5', '8', '6', '8', '7', '8', '8', '8', '9',
+    '9', '0', '9', '1', '9', '2', '9', '3', '9', '4', '9', '5', '9', '6', '9', '7', '9', '8', '9', '9',
+};
+
+// internal decimal conversion, two digits per step, in reverse order
+// \return the number of digits written, at most 10
+static size_t _dec_rev32(char * buf, uint32_t value)
+{
+    size_t len = 0U;
+
+    while(value >= 100U) {
+        const char * pair = &_digit_pairs[(value % 100U) * 2U];
+        value /= 100U;
+        buf[len++] = pair[1];
+        buf[len++] = pair[0];
+    }
+    if(value >= 10U) {
+        buf[len++] = _digit_pairs[value * 2U + 1U];
+        buf[len++] = _digit_pairs[value * 2U];
+    }
+    else {
+        buf[len++] = (char)('0' + value);
+    }
+
+    return len;
+}
+
+#if defined(PRINTF_SUPPORT_LONG_LONG)
+// internal decimal conversion for 'long long', one 64 bit division per eight digits
+// \return the number of digits written, at most 20
+static size_t _dec_rev64(char * buf, unsigned long long value)
+{
+    size_t len = 0U;
+
+    while(value > 0xFFFFFFFFULL) {
+        const unsigned long long high = value / 100000000U;
+        uint32_t low = (uint32_t)(value - high * 100000000U);
+        size_t i;
+        value = high;
+        // a full chunk keeps its leading zeros
+        for(i = 0; i < 4U; i++) {
+            const char * pair = &_digit_pairs[(low % 100U) * 2U];
+            low /= 100U;
+            buf[len++] = pair[1];
+            buf[len++] = pair[0];
+        }
+    }
+
+    return len + _dec_rev32(buf + len, (uint32_t)value);
+}
+#endif  // PRINTF_SUPPORT_LONG_LONG
+
 // output the specified string in reverse, taking care of any zero-padding
 static size_t _out_rev(out_fct_type out, char * buffer, size_t idx, size_t maxlen, const char * buf, size_t len,
                        unsigned int width, unsigned int flags)
@@ -258,11 +320,16 @@ static size_t _ntoa_long(out_fct_type out, char * buffer, size_t idx, size_t max
 
     // write if precision != 0 and value is != 0
     if(!(flags & FLAGS_PRECISION) || value) {
-        do {
-            const char digit = (char)(value % base);
-            buf[len++] = digit < 10 ? '0' + digit : (flags & FLAGS_UPPERCASE ? 'A' : 'a') + digit - 10;
-            value /= base;
-        } while(value && (len < PRINTF_NTOA_BUFFER_SIZE));
+        if((base == 10U) && (value <= 0xFFFFFFFFUL) && (PRINTF_NTOA_BUFFER_SIZE >= 10U)) {
+            len = _dec_rev32(buf, (uint32_t)value);
+        }
+        else {
+            do {
+                const char digit = (char)(value % base);
+                buf[len++] = digit < 10 ? '0' + digit : (flags & FLAGS_UPPERCASE ? 'A' : 'a') + digit - 10;
+                value /= base;
+            } while(value && (len < PRINTF_NTOA_BUFFER_SIZE));
+        }
     }
 
     return _ntoa_format(out, buffer, idx, maxlen, buf, len, negative, (unsigned int)base, prec, width, flags);
@@ -283,11 +350,16 @@ static size_t _ntoa_long_long(out_fct_type out, char * buffer, size_t idx, size_
 
     // write if precision != 0 and value is != 0
     if(!(flags & FLAGS_PRECISION) || value) {
-        do {
-            const char digit = (char)(value % base);
-            buf[len++] = digit < 10 ? '0' + digit : (flags & FLAGS_UPPERCASE ? 'A' : 'a') + digit - 10;
-            value /= base;
-        } while(value && (len < PRINTF_NTOA_BUFFER_SIZE));
+        if((base == 10U) && (PRINTF_NTOA_BUFFER_SIZE >= 20U)) {
+            len = _dec_rev64(buf, value);
+        }
+        else {
+            do {
+                const char digit = (char)(value % base);
+                buf[len++] = digit < 10 ? '0' + digit : (flags & FLAGS_UPPERCASE ? 'A' : 'a') + digit - 10;
+                value /= base;
+            } while(value && (len < PRINTF_NTOA_BUFFER_SIZE));
+        }
     }
 
     return _ntoa_format(out, buffer, idx, maxlen, buf, len, negative, (unsigned int)base, prec, width, flags);
@@ -302,6 +374,71 @@ static size_t _etoa(out_fct_type out, char * buffer, size_t idx, size_t maxlen,
                     unsigned int width, unsigned int flags);
 #endif
 
+#if DBL_MANT_DIG == 53
+// exact split of a non-negative double below 2^32 into the integral part and
+// the fraction rounded to prec (<= 9) digits, ties to even. The binary fraction
+// of the mantissa is scaled by 5^prec with 32x32 bit multiplications, so there
+// is neither double rounding nor a division per digit.
+static void _ftoa_split(double value, unsigned int prec, uint32_t * whole, uint32_t * frac)
+{
+    static const uint32_t pow5[] = { 1, 5, 25, 125, 625, 3125, 15625, 78125, 390625, 1953125 };
+    static const uint32_t pow10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+    union {
+        double f;
+        uint64_t u;
+    } bits;
+    uint64_t mant, rest, prod, prod_hi, q2, sticky;
+    uint32_t w, q;
+    int shift;
+
+    bits.f = value;
+    bits.u &= ~(1ULL << 63);    // -0.0 reaches here as well
+    if((bits.u >> 52) == 0) {
+        // zero or subnormal
+        *whole = 0;
+        *frac = 0;
+        return;
+    }
+
+    // value = mant / 2^shift
+    mant = (bits.u & ((1ULL << 52) - 1)) | (1ULL << 52);
+    shift = 1075 - (int)(bits.u >> 52);
+    w = shift >= 64 ? 0 : (uint32_t)(mant >> shift);
+    rest = shift >= 64 ? mant : mant & ((1ULL << shift) - 1);
+
+    // rest * 10^prec / 2^shift = rest * 5^prec / 2^(shift - prec), below 2^74
+    prod = (uint64_t)(uint32_t)rest * pow5[prec];
+    prod_hi = (uint64_t)(uint32_t)(rest >> 32) * pow5[prec] + (prod >> 32);
+
+    // keep one bit more than needed, the half
+    shift = shift - (int)prec - 1;
+    if(shift >= 75) {
+        q2 = 0;
+        sticky = 0;
+    }
+    else if(shift < 32) {
+        q2 = (prod_hi << (32 - shift)) | ((uint32_t)prod >> shift);
+        sticky = (uint32_t)prod & ((1UL << shift) - 1);
+    }
+    else {
+        q2 = prod_hi >> (shift - 32);
+        sticky = (uint32_t)prod | (prod_hi & ((1ULL << (shift - 32)) - 1));
+    }
+
+    q = (uint32_t)(q2 >> 1);
+    if((q2 & 1) && (sticky || ((prec ? q : w) & 1))) {
+        // handle rollover, e.g. case 0.99 with prec 1 is 1.0
+        if(++q == pow10[prec]) {
+            q = 0;
+            ++w;
+        }
+    }
+
+    *whole = w;
+    *frac = q;
+}
+#endif
+
 // internal ftoa for fixed decimal floating point
 static size_t _ftoa(out_fct_type out, char * buffer, size_t idx, size_t maxlen, double value, unsigned int prec,
                     unsigned int width, unsigned int flags)
@@ -310,8 +447,10 @@ static size_t _ftoa(out_fct_type out, char * buffer, size_t idx, size_t maxlen,
     size_t len  = 0U;
     double diff = 0.0;
 
+#if DBL_MANT_DIG != 53
     // powers of 10
     static const double pow10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+#endif
 
     // test for special values
     if(value != value)
@@ -349,6 +488,11 @@ static size_t _ftoa(out_fct_type out, char * buffer, size_t idx, size_t maxlen,
         prec--;
     }
 
+#if DBL_MANT_DIG == 53
+    uint32_t whole, frac;
+    LV_UNUSED(diff);
+    _ftoa_split(value, prec, &whole, &frac);
+#else
     int whole = (int)value;
     double tmp = (value - whole) * pow10[prec];
     unsigned long frac = (unsigned long)tmp;
@@ -377,15 +521,17 @@ static size_t _ftoa(out_fct_type out, char * buffer, size_t idx, size_t maxlen,
             ++whole;
         }
     }
-    else {
+#endif
+
+    char digits[10];
+    size_t digit_count, i;
+    if(prec != 0U) {
         unsigned int count = prec;
         // now do fractional part, as an unsigned number
-        while(len < PRINTF_FTOA_BUFFER_SIZE) {
+        digit_count = _dec_rev32(digits, (uint32_t)frac);
+        for(i = 0; (i < digit_count) && (len < PRINTF_FTOA_BUFFER_SIZE); i++) {
             --count;
-            buf[len++] = (char)(48U + (frac % 10U));
-            if(!(frac /= 10U)) {
-                break;
-            }
+            buf[len++] = digits[i];
         }
         // add extra 0s
         while((len < PRINTF_FTOA_BUFFER_SIZE) && (count-- > 0U)) {
@@ -398,11 +544,9 @@ static size_t _ftoa(out_fct_type out, char * buffer, size_t idx, size_t maxlen,
     }
 
     // do whole part, number is reversed
-    while(len < PRINTF_FTOA_BUFFER_SIZE) {
-        buf[len++] = (char)(48 + (whole % 10));
-        if(!(whole /= 10)) {
-            break;
-        }
+    digit_count = _dec_rev32(digits, (uint32_t)whole);
+    for(i = 0; (i < digit_count) && (len < PRINTF_FTOA_BUFFER_SIZE); i++) {
+        buf[len++] = digits[i];
     }
 
     // pad leading zeros
@@ -6,6 +6,7 @@
  * Change Logs:
  * Date           Author       Notes
  * 2024-09-22     Meco Man     the first version
+ * 2026-10-19     proyrb       add rt_fmt_xxx numeric conversions
  */
 
 #ifndef __RT_KSTDIO_H__
@@ -25,6 +26,17 @@ int rt_snprintf(char *buf, rt_size_t size, const char *format, ...);
 int rt_vsscanf(const char *buffer, const char *format, va_list ap);
 int rt_sscanf(const char *str, const char *format, ...);
 
+/* buffer sizes for the rt_fmt_xxx() conversions, terminating null included */
+#define RT_FMT_INT_SIZE     12
+#define RT_FMT_FIXED_SIZE   22
+
+rt_size_t rt_fmt_u32_rev(char *buf, rt_uint32_t value);
+rt_size_t rt_fmt_u64_rev(char *buf, rt_uint64_t value);
+rt_err_t rt_fmt_fixed_split(double value, int precision, rt_uint32_t *integral, rt_uint32_t *fraction);
+int rt_fmt_u32(char *buf, rt_uint32_t value);
+int rt_fmt_i32(char *buf, rt_int32_t value);
+int rt_fmt_fixed(char *buf, double value, int precision);
+
 #ifdef __cplusplus
 }
 #endif
@@ -201,6 +201,18 @@ rt_inline rt_atomic_t rt_soft_atomic_compare_exchange_strong(volatile rt_atomic_
 }
 #endif /* RT_USING_STDC_ATOMIC */
 
+/* order the plain memory accesses around them, rt_hw_dmb() is empty without RT_USING_CACHE */
+#if defined(RT_USING_STDC_ATOMIC)
+#define rt_atomic_thread_fence_acquire() atomic_thread_fence(memory_order_acquire)
+#define rt_atomic_thread_fence_release() atomic_thread_fence(memory_order_release)
+#elif defined(__GNUC__) || defined(__clang__)
+#define rt_atomic_thread_fence_acquire() __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#define rt_atomic_thread_fence_release() __atomic_thread_fence(__ATOMIC_RELEASE)
+#else
+#define rt_atomic_thread_fence_acquire() rt_hw_dmb()
+#define rt_atomic_thread_fence_release() rt_hw_dmb()
+#endif /* RT_USING_STDC_ATOMIC */
+
 rt_inline rt_bool_t rt_atomic_dec_and_test(volatile rt_atomic_t *ptr)
 {
     return rt_atomic_sub(ptr, 1) == 1;
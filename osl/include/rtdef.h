@@ -202,6 +202,44 @@ typedef int (*init_fn_t)(void);
 /* init in secondary_cpu_c_start */
 #define INIT_SECONDARY_CPU_EXPORT(fn)   INIT_EXPORT(fn, "7")
 
+#if defined(RT_USING_COMPONENTS_INIT) && defined(RT_USING_INIT_PARALLEL)
+/**
+ * initialization task, run by rt_components_parallel_init() once the tasks it depends on are done
+ */
+struct rt_init_task
+{
+    const char             *name;                       /**< name of the function */
+    init_fn_t               fn;                         /**< initialization function */
+    const init_fn_t        *deps;                       /**< functions of the tasks to wait for */
+    rt_uint8_t              dep_count;                  /**< number of dependencies */
+};
+
+/*
+ * init task, may run in parallel with other tasks after the components
+ * initialization, e.g. INIT_TASK_EXPORT(lcd_init, sdram_init). The linker
+ * script has to keep the sorted .rti_task* sections next to .rti_fn*.
+ */
+#define INIT_TASK_EXPORT(fn, ...)                                                            \
+    static const init_fn_t __rti_task_deps_##fn[] = {RT_NULL, ##__VA_ARGS__};               \
+    rt_used const struct rt_init_task __rt_init_task_##fn rt_section(".rti_task.1") =       \
+    { #fn, fn, &__rti_task_deps_##fn[1], sizeof(__rti_task_deps_##fn) / sizeof(init_fn_t) - 1 }
+#endif /* defined(RT_USING_COMPONENTS_INIT) && defined(RT_USING_INIT_PARALLEL) */
+
+#if defined(RT_USING_COMPONENTS_INIT) && defined(RT_USING_INIT_TIMELINE)
+/**
+ * one initialization function on the boot timeline
+ */
+struct rt_init_record
+{
+    const char             *name;                       /**< name of the function, RT_NULL if not known */
+    init_fn_t               fn;                         /**< initialization function */
+    rt_uint32_t             start;                      /**< start time in us, see rt_hw_timestamp_us() */
+    rt_uint32_t             cost;                       /**< run time in us */
+    int                     result;                     /**< returned value */
+    rt_uint8_t              worker;                     /**< 0 for the boot thread, 1.. for parallel workers */
+};
+#endif /* defined(RT_USING_COMPONENTS_INIT) && defined(RT_USING_INIT_TIMELINE) */
+
 #if !defined(RT_USING_FINSH)
 /* define these to empty, even if not include finsh.h file */
 #define FINSH_FUNCTION_EXPORT(name, desc)
@@ -323,6 +361,8 @@ typedef rt_err_t (*rt_object_iter_t)(rt_object_t object, void *data);
  *  - Device
  *  - Timer
  *  - Module
+ *  - RWLock
+ *  - SeqLock
  *  - Unknown
  *  - Static
  */
@@ -345,7 +385,9 @@ enum rt_object_class_type
     RT_Object_Class_ProcessGroup  = 0x0e,      /**< The object is a process group */
     RT_Object_Class_Session       = 0x0f,      /**< The object is a session */
     RT_Object_Class_Custom        = 0x10,      /**< The object is a custom object */
-    RT_Object_Class_Unknown       = 0x11,      /**< The object is unknown. */
+    RT_Object_Class_RWLock        = 0x11,      /**< The object is a reader-writer lock. */
+    RT_Object_Class_SeqLock       = 0x12,      /**< The object is a sequence lock. */
+    RT_Object_Class_Unknown       = 0x13,      /**< The object is unknown. */
     RT_Object_Class_Static        = 0x80       /**< The object is a static object. */
 };
 
@@ -360,6 +402,27 @@ struct rt_object_information
     struct rt_spinlock        spinlock;
 };
 
+#ifdef RT_USING_OBJECT_CACHE
+/**
+ * usage report of the object cache of a class
+ */
+struct rt_object_cache_info
+{
+    rt_size_t               object_size;                /**< size of one object */
+    rt_uint16_t             per_slab;                   /**< objects in one slab, 0 if not cached */
+    rt_uint16_t             reserve;                    /**< free objects kept in the cache */
+    rt_size_t               slabs;                      /**< slabs held */
+    rt_size_t               free;                       /**< free objects in the slabs */
+    rt_size_t               in_use;                     /**< allocated objects */
+    rt_size_t               peak;                       /**< high water mark of in_use */
+    rt_size_t               alloc_count;                /**< rt_object_allocate() calls served */
+    rt_size_t               grow_count;                 /**< slabs taken from the heap */
+    rt_size_t               shrink_count;               /**< slabs given back to the heap */
+    rt_size_t               fallback_count;             /**< objects taken from the heap one by one */
+    rt_size_t               fail_count;                 /**< allocations that found no memory */
+};
+#endif /* RT_USING_OBJECT_CACHE */
+
 /**
  * The hook function call macro
  */
@@ -542,6 +605,10 @@ struct rt_object_information
 #define RT_TIMER_CTRL_SET_FUNC          0x7             /**< set timer timeout func  */
 #define RT_TIMER_CTRL_GET_PARM          0x8             /**< get timer parameter  */
 #define RT_TIMER_CTRL_SET_PARM          0x9             /**< set timer parameter  */
+#ifdef RT_USING_TIMER_SLACK
+#define RT_TIMER_CTRL_SET_SLACK         0xa             /**< set how late the timer may fire */
+#define RT_TIMER_CTRL_GET_SLACK         0xb             /**< get how late the timer may fire */
+#endif /* RT_USING_TIMER_SLACK */
 
 #ifndef RT_TIMER_SKIP_LIST_LEVEL
 #define RT_TIMER_SKIP_LIST_LEVEL          1
@@ -571,6 +638,10 @@ struct rt_timer
 
     rt_tick_t        init_tick;                         /**< timer timeout tick */
     rt_tick_t        timeout_tick;                      /**< timeout tick */
+#ifdef RT_USING_TIMER_SLACK
+    rt_tick_t        slack;                             /**< ticks the timeout may be put off */
+    rt_tick_t        due_tick;                          /**< timeout tick before the slack */
+#endif /* RT_USING_TIMER_SLACK */
 };
 typedef struct rt_timer *rt_timer_t;
 
@@ -882,6 +953,13 @@ struct rt_thread
     rt_uint8_t                  event_info;
 #endif /* RT_USING_EVENT */
 
+#ifdef RT_USING_IPC_PRIO_INDEX
+    rt_list_t                   *susp_list;             /**< priority ordered list the thread waits on */
+    rt_list_t                   susp_run;               /**< run heads of susp_list, in priority order */
+    rt_uint8_t                  susp_prio;              /**< priority the thread was queued with */
+    rt_uint8_t                  susp_run_head;          /**< first waiter of its priority on susp_list */
+#endif /* RT_USING_IPC_PRIO_INDEX */
+
 #ifdef RT_USING_SIGNALS
     rt_sigset_t                 sig_pending;            /**< the pending signals */
     rt_sigset_t                 sig_mask;               /**< the mask bits of signal */
@@ -943,11 +1021,51 @@ struct rt_thread
 #endif /* RT_USING_HW_STACK_GUARD */
 #endif /* RT_USING_MEM_PROTECTION */
 
+#ifdef RT_USING_HEAPPROF
+    const char                  *heapprof_tag;          /**< heap profiler call site tag */
+#endif /* RT_USING_HEAPPROF */
+
     struct rt_spinlock          spinlock;
     rt_ubase_t                  user_data;              /**< private user data beyond this thread */
 };
 typedef struct rt_thread *rt_thread_t;
 
+#ifdef RT_USING_SCHED_DEADLINE
+/**
+ * parameters of the deadline scheduling class, in ticks
+ */
+struct rt_sched_deadline_attr
+{
+    rt_tick_t               period;                     /**< a job is released every period */
+    rt_tick_t               runtime;                    /**< budget of each job */
+    rt_tick_t               deadline;                   /**< relative deadline, 0 for the period */
+};
+
+/**
+ * job accounting of a thread in the deadline class
+ */
+struct rt_sched_deadline_stat
+{
+    rt_uint32_t             jobs;                       /**< finished jobs */
+    rt_uint32_t             misses;                     /**< jobs finished after their deadline */
+    rt_uint32_t             overruns;                   /**< jobs that exhausted their budget */
+    rt_tick_t               abs_deadline;               /**< absolute deadline of the current job */
+};
+#endif /* RT_USING_SCHED_DEADLINE */
+
+#if defined(RT_USING_SMP) && defined(RT_SCHED_USING_BALANCE)
+/**
+ * thread migration counters of one cpu
+ */
+struct rt_sched_balance_stat
+{
+    rt_uint32_t             wake_migrations;            /**< threads woken here instead of on their last cpu */
+    rt_uint32_t             idle_pulls;                 /**< threads pulled from another cpu on idle entry */
+    rt_uint32_t             tick_pulls;                 /**< threads pulled by the periodic pass */
+    rt_uint32_t             nr_queued;                  /**< unbound threads in the ready queue */
+};
+#endif /* defined(RT_USING_SMP) && defined(RT_SCHED_USING_BALANCE) */
+
 #ifdef RT_USING_SMART
 #define LWP_IS_USER_MODE(t) ((t)->user_ctx.ctx == RT_NULL)
 #else
@@ -1035,6 +1153,65 @@ typedef struct rt_mutex *rt_mutex_t;
 
 /**@}*/
 
+/**
+ * @addtogroup group_rwlock Reader-Writer Lock
+ * @{
+ */
+
+#ifdef RT_USING_RWLOCK
+#define RT_RWLOCK_WRITER                0x40000000      /**< a writer holds or waits for the lock */
+#define RT_RWLOCK_READERS_MASK          (RT_RWLOCK_WRITER - 1)
+
+/**
+ * reader-writer lock structure
+ */
+struct rt_rwlock
+{
+    struct rt_object        parent;                     /**< inherit from rt_object */
+
+    rt_atomic_t             state;                      /**< readers inside, plus RT_RWLOCK_WRITER */
+    struct rt_thread       *writer;                     /**< thread holding the write lock */
+
+    struct rt_mutex         gate;                       /**< held by the writer, readers queue on it */
+    struct rt_semaphore     drained;                    /**< released by the last reader a writer waits for */
+};
+typedef struct rt_rwlock *rt_rwlock_t;
+#endif /* RT_USING_RWLOCK */
+
+/**@}*/
+
+/**
+ * @addtogroup group_seqlock Sequence Lock
+ * @{
+ */
+
+#ifdef RT_USING_SEQLOCK
+/**
+ * sequence lock structure
+ */
+struct rt_seqlock
+{
+    struct rt_object        parent;                     /**< inherit from rt_object */
+
+    rt_atomic_t             sequence;                   /**< odd while a writer is inside */
+    struct rt_spinlock      lock;                       /**< serializes the writers */
+};
+typedef struct rt_seqlock *rt_seqlock_t;
+#endif /* RT_USING_SEQLOCK */
+
+/**@}*/
+
+/**
+ * @addtogroup group_futex Wait on Address
+ * @{
+ */
+
+#ifdef RT_USING_FUTEX
+#define RT_FUTEX_WAKE_ALL               RT_UINT32_MAX   /**< wake every thread waiting on the word */
+#endif /* RT_USING_FUTEX */
+
+/**@}*/
+
 /**
  * @addtogroup group_event Event
  * @{
@@ -1057,6 +1234,11 @@ struct rt_event
 
     rt_uint32_t          set;                           /**< event set */
     struct rt_spinlock   spinlock;
+#ifdef RT_EVENT_USING_WAITER_INDEX
+    rt_uint32_t          waiter_set;                    /**< bits with a non-empty waiter list */
+    rt_uint32_t          multi_set;                     /**< bits awaited by multi-bit OR waiters */
+    rt_list_t            waiters[32];                   /**< waiters keyed by one bit they need */
+#endif /* RT_EVENT_USING_WAITER_INDEX */
 };
 typedef struct rt_event *rt_event_t;
 #endif /* RT_USING_EVENT */
@@ -1201,8 +1383,140 @@ struct rt_memheap
     struct rt_semaphore     lock;                       /**< semaphore lock */
     rt_bool_t               locked;                     /**< External lock mark */
 };
+
+#ifdef RT_USING_MEMTIER
+/**
+ * memory tier placement class
+ */
+#define RT_MEMTIER_FAST                 0               /**< small, latency critical (e.g. DTCM) */
+#define RT_MEMTIER_DMA                  1               /**< reachable by bus masters (e.g. AXI SRAM) */
+#define RT_MEMTIER_BULK                 2               /**< large and slow (e.g. external SDRAM) */
+#define RT_MEMTIER_CLASS_MAX            3
+#define RT_MEMTIER_AUTO                 0xff            /**< choose the class by request size */
+
+/**
+ * Base structure of memory tier
+ */
+struct rt_memtier
+{
+    struct rt_memheap       heap;                       /**< backing memory heap */
+    rt_bool_t               attached;                   /**< tier has memory behind it */
+
+    rt_atomic_t             alloc_count;                /**< blocks placed on this tier */
+    rt_atomic_t             live_count;                 /**< blocks on this tier not freed yet */
+    rt_atomic_t             spill_count;                /**< blocks placed here for another class */
+    rt_atomic_t             fail_count;                 /**< requests this tier could not satisfy */
+};
+
+/**
+ * memory tier usage report
+ */
+struct rt_memtier_info
+{
+    rt_size_t               total;                      /**< size of the tier */
+    rt_size_t               used;                       /**< bytes in use, including headers */
+    rt_size_t               max_used;                   /**< high water mark */
+    rt_size_t               alloc_count;                /**< blocks placed on this tier */
+    rt_size_t               live_count;                 /**< blocks on this tier not freed yet */
+    rt_size_t               spill_count;                /**< blocks placed here for another class */
+    rt_size_t               fail_count;                 /**< requests this tier could not satisfy */
+};
+#endif /* RT_USING_MEMTIER */
 #endif /* RT_USING_MEMHEAP */
 
+#ifdef RT_USING_HEAPPROF
+#ifndef RT_HEAPPROF_DEPTH
+#define RT_HEAPPROF_DEPTH               4               /**< return addresses kept per call site */
+#endif
+
+/**
+ * heap profiler call site
+ */
+struct rt_heapprof_site
+{
+    const char             *tag;                        /**< caller supplied tag */
+    char                    thread[RT_NAME_MAX];        /**< allocating thread, if nothing better is known */
+    rt_ubase_t              frames[RT_HEAPPROF_DEPTH];  /**< return addresses, innermost first */
+
+    rt_size_t               live_bytes;                 /**< bytes allocated and not yet freed */
+    rt_size_t               live_count;                 /**< blocks allocated and not yet freed */
+    rt_size_t               peak_bytes;                 /**< high water mark of live bytes */
+    rt_size_t               alloc_count;                /**< allocations since the profiler started */
+    rt_size_t               alloc_bytes;                /**< bytes allocated since the profiler started */
+    rt_size_t               fail_count;                 /**< allocations that returned NULL */
+};
+#endif /* RT_USING_HEAPPROF */
+
+#ifdef RT_USING_DMA_BUF
+/**
+ * dma buffer allocation flags
+ */
+#define RT_DMA_BUF_CACHED               0x00            /**< cacheable, maintained on ownership changes */
+#define RT_DMA_BUF_UNCACHED             0x01            /**< from the non-cacheable pool if there is one */
+
+/**
+ * direction of a device access
+ */
+#define RT_DMA_TO_DEVICE                0x01            /**< the device reads the buffer */
+#define RT_DMA_FROM_DEVICE              0x02            /**< the device writes the buffer */
+#define RT_DMA_BIDIRECTIONAL            (RT_DMA_TO_DEVICE | RT_DMA_FROM_DEVICE)
+
+/**
+ * owner of a dma buffer
+ */
+#define RT_DMA_BUF_OWNER_CPU            0
+#define RT_DMA_BUF_OWNER_DEVICE         1
+
+#ifndef RT_DMA_SYNC_BATCH_MAX
+#define RT_DMA_SYNC_BATCH_MAX           8               /**< ranges queued before a batch commits itself */
+#endif
+
+/**
+ * cache line aligned buffer shared with a bus master
+ */
+struct rt_dma_buf
+{
+    void                   *addr;                       /**< first byte, cache line aligned */
+    rt_size_t               size;                       /**< usable size, whole cache lines */
+    void                   *raw;                        /**< block returned by the allocator */
+
+    rt_uint8_t              flags;                      /**< RT_DMA_BUF_CACHED or RT_DMA_BUF_UNCACHED */
+    rt_uint8_t              source;                     /**< allocator the block came from */
+    rt_uint8_t              owner;                      /**< RT_DMA_BUF_OWNER_CPU or _DEVICE */
+    rt_uint8_t              dir;                        /**< direction of the device access */
+
+    rt_size_t               offset;                     /**< range handed to the device */
+    rt_size_t               length;
+};
+typedef struct rt_dma_buf *rt_dma_buf_t;
+
+/**
+ * cache maintenance collected over several ownership changes
+ */
+struct rt_dma_sync_batch
+{
+    rt_uint8_t              count;
+    struct
+    {
+        rt_ubase_t          start;                      /**< cache line aligned */
+        rt_ubase_t          end;                        /**< cache line aligned, exclusive */
+        rt_uint8_t          ops;                        /**< RT_HW_CACHE_FLUSH and/or RT_HW_CACHE_INVALIDATE */
+    } range[RT_DMA_SYNC_BATCH_MAX];
+};
+
+/**
+ * dma buffer cache maintenance counters
+ */
+struct rt_dma_buf_stat
+{
+    rt_size_t               transfers;                  /**< ownership changes */
+    rt_size_t               maint_calls;                /**< calls into rt_hw_cpu_dcache_ops */
+    rt_size_t               clean_lines;                /**< lines cleaned, including clean and invalidate */
+    rt_size_t               invalidate_lines;           /**< lines invalidated, including clean and invalidate */
+    rt_size_t               merged_ranges;              /**< queued ranges folded into a neighbour */
+};
+#endif /* RT_USING_DMA_BUF */
+
 #ifdef RT_USING_MEMPOOL
 /**
  * Base structure of Memory pool object
@@ -1215,10 +1529,20 @@ struct rt_mempool
     rt_size_t           size;                              /**< size of memory pool */
 
     rt_size_t           block_size;                        /**< size of memory blocks */
+#ifdef RT_MEMPOOL_USING_LOCKFREE
+    rt_atomic_t         block_head;                        /**< tagged index of the first free block */
+    rt_atomic_t         block_waiting;                     /**< threads in the blocking allocation path */
+    rt_uint8_t          index_bits;                        /**< bits of block_head holding the index */
+#else
     rt_uint8_t          *block_list;                        /**< memory blocks list */
+#endif /* RT_MEMPOOL_USING_LOCKFREE */
 
     rt_size_t           block_total_count;                 /**< numbers of memory block */
+#ifdef RT_MEMPOOL_USING_LOCKFREE
+    rt_atomic_t         block_free_count;                  /**< numbers of free memory block */
+#else
     rt_size_t           block_free_count;                  /**< numbers of free memory block */
+#endif /* RT_MEMPOOL_USING_LOCKFREE */
 
     rt_list_t           suspend_thread;                    /**< threads pended on this resource */
     struct rt_spinlock  spinlock;
@@ -1226,6 +1550,69 @@ struct rt_mempool
 typedef struct rt_mempool *rt_mp_t;
 #endif /* RT_USING_MEMPOOL */
 
+#ifdef RT_USING_WORKPOOL
+/**
+ * a group of tasks that can be joined
+ */
+struct rt_workpool_group
+{
+    rt_atomic_t             pending;                    /**< unfinished tasks, plus a flag while joined */
+    struct rt_semaphore     done;                       /**< released when pending drops to zero */
+};
+
+/**
+ * a unit of work, owned by the submitter until it has run
+ */
+struct rt_workpool_task
+{
+    rt_list_t               list;                       /**< node in the injection queue */
+    void (*func)(void *parameter);                      /**< task function */
+    void                   *parameter;                  /**< task parameter */
+    struct rt_workpool_group *group;                    /**< group to notify, may be RT_NULL */
+};
+typedef struct rt_workpool_task *rt_workpool_task_t;
+
+/**
+ * Chase-Lev work stealing deque, the owner works at the bottom, thieves at the top
+ */
+struct rt_workpool_deque
+{
+    rt_atomic_t             top;
+    rt_atomic_t             bottom;
+    rt_atomic_t            *buffer;                     /**< ring of task pointers */
+};
+
+struct rt_workpool_worker
+{
+    struct rt_workpool     *pool;
+    rt_thread_t             thread;
+    struct rt_workpool_deque deque;
+    rt_uint32_t             seed;                       /**< victim selection */
+
+    rt_uint32_t             exec_count;                 /**< tasks run by this worker */
+    rt_uint32_t             steal_count;                /**< tasks taken from other workers */
+};
+
+/**
+ * Base structure of thread pool
+ */
+struct rt_workpool
+{
+    char                    name[RT_NAME_MAX];
+    rt_uint8_t              worker_count;
+    rt_atomic_t             idle;                       /**< workers about to sleep on wake */
+    rt_atomic_t             exiting;
+
+    struct rt_semaphore     wake;
+    struct rt_semaphore     exit;
+    struct rt_spinlock      spinlock;                   /**< protects inject */
+    rt_list_t               inject;                     /**< tasks from threads outside the pool */
+
+    struct rt_workpool_worker *workers;
+};
+typedef struct rt_workpool *rt_workpool_t;
+#endif /* RT_USING_WORKPOOL */
+
 /**@}*/
 
 #ifdef RT_USING_DEVICE
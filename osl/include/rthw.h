@@ -194,6 +194,11 @@ void rt_hw_exception_install(rt_err_t (*exception_handle)(void *context));
  */
 void rt_hw_us_delay(rt_uint32_t us);
 
+/*
+ * timestamp interface
+ */
+rt_uint64_t rt_hw_timestamp_us(void);
+
 int rt_hw_cpu_id(void);
 
 #if defined(RT_USING_SMP) || defined(RT_USING_AMP)
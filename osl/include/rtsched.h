@@ -40,8 +40,28 @@ struct rt_sched_thread_priv
 #endif /* RT_THREAD_PRIORITY_MAX > 32 */
     rt_uint32_t                 number_mask;            /**< priority number mask */
 
+#ifdef RT_USING_SCHED_DEADLINE
+    /* deadline class, active while dl_period is not zero */
+    rt_tick_t                   dl_period;              /**< release period */
+    rt_tick_t                   dl_runtime;             /**< budget of each job */
+    rt_tick_t                   dl_deadline;            /**< deadline relative to the release */
+    rt_tick_t                   dl_release;             /**< release tick of the current job */
+    rt_tick_t                   dl_abs_deadline;        /**< absolute deadline of the current job */
+    rt_tick_t                   dl_budget;              /**< budget left to the current job */
+    rt_uint32_t                 dl_jobs;                /**< finished jobs */
+    rt_uint32_t                 dl_misses;              /**< jobs finished after their deadline */
+    rt_uint32_t                 dl_overruns;            /**< jobs that exhausted their budget */
+    rt_uint8_t                  dl_saved_priority;      /**< priority to restore when leaving the class */
+#endif /* RT_USING_SCHED_DEADLINE */
 };
 
+#ifdef RT_USING_SCHED_DEADLINE
+/* the ready list of this priority is ordered by absolute deadline */
+#ifndef RT_SCHED_DEADLINE_PRIORITY
+#define RT_SCHED_DEADLINE_PRIORITY      (RT_THREAD_PRIORITY_MAX / 4)
+#endif
+#endif /* RT_USING_SCHED_DEADLINE */
+
 /**
  * Scheduler public status binding on thread. Caller must hold the scheduler
  * lock before access any one of its member.
@@ -61,6 +81,9 @@ struct rt_sched_thread_ctx
 #ifdef RT_USING_SMP
     rt_uint8_t                  bind_cpu;               /**< thread is bind to cpu */
     rt_uint8_t                  oncpu;                  /**< process on cpu */
+#ifdef RT_SCHED_USING_BALANCE
+    rt_uint8_t                  queue_cpu;              /**< cpu queueing the thread, or the one it last ran on */
+#endif /* RT_SCHED_USING_BALANCE */
 
     rt_base_t                   critical_lock_nest;     /**< critical lock count */
 #endif
@@ -138,6 +161,21 @@ void rt_sched_insert_thread(struct rt_thread *thread);
 void rt_sched_remove_thread(struct rt_thread *thread);
 struct rt_thread *rt_sched_thread_self(void);
 
+#ifdef RT_USING_SCHED_DEADLINE
+/* deadline class, called with the scheduler locked */
+#define RT_SCHED_DL_ACTIVE(thread)                                      \
+    (RT_SCHED_PRIV(thread).dl_period != 0 &&                            \
+     RT_SCHED_PRIV(thread).current_priority == RT_SCHED_DEADLINE_PRIORITY)
+rt_bool_t rt_sched_dl_before(struct rt_thread *thread, struct rt_thread *other);
+void rt_sched_dl_insert(rt_list_t *ready_list, struct rt_thread *thread);
+rt_bool_t rt_sched_dl_tick(struct rt_thread *thread, rt_tick_t tick);
+void rt_sched_dl_close(struct rt_thread *thread);
+#endif /* RT_USING_SCHED_DEADLINE */
+
+#if defined(RT_USING_SMP) && defined(RT_SCHED_USING_BALANCE)
+void rt_sched_balance_tick(rt_tick_t tick);
+#endif /* defined(RT_USING_SMP) && defined(RT_SCHED_USING_BALANCE) */
+
 #endif /* defined(__RT_KERNEL_SOURCE__) || defined(__RT_IPC_SOURCE__) */
 
 #ifdef __cplusplus
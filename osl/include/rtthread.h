@@ -67,6 +67,15 @@ void rt_object_delete(rt_object_t object);
 /* custom object */
 rt_object_t rt_custom_object_create(const char *name, void *data, rt_err_t (*data_destroy)(void *));
 rt_err_t rt_custom_object_destroy(rt_object_t obj);
+#ifdef RT_USING_OBJECT_CACHE
+rt_err_t rt_object_cache_config(enum rt_object_class_type type,
+                                rt_uint16_t               per_slab,
+                                rt_uint16_t               reserve,
+                                void (*ctor)(rt_object_t object),
+                                void (*dtor)(rt_object_t object));
+rt_size_t rt_object_cache_shrink(enum rt_object_class_type type);
+rt_err_t rt_object_cache_get_info(enum rt_object_class_type type, struct rt_object_cache_info *info);
+#endif /* RT_USING_OBJECT_CACHE */
 #endif /* RT_USING_HEAP */
 rt_bool_t rt_object_is_systemobject(rt_object_t object);
 rt_uint8_t rt_object_get_type(rt_object_t object);
@@ -253,8 +262,17 @@ void rt_scheduler_switch_sethook(void (*hook)(struct rt_thread *tid));
 #ifdef RT_USING_SMP
 void rt_secondary_cpu_entry(void);
 void rt_scheduler_ipi_handler(int vector, void *param);
+#ifdef RT_SCHED_USING_BALANCE
+rt_err_t rt_scheduler_get_balance_stat(int cpu, struct rt_sched_balance_stat *stat);
+#endif /* RT_SCHED_USING_BALANCE */
 #endif /* RT_USING_SMP */
 
+#ifdef RT_USING_SCHED_DEADLINE
+rt_err_t rt_thread_set_deadline(rt_thread_t thread, const struct rt_sched_deadline_attr *attr);
+rt_err_t rt_thread_get_deadline_stat(rt_thread_t thread, struct rt_sched_deadline_stat *stat);
+rt_err_t rt_thread_wait_period(void);
+#endif /* RT_USING_SCHED_DEADLINE */
+
 /**
  * @addtogroup group_signal
  * @{
@@ -338,6 +356,34 @@ void rt_free_sethook(void (*hook)(void **ptr));
 #endif /* RT_USING_HOOK */
 /**@}*/
 
+#ifdef RT_USING_HEAPPROF
+/*
+ * heap profiler interface
+ */
+rt_err_t rt_heapprof_start(void);
+void rt_heapprof_stop(void);
+void rt_heapprof_reset(void);
+const char *rt_heapprof_tag_set(const char *tag);
+rt_size_t rt_heapprof_snapshot(struct rt_heapprof_site *sites, rt_size_t count, rt_tick_t *elapsed);
+void rt_heapprof_dump(rt_size_t count, rt_bool_t folded);
+#endif /* RT_USING_HEAPPROF */
+
+#ifdef RT_USING_DMA_BUF
+/*
+ * dma buffer interface
+ */
+rt_err_t rt_dma_buf_pool_attach(void *begin_addr, rt_size_t size);
+rt_err_t rt_dma_buf_pool_detach(void);
+rt_err_t rt_dma_buf_alloc(rt_dma_buf_t buf, rt_size_t size, rt_uint8_t flags);
+void rt_dma_buf_free(rt_dma_buf_t buf);
+rt_err_t rt_dma_buf_to_device(rt_dma_buf_t buf, rt_uint8_t dir, rt_size_t offset, rt_size_t length,
+                              struct rt_dma_sync_batch *batch);
+rt_err_t rt_dma_buf_to_cpu(rt_dma_buf_t buf, struct rt_dma_sync_batch *batch);
+void rt_dma_sync_batch_init(struct rt_dma_sync_batch *batch);
+void rt_dma_sync_batch_commit(struct rt_dma_sync_batch *batch);
+void rt_dma_buf_get_stat(struct rt_dma_buf_stat *stat);
+#endif /* RT_USING_DMA_BUF */
+
 #endif /* RT_USING_HEAP */
 
 #ifdef RT_USING_SMALL_MEM
@@ -371,6 +417,20 @@ void rt_memheap_info(struct rt_memheap *heap,
                      rt_size_t *max_used);
 #endif /* RT_USING_MEMHEAP */
 
+#ifdef RT_USING_MEMTIER
+/**
+ * tiered memory placement interface
+ */
+rt_err_t rt_memtier_attach(rt_uint8_t tier_class, const char *name,
+                           void *begin_addr, rt_size_t size);
+rt_err_t rt_memtier_detach(rt_uint8_t tier_class);
+void *rt_memtier_alloc(rt_size_t size, rt_uint8_t tier_class);
+void *rt_memtier_realloc(void *ptr, rt_size_t newsize);
+void rt_memtier_free(void *ptr);
+rt_uint8_t rt_memtier_class_of(void *ptr);
+rt_err_t rt_memtier_get_info(rt_uint8_t tier_class, struct rt_memtier_info *info);
+#endif /* RT_USING_MEMTIER */
+
 #ifdef RT_USING_MEMHEAP_AS_HEAP
 /**
  * memory heap as heap
@@ -419,6 +479,7 @@ rt_err_t rt_susp_list_resume_all_irq(rt_list_t *susp_list,
 rt_err_t rt_thread_suspend_to_list(rt_thread_t thread, rt_list_t *susp_list, int ipc_flags, int suspend_flag);
 /* only for a suspended thread, and caller must hold the scheduler lock */
 rt_err_t rt_susp_list_enqueue(rt_list_t *susp_list, rt_thread_t thread, int ipc_flags);
+void rt_susp_list_remove(rt_thread_t thread);
 
 /**
  * @addtogroup group_semaphore Semaphore
@@ -488,6 +549,82 @@ rt_inline rt_ubase_t rt_mutex_get_hold(rt_mutex_t mutex)
 
 /**@}*/
 
+/**
+ * @addtogroup group_rwlock Reader-Writer Lock
+ * @{
+ */
+
+#ifdef RT_USING_RWLOCK
+/*
+ * reader-writer lock interface
+ */
+rt_err_t rt_rwlock_init(rt_rwlock_t rwlock, const char *name);
+rt_err_t rt_rwlock_detach(rt_rwlock_t rwlock);
+#ifdef RT_USING_HEAP
+rt_rwlock_t rt_rwlock_create(const char *name);
+rt_err_t rt_rwlock_delete(rt_rwlock_t rwlock);
+#endif /* RT_USING_HEAP */
+
+rt_err_t rt_rwlock_take_read(rt_rwlock_t rwlock, rt_int32_t timeout);
+rt_err_t rt_rwlock_take_write(rt_rwlock_t rwlock, rt_int32_t timeout);
+rt_err_t rt_rwlock_release(rt_rwlock_t rwlock);
+
+rt_inline rt_ubase_t rt_rwlock_get_readers(rt_rwlock_t rwlock)
+{
+    return (rt_ubase_t)rt_atomic_load(&rwlock->state) & RT_RWLOCK_READERS_MASK;
+}
+rt_inline rt_thread_t rt_rwlock_get_writer(rt_rwlock_t rwlock)
+{
+    return rwlock->writer;
+}
+#endif /* RT_USING_RWLOCK */
+
+/**@}*/
+
+/**
+ * @addtogroup group_seqlock Sequence Lock
+ * @{
+ */
+
+#ifdef RT_USING_SEQLOCK
+/*
+ * sequence lock interface
+ */
+rt_err_t rt_seqlock_init(rt_seqlock_t seqlock, const char *name);
+rt_err_t rt_seqlock_detach(rt_seqlock_t seqlock);
+#ifdef RT_USING_HEAP
+rt_seqlock_t rt_seqlock_create(const char *name);
+rt_err_t rt_seqlock_delete(rt_seqlock_t seqlock);
+#endif /* RT_USING_HEAP */
+
+rt_base_t rt_seqlock_write_begin(rt_seqlock_t seqlock);
+void rt_seqlock_write_end(rt_seqlock_t seqlock, rt_base_t level);
+rt_uint32_t rt_seqlock_read_begin(rt_seqlock_t seqlock);
+rt_bool_t rt_seqlock_read_retry(rt_seqlock_t seqlock, rt_uint32_t start);
+
+void rt_seqlock_write(rt_seqlock_t seqlock, void *shared, const void *data, rt_size_t size);
+rt_err_t rt_seqlock_read(rt_seqlock_t seqlock, void *data, const void *shared, rt_size_t size,
+                         rt_int32_t timeout);
+#endif /* RT_USING_SEQLOCK */
+
+/**@}*/
+
+/**
+ * @addtogroup group_futex Wait on Address
+ * @{
+ */
+
+#ifdef RT_USING_FUTEX
+/*
+ * wait-on-address interface
+ */
+void rt_system_futex_init(void);
+rt_err_t rt_futex_wait(volatile rt_atomic_t *addr, rt_atomic_t expected, rt_int32_t timeout);
+rt_uint32_t rt_futex_wake(volatile rt_atomic_t *addr, rt_uint32_t count);
+#endif /* RT_USING_FUTEX */
+
+/**@}*/
+
 /**
  * @addtogroup group_event Event
  * @{
@@ -650,6 +787,26 @@ rt_ssize_t rt_mq_recv_prio(rt_mq_t mq,
 
 /**@}*/
 
+#ifdef RT_USING_WORKPOOL
+/*
+ * thread pool interface
+ */
+rt_workpool_t rt_workpool_create(const char *name,
+                                 rt_uint8_t  worker_count,
+                                 rt_uint32_t stack_size,
+                                 rt_uint8_t  priority,
+                                 rt_uint32_t cpu_mask);
+rt_err_t rt_workpool_delete(rt_workpool_t pool);
+rt_err_t rt_workpool_submit(rt_workpool_t pool,
+                            struct rt_workpool_group *group,
+                            struct rt_workpool_task *task,
+                            void (*func)(void *parameter),
+                            void *parameter);
+rt_err_t rt_workpool_group_init(struct rt_workpool_group *group, const char *name);
+rt_err_t rt_workpool_group_detach(struct rt_workpool_group *group);
+rt_err_t rt_workpool_group_wait(rt_workpool_t pool, struct rt_workpool_group *group, rt_int32_t timeout);
+#endif /* RT_USING_WORKPOOL */
+
 /* defunct */
 void rt_thread_defunct_init(void);
 void rt_thread_defunct_enqueue(rt_thread_t thread);
@@ -767,6 +924,15 @@ void rt_interrupt_leave_sethook(void (*hook)(void));
 #ifdef RT_USING_COMPONENTS_INIT
 void rt_components_init(void);
 void rt_components_board_init(void);
+#ifdef RT_USING_INIT_TIMELINE
+void rt_components_timeline_record(const char *name, rt_uint64_t start, int result);
+rt_size_t rt_components_timeline(const struct rt_init_record **records);
+void rt_components_timeline_dump(void);
+#endif /* RT_USING_INIT_TIMELINE */
+#ifdef RT_USING_INIT_PARALLEL
+rt_err_t rt_components_tasks_run(const struct rt_init_task *tasks, rt_size_t count, rt_uint8_t workers);
+void rt_components_parallel_init(void);
+#endif /* RT_USING_INIT_PARALLEL */
 #endif /* RT_USING_COMPONENTS_INIT */
 
 /**
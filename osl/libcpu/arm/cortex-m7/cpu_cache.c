@@ -7,6 +7,7 @@
  * Date           Author       Notes
  * 2018-04-02     tanek        first implementation
  * 2019-04-27     misonyo      update to cortex-m7 series
+ * 2026-10-19     proyrb       clean the whole dcache for ranges larger than it
  */
 
 #include <rtthread.h>
@@ -68,12 +69,53 @@ rt_base_t rt_hw_cpu_dcache_status(void)
     return 0;
 }
 
+/* size of the L1 data cache, read once from the cache size id register */
+static rt_uint32_t _dcache_size(void)
+{
+    static rt_uint32_t dcache_size = 0;
+    rt_uint32_t ccsidr;
+
+    if (dcache_size == 0)
+    {
+        SCB->CSSELR = 0U;
+        __DSB();
+        ccsidr = SCB->CCSIDR;
+        dcache_size = (CCSIDR_SETS(ccsidr) + 1U) * (CCSIDR_WAYS(ccsidr) + 1U) * L1CACHE_LINESIZE_BYTE;
+    }
+
+    return dcache_size;
+}
+
 void rt_hw_cpu_dcache_ops(int ops, void* addr, int size)
 {
     rt_uint32_t startAddr = (rt_uint32_t)addr & (rt_uint32_t)~(L1CACHE_LINESIZE_BYTE - 1);
     rt_uint32_t size_byte = size + (rt_uint32_t)addr - startAddr;
     rt_uint32_t clean_invalid = RT_HW_CACHE_FLUSH | RT_HW_CACHE_INVALIDATE;
 
+    if (size <= 0)
+    {
+        return;
+    }
+
+    /*
+     * A range larger than the cache takes more operations by address than
+     * there are lines, walking the sets and ways is cheaper then. Cleaning
+     * other lines has no visible effect. Invalidating them would lose data,
+     * so a plain invalidate always goes by address.
+     */
+    if ((ops & RT_HW_CACHE_FLUSH) && size_byte > _dcache_size())
+    {
+        if (ops & RT_HW_CACHE_INVALIDATE)
+        {
+            SCB_CleanInvalidateDCache();
+        }
+        else
+        {
+            SCB_CleanDCache();
+        }
+        return;
+    }
+
     if ((ops & clean_invalid) == clean_invalid)
     {
         SCB_CleanInvalidateDCache_by_Addr((void *)startAddr, size_byte);
@@ -15,6 +15,7 @@
  * 2013-06-23     aozima       support lazy stack optimized.
  * 2018-07-24     aozima       enhancement hard fault exception handler.
  * 2019-07-03     yangjie      add __rt_ffs() for armclang.
+ * 2026-10-19     proyrb       add rt_hw_timestamp_us() on the DWT cycle counter.
  */
 
 #include <rtthread.h>
@@ -460,6 +461,55 @@ void rt_hw_cpu_reset(void)
     SCB_AIRCR = SCB_RESET_VALUE;
 }
 
+#ifdef RT_USING_INIT_TIMELINE
+#define DEMCR           (*(volatile unsigned long *)0xE000EDFC)  /* Debug Exception and Monitor Control Register */
+#define DEMCR_TRCENA    (1UL << 24)                              /* enables the DWT */
+#define DWT_CTRL        (*(volatile unsigned long *)0xE0001000)  /* DWT Control Register */
+#define DWT_CTRL_CYCCNTENA (1UL << 0)                            /* enables the cycle counter */
+#define DWT_CYCCNT      (*(volatile unsigned long *)0xE0001004)  /* DWT Cycle Count Register */
+#define DWT_LAR         (*(volatile unsigned long *)0xE0001FB0)  /* DWT Lock Access Register */
+#define DWT_LAR_KEY     0xC5ACCE55
+
+extern uint32_t SystemCoreClock;
+
+/**
+ * timestamp from the DWT cycle counter, it has to be read more often than
+ * it wraps (about 9 seconds at 480 MHz). Follows changes of the core clock.
+ */
+rt_uint64_t rt_hw_timestamp_us(void)
+{
+    static rt_uint64_t us;
+    static rt_uint32_t cycles, last;
+    rt_uint32_t now, mhz;
+    rt_base_t level;
+
+    level = rt_hw_interrupt_disable();
+
+    if (!(DWT_CTRL & DWT_CTRL_CYCCNTENA))
+    {
+        DEMCR |= DEMCR_TRCENA;
+        DWT_LAR = DWT_LAR_KEY;
+        DWT_CYCCNT = 0;
+        DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+        last = 0;
+    }
+
+    now = DWT_CYCCNT;
+    cycles += now - last;
+    last = now;
+
+    mhz = SystemCoreClock / 1000000;
+    if (mhz == 0)
+        mhz = 1;
+    us += cycles / mhz;
+    cycles %= mhz;
+
+    rt_hw_interrupt_enable(level);
+
+    return us;
+}
+#endif /* RT_USING_INIT_TIMELINE */
+
 #ifdef RT_USING_CPU_FFS
 /**
  * This function finds the first bit set (beginning with the least significant bit)
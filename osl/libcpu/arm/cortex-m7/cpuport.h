@@ -5,6 +5,7 @@
  *
  * Change Logs:
  * Date           Author       Notes
+ * 2026-10-19     proyrb       add memory barriers for the cache users
  */
 
 #ifndef  CPUPORT_H__
@@ -20,4 +21,10 @@ typedef union {
 } rt_hw_spinlock_t;
 #endif
 
+#ifdef RT_USING_CACHE
+#define rt_hw_isb()         __asm volatile ("isb 0xF" ::: "memory")
+#define rt_hw_dsb()         __asm volatile ("dsb 0xF" ::: "memory")
+#define rt_hw_dmb()         __asm volatile ("dmb 0xF" ::: "memory")
+#endif /* RT_USING_CACHE */
+
 #endif  /*CPUPORT_H__*/
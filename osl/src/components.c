@@ -16,6 +16,8 @@
  * 2015-07-29     Arda.Fu      Add support to use RT_USING_USER_MAIN with IAR
  * 2018-11-22     Jesven       Add secondary cpu boot up
  * 2023-09-15     xqyjlj       perf rt_hw_interrupt_disable/enable
+ * 2026-10-19     proyrb       initialize the wait-on-address table
+ * 2026-10-19     proyrb       add the boot timeline and parallel init tasks
  */
 
 #include <rthw.h>
@@ -78,6 +80,131 @@ static int rti_end(void)
 }
 INIT_EXPORT(rti_end, "6.end");
 
+#ifdef RT_USING_INIT_TIMELINE
+#ifndef RT_INIT_TIMELINE_MAX
+#define RT_INIT_TIMELINE_MAX            64
+#endif /* RT_INIT_TIMELINE_MAX */
+
+static struct rt_init_record _init_records[RT_INIT_TIMELINE_MAX];
+static rt_atomic_t _init_record_count;
+
+/**
+ * @brief  The time base of the boot timeline. A port should provide a free
+ *         running counter, the default has tick resolution and stands still
+ *         until the scheduler runs.
+ *
+ * @return Return the time in microseconds.
+ */
+rt_weak rt_uint64_t rt_hw_timestamp_us(void)
+{
+    return (rt_uint64_t)rt_tick_get() * 1000000u / RT_TICK_PER_SECOND;
+}
+
+static void _init_record(const char *name, init_fn_t fn, rt_uint64_t start, int result, rt_uint8_t worker)
+{
+    rt_uint64_t now = rt_hw_timestamp_us();
+    rt_atomic_t index;
+
+    index = rt_atomic_add(&_init_record_count, 1);
+    if (index >= RT_INIT_TIMELINE_MAX)
+        return;
+
+    _init_records[index].name = name;
+    _init_records[index].fn = fn;
+    _init_records[index].start = (rt_uint32_t)start;
+    _init_records[index].cost = (rt_uint32_t)(now - start);
+    _init_records[index].result = result;
+    _init_records[index].worker = worker;
+}
+
+/**
+ * @brief  Add a step to the boot timeline, for initialization that does not
+ *         go through INIT_*_EXPORT, e.g. board code before the scheduler.
+ *
+ * @param  name is the name of the step.
+ *
+ * @param  start is the time the step started, from rt_hw_timestamp_us().
+ *
+ * @param  result is the result of the step.
+ */
+void rt_components_timeline_record(const char *name, rt_uint64_t start, int result)
+{
+    _init_record(name, RT_NULL, start, result, 0);
+}
+
+/**
+ * @brief  Get the boot timeline.
+ *
+ * @param  records receives the records, in the order the functions finished.
+ *
+ * @return Return the number of records.
+ */
+rt_size_t rt_components_timeline(const struct rt_init_record **records)
+{
+    rt_size_t count = (rt_size_t)rt_atomic_load(&_init_record_count);
+
+    *records = _init_records;
+    return count < RT_INIT_TIMELINE_MAX ? count : RT_INIT_TIMELINE_MAX;
+}
+
+/**
+ * @brief  Print the boot timeline, with the start of every function relative
+ *         to the first one.
+ */
+void rt_components_timeline_dump(void)
+{
+    const struct rt_init_record *records;
+    rt_size_t count, index;
+    rt_uint32_t base, total = 0;
+
+    count = rt_components_timeline(&records);
+    if (count == 0)
+        return;
+
+    base = records[0].start;
+    for (index = 1; index < count; index++)
+    {
+        if ((rt_int32_t)(records[index].start - base) < 0)
+            base = records[index].start;
+    }
+
+    rt_kprintf("     start       cost  wk  result  function\n");
+    for (index = 0; index < count; index++)
+    {
+        const struct rt_init_record *record = &records[index];
+
+        rt_kprintf("%10u %10u  %2d  %6d  ", record->start - base, record->cost,
+                   record->worker, record->result);
+        if (record->name)
+            rt_kprintf("%s\n", record->name);
+        else
+            rt_kprintf("%p\n", record->fn);
+
+        if (record->start + record->cost - base > total)
+            total = record->start + record->cost - base;
+    }
+    if ((rt_size_t)rt_atomic_load(&_init_record_count) > count)
+        rt_kprintf("%d records dropped, raise RT_INIT_TIMELINE_MAX\n",
+                   (int)(rt_atomic_load(&_init_record_count) - count));
+    rt_kprintf("initialization took %u us\n", total);
+}
+MSH_CMD_EXPORT_ALIAS(rt_components_timeline_dump, init_timeline, show the boot timeline);
+
+static int _init_call(init_fn_t fn, const char *name, rt_uint8_t worker)
+{
+    rt_uint64_t start;
+    int result;
+
+    start = rt_hw_timestamp_us();
+    result = fn();
+    _init_record(name, fn, start, result, worker);
+
+    return result;
+}
+#else
+#define _init_call(fn, name, worker)    ((fn)())
+#endif /* RT_USING_INIT_TIMELINE */
+
 /**
  * @brief  Onboard components initialization. In this function, the board-level
  *         initialization function will be called to complete the initialization
@@ -91,7 +218,7 @@ void rt_components_board_init(void)
     for (desc = &__rt_init_desc_rti_board_start; desc < &__rt_init_desc_rti_board_end; desc ++)
     {
         rt_kprintf("initialize %s\n", desc->fn_name);
-        result = desc->fn();
+        result = _init_call(desc->fn, desc->fn_name, 0);
         rt_kprintf(":%d done\n", result);
     }
 #else
@@ -99,7 +226,7 @@ void rt_components_board_init(void)
 
     for (fn_ptr = &__rt_init_rti_board_start; fn_ptr < &__rt_init_rti_board_end; fn_ptr++)
     {
-        (*fn_ptr)();
+        _init_call(*fn_ptr, RT_NULL, 0);
     }
 #endif /* RT_DEBUGING_AUTO_INIT */
 }
@@ -117,7 +244,7 @@ void rt_components_init(void)
     for (desc = &__rt_init_desc_rti_board_end; desc < &__rt_init_desc_rti_end; desc ++)
     {
         rt_kprintf("initialize %s\n", desc->fn_name);
-        result = desc->fn();
+        result = _init_call(desc->fn, desc->fn_name, 0);
         rt_kprintf(":%d done\n", result);
     }
 #else
@@ -125,10 +252,277 @@ void rt_components_init(void)
 
     for (fn_ptr = &__rt_init_rti_board_end; fn_ptr < &__rt_init_rti_end; fn_ptr ++)
     {
-        (*fn_ptr)();
+        _init_call(*fn_ptr, RT_NULL, 0);
     }
 #endif /* RT_DEBUGING_AUTO_INIT */
 }
+
+#ifdef RT_USING_INIT_PARALLEL
+#ifndef RT_USING_HEAP
+#error "RT_USING_INIT_PARALLEL requires RT_USING_HEAP"
+#endif
+
+/* worker threads besides the calling one */
+#ifndef RT_INIT_PARALLEL_WORKERS
+#define RT_INIT_PARALLEL_WORKERS        2
+#endif /* RT_INIT_PARALLEL_WORKERS */
+
+#ifndef RT_INIT_PARALLEL_STACK_SIZE
+#define RT_INIT_PARALLEL_STACK_SIZE     2048
+#endif /* RT_INIT_PARALLEL_STACK_SIZE */
+
+static int rti_task_start(void)
+{
+    return 0;
+}
+rt_used static const struct rt_init_task __rt_init_task_rti_task_start rt_section(".rti_task.0") =
+    {"rti_task_start", rti_task_start, RT_NULL, 0};
+
+static int rti_task_end(void)
+{
+    return 0;
+}
+rt_used static const struct rt_init_task __rt_init_task_rti_task_end rt_section(".rti_task.1.end") =
+    {"rti_task_end", rti_task_end, RT_NULL, 0};
+
+struct _init_sched
+{
+    const struct rt_init_task *tasks;
+    rt_size_t count;
+    rt_uint16_t *pending;                   /* dependencies not done yet */
+    rt_uint16_t *queue;                     /* tasks ready to run */
+    rt_size_t head, tail;
+    rt_size_t left;                         /* tasks not done yet */
+    struct rt_spinlock lock;
+    struct rt_semaphore ready;              /* one per queued task, one per worker to quit */
+    struct rt_semaphore exited;
+    rt_atomic_t worker_id;
+    rt_uint8_t workers;
+};
+
+rt_inline rt_bool_t _init_task_depends(const struct rt_init_task *task, init_fn_t fn, rt_size_t *times)
+{
+    rt_size_t index;
+
+    *times = 0;
+    for (index = 0; index < task->dep_count; index++)
+    {
+        if (task->deps[index] == fn)
+            (*times)++;
+    }
+
+    return *times != 0;
+}
+
+/* count the dependencies on tasks of the table, others ran before already */
+static void _init_sched_prepare(struct _init_sched *sched)
+{
+    rt_size_t i, j, times;
+
+    for (i = 0; i < sched->count; i++)
+    {
+        sched->pending[i] = 0;
+        for (j = 0; j < sched->count; j++)
+        {
+            if (_init_task_depends(&sched->tasks[i], sched->tasks[j].fn, &times))
+                sched->pending[i] += times;
+        }
+    }
+}
+
+/* queue the tasks that only waited for index, under the lock */
+static rt_size_t _init_sched_release(struct _init_sched *sched, rt_size_t index)
+{
+    rt_size_t i, times, queued = 0;
+
+    for (i = 0; i < sched->count; i++)
+    {
+        if (!_init_task_depends(&sched->tasks[i], sched->tasks[index].fn, &times))
+            continue;
+
+        sched->pending[i] -= times;
+        if (sched->pending[i] == 0)
+        {
+            sched->queue[sched->tail++] = i;
+            queued++;
+        }
+    }
+
+    return queued;
+}
+
+/*
+ * Walk the graph once without running anything: the tasks never queued are
+ * on a cycle or behind one.
+ */
+static rt_size_t _init_sched_check(struct _init_sched *sched)
+{
+    rt_size_t i;
+
+    _init_sched_prepare(sched);
+    sched->head = sched->tail = 0;
+    for (i = 0; i < sched->count; i++)
+    {
+        if (sched->pending[i] == 0)
+            sched->queue[sched->tail++] = i;
+    }
+    while (sched->head < sched->tail)
+        _init_sched_release(sched, sched->queue[sched->head++]);
+
+    return sched->tail;
+}
+
+static void _init_sched_work(struct _init_sched *sched, rt_uint8_t worker)
+{
+    rt_size_t index, queued;
+    rt_bool_t finished;
+    rt_base_t level;
+
+    for (;;)
+    {
+        rt_sem_take(&sched->ready, RT_WAITING_FOREVER);
+
+        level = rt_spin_lock_irqsave(&sched->lock);
+        if (sched->head == sched->tail)
+        {
+            rt_spin_unlock_irqrestore(&sched->lock, level);
+            break;
+        }
+        index = sched->queue[sched->head++];
+        rt_spin_unlock_irqrestore(&sched->lock, level);
+
+        _init_call(sched->tasks[index].fn, sched->tasks[index].name, worker);
+
+        level = rt_spin_lock_irqsave(&sched->lock);
+        queued = _init_sched_release(sched, index);
+        finished = (--sched->left == 0);
+        rt_spin_unlock_irqrestore(&sched->lock, level);
+
+        while (queued--)
+            rt_sem_release(&sched->ready);
+
+        /* wake everybody to quit */
+        if (finished)
+        {
+            for (queued = 0; queued <= sched->workers; queued++)
+                rt_sem_release(&sched->ready);
+        }
+    }
+}
+
+static void _init_worker_entry(void *parameter)
+{
+    struct _init_sched *sched = (struct _init_sched *)parameter;
+
+    _init_sched_work(sched, (rt_uint8_t)rt_atomic_add(&sched->worker_id, 1));
+    rt_sem_release(&sched->exited);
+}
+
+/**
+ * @brief  Run initialization tasks, each one after the tasks it depends on
+ *         and as many at the same time as there are workers.
+ *
+ * @note   Dependencies on functions that are not in the table count as done.
+ *         Tasks on a dependency cycle, and the ones behind them, are run one
+ *         after the other at the end.
+ *
+ * @param  tasks is the table of tasks.
+ *
+ * @param  count is the number of tasks in the table.
+ *
+ * @param  workers is the number of worker threads besides the calling one.
+ *         With 0 the tasks run on the calling thread in dependency order.
+ *
+ * @return Return RT_EOK, -RT_ERROR if there were cycles or -RT_ENOMEM if the
+ *         tasks had to run in table order for lack of memory.
+ */
+rt_err_t rt_components_tasks_run(const struct rt_init_task *tasks, rt_size_t count, rt_uint8_t workers)
+{
+    struct _init_sched sched;
+    rt_size_t index, runnable;
+    rt_uint8_t started = 0;
+    rt_err_t ret = RT_EOK;
+
+    if (count == 0)
+        return RT_EOK;
+
+    sched.tasks = tasks;
+    sched.count = count;
+    sched.pending = (rt_uint16_t *)rt_malloc(2 * count * sizeof(rt_uint16_t));
+    if (sched.pending == RT_NULL)
+    {
+        for (index = 0; index < count; index++)
+            _init_call(tasks[index].fn, tasks[index].name, 0);
+        return -RT_ENOMEM;
+    }
+    sched.queue = sched.pending + count;
+
+    runnable = _init_sched_check(&sched);
+    if (runnable < count)
+        ret = -RT_ERROR;
+
+    _init_sched_prepare(&sched);
+    sched.head = sched.tail = 0;
+    for (index = 0; index < count; index++)
+    {
+        if (sched.pending[index] == 0)
+            sched.queue[sched.tail++] = index;
+    }
+    sched.left = runnable;
+    sched.workers = workers;
+    rt_atomic_store(&sched.worker_id, 1);
+    rt_spin_lock_init(&sched.lock);
+    rt_sem_init(&sched.ready, "rti_rdy", sched.tail, RT_IPC_FLAG_FIFO);
+    rt_sem_init(&sched.exited, "rti_exit", 0, RT_IPC_FLAG_FIFO);
+
+    if (runnable > 0)
+    {
+        for (started = 0; started < workers; started++)
+        {
+            rt_thread_t thread = rt_thread_create("rti_wk", _init_worker_entry, &sched,
+                                                  RT_INIT_PARALLEL_STACK_SIZE,
+                                                  RT_SCHED_PRIV(rt_thread_self()).current_priority, 10);
+            if (thread == RT_NULL)
+                break;
+            rt_thread_startup(thread);
+        }
+
+        /* the calling thread works as well, quit tokens for the ones not started are left over */
+        _init_sched_work(&sched, 0);
+        while (started--)
+            rt_sem_take(&sched.exited, RT_WAITING_FOREVER);
+    }
+
+    if (ret != RT_EOK)
+    {
+        for (index = 0; index < count; index++)
+        {
+            if (sched.pending[index] == 0)
+                continue;
+
+            rt_kprintf("init task %s: dependency cycle\n", tasks[index].name);
+            _init_call(tasks[index].fn, tasks[index].name, 0);
+        }
+    }
+
+    rt_sem_detach(&sched.exited);
+    rt_sem_detach(&sched.ready);
+    rt_free(sched.pending);
+
+    return ret;
+}
+
+/**
+ * @brief  Run the tasks of INIT_TASK_EXPORT() on RT_INIT_PARALLEL_WORKERS
+ *         worker threads, after the components initialization.
+ */
+void rt_components_parallel_init(void)
+{
+    const struct rt_init_task *tasks = &__rt_init_task_rti_task_start + 1;
+
+    rt_components_tasks_run(tasks, &__rt_init_task_rti_task_end - tasks, RT_INIT_PARALLEL_WORKERS);
+}
+#endif /* RT_USING_INIT_PARALLEL */
 #endif /* RT_USING_COMPONENTS_INIT */
 
 #ifdef RT_USING_USER_MAIN
@@ -191,6 +585,15 @@ static void main_thread_entry(void *parameter)
 #ifdef RT_USING_SMP
     rt_hw_secondary_cpu_up();
 #endif /* RT_USING_SMP */
+
+#if defined(RT_USING_COMPONENTS_INIT) && defined(RT_USING_INIT_PARALLEL)
+    /* independent initialization tasks, on all cores */
+    rt_components_parallel_init();
+#endif /* defined(RT_USING_COMPONENTS_INIT) && defined(RT_USING_INIT_PARALLEL) */
+
+#if defined(RT_USING_COMPONENTS_INIT) && defined(RT_USING_INIT_TIMELINE)
+    rt_components_timeline_dump();
+#endif /* defined(RT_USING_COMPONENTS_INIT) && defined(RT_USING_INIT_TIMELINE) */
     /* invoke system main function */
 #ifdef __ARMCC_VERSION
     {
@@ -261,6 +664,11 @@ int rtthread_startup(void)
     rt_system_signal_init();
 #endif /* RT_USING_SIGNALS */
 
+#ifdef RT_USING_FUTEX
+    /* wait-on-address table initialization */
+    rt_system_futex_init();
+#endif /* RT_USING_FUTEX */
+
     /* create init_thread */
     rt_application_init();
 
@@ -0,0 +1,504 @@
+/*
+ * Copyright (c) 2006-2026, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * File      : dmabuf.c
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-19     proyrb       first implementation, ownership tracked dma buffers
+ */
+
+#include <rthw.h>
+#include <rtthread.h>
+
+#ifdef RT_USING_DMA_BUF
+
+#ifndef RT_USING_HEAP
+#error "RT_USING_DMA_BUF requires RT_USING_HEAP"
+#endif
+
+#define DBG_TAG           "kernel.dmabuf"
+#define DBG_LVL           DBG_INFO
+#include <rtdbg.h>
+
+/*
+ * A dma buffer is owned either by the CPU or by a device. Handing it over is
+ * what triggers cache maintenance, and only the maintenance the direction of
+ * the device access needs:
+ *
+ *   to device, device reads     clean, so the device sees the CPU writes
+ *   to device, device writes    invalidate, so no dirty line is evicted over
+ *                               the data the device writes
+ *   to cpu, device wrote        invalidate, lines speculatively refilled while
+ *                               the device owned the buffer are dropped
+ *   to cpu, device only read    nothing
+ *
+ * Buffers start and end on cache lines, so maintenance never reaches into a
+ * neighbouring object. Buffers from the non-cacheable pool need no
+ * maintenance at all, only a barrier.
+ */
+
+#define DMA_LINE                RT_CPU_CACHE_LINE_SZ
+#define DMA_LINE_DOWN(addr)     ((rt_ubase_t)(addr) & ~(rt_ubase_t)(DMA_LINE - 1))
+#define DMA_LINE_UP(addr)       DMA_LINE_DOWN((rt_ubase_t)(addr) + DMA_LINE - 1)
+
+/* where the block behind a buffer came from */
+#define DMA_SOURCE_HEAP         0
+#define DMA_SOURCE_TIER         1
+#define DMA_SOURCE_POOL         2
+
+#ifdef RT_USING_MEMHEAP
+static struct rt_memheap _dma_pool;
+static rt_bool_t _dma_pool_attached = RT_FALSE;
+#endif /* RT_USING_MEMHEAP */
+
+static rt_atomic_t _dma_transfers = 0;
+static rt_atomic_t _dma_maint_calls = 0;
+static rt_atomic_t _dma_clean_lines = 0;
+static rt_atomic_t _dma_invalidate_lines = 0;
+static rt_atomic_t _dma_merged_ranges = 0;
+
+rt_inline rt_bool_t _dma_buf_cached(rt_dma_buf_t buf)
+{
+#ifdef RT_USING_CACHE
+    return buf->flags == RT_DMA_BUF_CACHED;
+#else
+    return RT_FALSE;
+#endif /* RT_USING_CACHE */
+}
+
+static void _dma_maint(rt_uint8_t ops, rt_ubase_t start, rt_ubase_t end)
+{
+    rt_size_t lines = (end - start) / DMA_LINE;
+
+    rt_hw_cpu_dcache_ops(ops, (void *)start, (int)(end - start));
+
+    rt_atomic_add(&_dma_maint_calls, 1);
+    if (ops & RT_HW_CACHE_FLUSH)
+        rt_atomic_add(&_dma_clean_lines, lines);
+    if (ops & RT_HW_CACHE_INVALIDATE)
+        rt_atomic_add(&_dma_invalidate_lines, lines);
+}
+
+static void _dma_queue(struct rt_dma_sync_batch *batch, rt_uint8_t ops,
+                       rt_ubase_t start, rt_ubase_t end)
+{
+    if (start >= end)
+        return;
+
+    if (batch == RT_NULL)
+    {
+        _dma_maint(ops, start, end);
+        return;
+    }
+
+    if (batch->count == RT_DMA_SYNC_BATCH_MAX)
+        rt_dma_sync_batch_commit(batch);
+
+    batch->range[batch->count].start = start;
+    batch->range[batch->count].end = end;
+    batch->range[batch->count].ops = ops;
+    batch->count++;
+}
+
+/**
+ * @brief   This function attaches the non-cacheable pool.
+ *
+ * @note    The board must have mapped the region non-cacheable, e.g. with an
+ *          MPU region, before buffers are taken from it. Only one pool can be
+ *          attached.
+ *
+ * @param   begin_addr is the start address of the region.
+ *
+ * @param   size is the size of the region.
+ *
+ * @return  RT_EOK on success, -RT_EBUSY if a pool is attached already and
+ *          -RT_ENOSYS without RT_USING_MEMHEAP.
+ */
+rt_err_t rt_dma_buf_pool_attach(void *begin_addr, rt_size_t size)
+{
+#ifdef RT_USING_MEMHEAP
+    RT_ASSERT(begin_addr != RT_NULL);
+
+    if (_dma_pool_attached)
+        return -RT_EBUSY;
+
+    rt_memheap_init(&_dma_pool, "dma_nc", begin_addr, size);
+    _dma_pool_attached = RT_TRUE;
+
+    LOG_D("non-cacheable pool: region 0x%08x, size %d", begin_addr, size);
+
+    return RT_EOK;
+#else
+    return -RT_ENOSYS;
+#endif /* RT_USING_MEMHEAP */
+}
+RTM_EXPORT(rt_dma_buf_pool_attach);
+
+/**
+ * @brief   This function removes the non-cacheable pool.
+ *
+ * @note    Buffers still allocated from the pool must not be used afterwards.
+ *
+ * @return  RT_EOK on success, -RT_EINVAL if no pool is attached.
+ */
+rt_err_t rt_dma_buf_pool_detach(void)
+{
+#ifdef RT_USING_MEMHEAP
+    if (!_dma_pool_attached)
+        return -RT_EINVAL;
+
+    _dma_pool_attached = RT_FALSE;
+    rt_memheap_detach(&_dma_pool);
+
+    return RT_EOK;
+#else
+    return -RT_EINVAL;
+#endif /* RT_USING_MEMHEAP */
+}
+RTM_EXPORT(rt_dma_buf_pool_detach);
+
+/**
+ * @brief   Allocate a dma buffer.
+ *
+ * @note    The buffer starts on a cache line and its size is rounded up to
+ *          whole cache lines. RT_DMA_BUF_UNCACHED takes it from the
+ *          non-cacheable pool; without a pool, or when the pool is exhausted,
+ *          a cacheable buffer is returned and buf->flags tells which one it
+ *          is. Cacheable buffers come from the dma tier when RT_USING_MEMTIER
+ *          is enabled, from the system heap otherwise.
+ *
+ * @param   buf is the buffer to fill in, it is owned by the CPU afterwards.
+ *
+ * @param   size is the minimum size of the buffer in bytes.
+ *
+ * @param   flags is RT_DMA_BUF_CACHED or RT_DMA_BUF_UNCACHED.
+ *
+ * @return  RT_EOK on success, -RT_EINVAL for a zero size and -RT_ENOMEM if no
+ *          memory is left.
+ */
+rt_err_t rt_dma_buf_alloc(rt_dma_buf_t buf, rt_size_t size, rt_uint8_t flags)
+{
+    void *raw = RT_NULL;
+    rt_uint8_t source = DMA_SOURCE_HEAP;
+
+    RT_ASSERT(buf != RT_NULL);
+
+    if (size == 0)
+        return -RT_EINVAL;
+    size = RT_ALIGN(size, DMA_LINE);
+
+#ifdef RT_USING_MEMHEAP
+    if ((flags & RT_DMA_BUF_UNCACHED) && _dma_pool_attached)
+    {
+        raw = rt_memheap_alloc(&_dma_pool, size + DMA_LINE - 1);
+        source = DMA_SOURCE_POOL;
+    }
+#endif /* RT_USING_MEMHEAP */
+
+#ifdef RT_USING_MEMTIER
+    if (raw == RT_NULL)
+    {
+        raw = rt_memtier_alloc(size + DMA_LINE - 1, RT_MEMTIER_DMA);
+        source = DMA_SOURCE_TIER;
+    }
+#endif /* RT_USING_MEMTIER */
+
+    if (raw == RT_NULL)
+    {
+        raw = rt_malloc(size + DMA_LINE - 1);
+        source = DMA_SOURCE_HEAP;
+    }
+
+    if (raw == RT_NULL)
+        return -RT_ENOMEM;
+
+    buf->raw = raw;
+    buf->addr = (void *)DMA_LINE_UP(raw);
+    buf->size = size;
+    buf->flags = (source == DMA_SOURCE_POOL) ? RT_DMA_BUF_UNCACHED : RT_DMA_BUF_CACHED;
+    buf->source = source;
+    buf->owner = RT_DMA_BUF_OWNER_CPU;
+    buf->dir = 0;
+    buf->offset = 0;
+    buf->length = 0;
+
+    return RT_EOK;
+}
+RTM_EXPORT(rt_dma_buf_alloc);
+
+/**
+ * @brief   Free a dma buffer.
+ *
+ * @param   buf is the buffer, it must be owned by the CPU.
+ */
+void rt_dma_buf_free(rt_dma_buf_t buf)
+{
+    RT_ASSERT(buf != RT_NULL);
+    RT_ASSERT(buf->owner == RT_DMA_BUF_OWNER_CPU);
+
+    if (buf->raw == RT_NULL)
+        return;
+
+    switch (buf->source)
+    {
+#ifdef RT_USING_MEMHEAP
+    case DMA_SOURCE_POOL:
+        rt_memheap_free(buf->raw);
+        break;
+#endif /* RT_USING_MEMHEAP */
+#ifdef RT_USING_MEMTIER
+    case DMA_SOURCE_TIER:
+        rt_memtier_free(buf->raw);
+        break;
+#endif /* RT_USING_MEMTIER */
+    default:
+        rt_free(buf->raw);
+        break;
+    }
+
+    buf->raw = RT_NULL;
+    buf->addr = RT_NULL;
+    buf->size = 0;
+}
+RTM_EXPORT(rt_dma_buf_free);
+
+/**
+ * @brief   Hand a dma buffer over to a device.
+ *
+ * @note    Until rt_dma_buf_to_cpu() the CPU must not touch the buffer, not
+ *          even the bytes outside the handed over range. With a batch the
+ *          maintenance is only queued, and the batch must be committed
+ *          before the device is started.
+ *
+ * @param   buf is the buffer, it must be owned by the CPU.
+ *
+ * @param   dir is RT_DMA_TO_DEVICE, RT_DMA_FROM_DEVICE or RT_DMA_BIDIRECTIONAL.
+ *
+ * @param   offset is the first byte the device accesses.
+ *
+ * @param   length is the number of bytes the device accesses, 0 for the rest
+ *          of the buffer.
+ *
+ * @param   batch collects the maintenance of several buffers, or RT_NULL to
+ *          issue it right away.
+ *
+ * @return  RT_EOK on success, -RT_EINVAL for a range outside the buffer and
+ *          -RT_EBUSY if a device owns the buffer already.
+ */
+rt_err_t rt_dma_buf_to_device(rt_dma_buf_t buf, rt_uint8_t dir, rt_size_t offset, rt_size_t length,
+                              struct rt_dma_sync_batch *batch)
+{
+    rt_ubase_t start, end, head, tail;
+
+    RT_ASSERT(buf != RT_NULL && buf->addr != RT_NULL);
+    RT_ASSERT(dir != 0 && (dir & ~RT_DMA_BIDIRECTIONAL) == 0);
+
+    if (offset >= buf->size || length > buf->size - offset)
+        return -RT_EINVAL;
+    if (length == 0)
+        length = buf->size - offset;
+
+    if (buf->owner != RT_DMA_BUF_OWNER_CPU)
+        return -RT_EBUSY;
+
+    buf->owner = RT_DMA_BUF_OWNER_DEVICE;
+    buf->dir = dir;
+    buf->offset = offset;
+    buf->length = length;
+    rt_atomic_add(&_dma_transfers, 1);
+
+    if (!_dma_buf_cached(buf))
+    {
+        /* the CPU writes must have reached the memory */
+        rt_hw_dsb();
+        return RT_EOK;
+    }
+
+    start = (rt_ubase_t)buf->addr + offset;
+    end = start + length;
+
+    if (dir & RT_DMA_TO_DEVICE)
+    {
+        /* a bidirectional buffer is invalidated when it comes back */
+        _dma_queue(batch, RT_HW_CACHE_FLUSH, DMA_LINE_DOWN(start), DMA_LINE_UP(end));
+        return RT_EOK;
+    }
+
+    /*
+     * Lines only partly covered by the range also hold CPU data of this
+     * buffer, they are written back before they are dropped.
+     */
+    head = DMA_LINE_DOWN(start);
+    tail = DMA_LINE_UP(end);
+    if (head != start)
+    {
+        _dma_queue(batch, RT_HW_CACHE_FLUSH | RT_HW_CACHE_INVALIDATE, head, head + DMA_LINE);
+        head += DMA_LINE;
+    }
+    if (tail != end && tail - DMA_LINE >= head)
+    {
+        tail -= DMA_LINE;
+        _dma_queue(batch, RT_HW_CACHE_FLUSH | RT_HW_CACHE_INVALIDATE, tail, tail + DMA_LINE);
+    }
+    _dma_queue(batch, RT_HW_CACHE_INVALIDATE, head, tail);
+
+    return RT_EOK;
+}
+RTM_EXPORT(rt_dma_buf_to_device);
+
+/**
+ * @brief   Take a dma buffer back from the device.
+ *
+ * @note    Call it after the device has finished. With a batch the buffer may
+ *          only be read once the batch is committed.
+ *
+ * @param   buf is the buffer, it must be owned by a device.
+ *
+ * @param   batch collects the maintenance of several buffers, or RT_NULL to
+ *          issue it right away.
+ *
+ * @return  RT_EOK on success, -RT_ERROR if the CPU owns the buffer already.
+ */
+rt_err_t rt_dma_buf_to_cpu(rt_dma_buf_t buf, struct rt_dma_sync_batch *batch)
+{
+    rt_ubase_t start;
+
+    RT_ASSERT(buf != RT_NULL && buf->addr != RT_NULL);
+
+    if (buf->owner != RT_DMA_BUF_OWNER_DEVICE)
+        return -RT_ERROR;
+
+    buf->owner = RT_DMA_BUF_OWNER_CPU;
+    rt_atomic_add(&_dma_transfers, 1);
+
+    if (!(buf->dir & RT_DMA_FROM_DEVICE))
+        return RT_EOK;
+
+    if (!_dma_buf_cached(buf))
+    {
+        /* no read may pass the completion of the device */
+        rt_hw_dmb();
+        return RT_EOK;
+    }
+
+    start = (rt_ubase_t)buf->addr + buf->offset;
+    _dma_queue(batch, RT_HW_CACHE_INVALIDATE, DMA_LINE_DOWN(start), DMA_LINE_UP(start + buf->length));
+
+    return RT_EOK;
+}
+RTM_EXPORT(rt_dma_buf_to_cpu);
+
+/**
+ * @brief   Initialize an empty batch of cache maintenance.
+ *
+ * @param   batch is the batch, usually on the stack of a driver.
+ */
+void rt_dma_sync_batch_init(struct rt_dma_sync_batch *batch)
+{
+    RT_ASSERT(batch != RT_NULL);
+
+    batch->count = 0;
+}
+RTM_EXPORT(rt_dma_sync_batch_init);
+
+/**
+ * @brief   Issue the cache maintenance queued in a batch and empty it.
+ *
+ * @details The queued ranges are cut at every range boundary. Each piece gets
+ *          the union of the operations of the ranges covering it, and
+ *          neighbouring pieces with the same operations are joined again.
+ *          So no line is maintained twice, and buffers lying next to each
+ *          other cost a single call into rt_hw_cpu_dcache_ops().
+ *
+ * @param   batch is the batch.
+ */
+void rt_dma_sync_batch_commit(struct rt_dma_sync_batch *batch)
+{
+    rt_ubase_t edge[RT_DMA_SYNC_BATCH_MAX * 2];
+    rt_ubase_t value, run_start = 0, run_end = 0;
+    rt_uint8_t ops, run_ops = 0;
+    rt_size_t issued = 0;
+    int count, i, j;
+
+    RT_ASSERT(batch != RT_NULL);
+
+    if (batch->count == 0)
+        return;
+
+    /* sorted boundaries, there are at most a handful */
+    count = 0;
+    for (i = 0; i < batch->count; i++)
+    {
+        edge[count++] = batch->range[i].start;
+        edge[count++] = batch->range[i].end;
+    }
+    for (i = 1; i < count; i++)
+    {
+        value = edge[i];
+        for (j = i; j > 0 && edge[j - 1] > value; j--)
+            edge[j] = edge[j - 1];
+        edge[j] = value;
+    }
+
+    for (i = 0; i + 1 < count; i++)
+    {
+        if (edge[i] == edge[i + 1])
+            continue;
+
+        ops = 0;
+        for (j = 0; j < batch->count; j++)
+        {
+            if (batch->range[j].start <= edge[i] && batch->range[j].end >= edge[i + 1])
+                ops |= batch->range[j].ops;
+        }
+
+        if (run_ops != 0 && (ops != run_ops || run_end != edge[i]))
+        {
+            _dma_maint(run_ops, run_start, run_end);
+            issued++;
+            run_ops = 0;
+        }
+        if (ops == 0)
+            continue;
+        if (run_ops == 0)
+        {
+            run_start = edge[i];
+            run_ops = ops;
+        }
+        run_end = edge[i + 1];
+    }
+    if (run_ops != 0)
+    {
+        _dma_maint(run_ops, run_start, run_end);
+        issued++;
+    }
+
+    if (issued < batch->count)
+        rt_atomic_add(&_dma_merged_ranges, batch->count - issued);
+    batch->count = 0;
+}
+RTM_EXPORT(rt_dma_sync_batch_commit);
+
+/**
+ * @brief   This function reports the cache maintenance done for dma buffers.
+ *
+ * @param   stat receives the counters since boot.
+ */
+void rt_dma_buf_get_stat(struct rt_dma_buf_stat *stat)
+{
+    RT_ASSERT(stat != RT_NULL);
+
+    stat->transfers = rt_atomic_load(&_dma_transfers);
+    stat->maint_calls = rt_atomic_load(&_dma_maint_calls);
+    stat->clean_lines = rt_atomic_load(&_dma_clean_lines);
+    stat->invalidate_lines = rt_atomic_load(&_dma_invalidate_lines);
+    stat->merged_ranges = rt_atomic_load(&_dma_merged_ranges);
+}
+RTM_EXPORT(rt_dma_buf_get_stat);
+
+#endif /* RT_USING_DMA_BUF */
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2006-2026, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-19     proyrb       first implementation of wait-on-address
+ */
+
+#include <rthw.h>
+#include <rtthread.h>
+
+#ifdef RT_USING_FUTEX
+
+#define DBG_TAG           "kernel.futex"
+#define DBG_LVL           DBG_INFO
+#include <rtdbg.h>
+
+/* number of hash buckets, a power of two */
+#ifndef RT_FUTEX_HASH_SIZE
+#define RT_FUTEX_HASH_SIZE      16
+#endif
+
+#if RT_FUTEX_HASH_SIZE < 2 || (RT_FUTEX_HASH_SIZE & (RT_FUTEX_HASH_SIZE - 1)) != 0
+#error "RT_FUTEX_HASH_SIZE must be a power of two"
+#endif
+
+/*
+ * A waiter lives on the stack of the waiting thread. It sits in the bucket
+ * of its address, ordered by priority, and keeps the thread on a suspend
+ * list of its own, so the thread timer can take the thread off as for any
+ * other IPC. Whoever unlinks the waiter from the bucket does so under the
+ * bucket lock, and the waiter does not return before it got that lock, so
+ * the stack frame stays valid while a waker looks at it.
+ */
+struct rt_futex_waiter
+{
+    rt_list_t node;                     /* in the bucket */
+    rt_list_t susp_list;                /* holds the waiting thread */
+    volatile rt_atomic_t *addr;
+    struct rt_thread *thread;
+};
+
+struct rt_futex_bucket
+{
+    struct rt_spinlock lock;
+    rt_list_t waiters;
+};
+
+static struct rt_futex_bucket _futex_table[RT_FUTEX_HASH_SIZE];
+
+rt_inline struct rt_futex_bucket *_futex_bucket(volatile rt_atomic_t *addr)
+{
+    rt_uint32_t key = (rt_uint32_t)((rt_uintptr_t)addr / sizeof(rt_atomic_t));
+
+    /* Fibonacci hashing, neighbouring words end up in different buckets */
+    key *= 0x9E3779B9u;
+    return &_futex_table[key >> (33 - __rt_ffs(RT_FUTEX_HASH_SIZE))];
+}
+
+static void _futex_enqueue(struct rt_futex_bucket *bucket, struct rt_futex_waiter *waiter)
+{
+    struct rt_futex_waiter *iter;
+    rt_uint8_t priority;
+
+    priority = rt_sched_thread_get_curr_prio(waiter->thread);
+    rt_list_for_each_entry(iter, &bucket->waiters, node)
+    {
+        if (priority < rt_sched_thread_get_curr_prio(iter->thread))
+        {
+            rt_list_insert_before(&iter->node, &waiter->node);
+            return;
+        }
+    }
+
+    rt_list_insert_before(&bucket->waiters, &waiter->node);
+}
+
+/**
+ * @brief    This function will initialize the wait-on-address table.
+ *
+ * @note     It is called once during system startup.
+ */
+void rt_system_futex_init(void)
+{
+    int index;
+
+    for (index = 0; index < RT_FUTEX_HASH_SIZE; index++)
+    {
+        rt_spin_lock_init(&_futex_table[index].lock);
+        rt_list_init(&_futex_table[index].waiters);
+    }
+}
+
+/**
+ * @brief    This function will block the calling thread as long as a word keeps a value.
+ *
+ * @note     The word is compared and the thread queued atomically with respect to rt_futex_wake(), so a
+ *           wake-up after the change of the word is never lost. Like every futex, the caller has to check
+ *           the word again on return: a wake-up may have been meant for another value.
+ *
+ * @param    addr is the address of the word.
+ *
+ * @param    expected is the value the word has to keep for the thread to sleep.
+ *
+ * @param    timeout is a timeout period (unit: an OS tick), RT_WAITING_NO or RT_WAITING_FOREVER.
+ *
+ * @return   Return the operation status. RT_EOK when woken by rt_futex_wake(), -RT_EBUSY if the word did not
+ *           hold the expected value, -RT_ETIMEOUT if the timeout expired.
+ *
+ * @warning  This function can ONLY be called in the thread context.
+ */
+rt_err_t rt_futex_wait(volatile rt_atomic_t *addr, rt_atomic_t expected, rt_int32_t timeout)
+{
+    struct rt_futex_bucket *bucket;
+    struct rt_futex_waiter waiter;
+    rt_base_t level;
+    rt_err_t ret;
+
+    RT_ASSERT(addr != RT_NULL);
+
+    /* current context checking */
+    RT_DEBUG_SCHEDULER_AVAILABLE(1);
+
+    bucket = _futex_bucket(addr);
+    level = rt_spin_lock_irqsave(&bucket->lock);
+
+    if (rt_atomic_load(addr) != expected)
+    {
+        rt_spin_unlock_irqrestore(&bucket->lock, level);
+        return -RT_EBUSY;
+    }
+
+    if (timeout == 0)
+    {
+        rt_spin_unlock_irqrestore(&bucket->lock, level);
+        return -RT_ETIMEOUT;
+    }
+
+    waiter.addr = addr;
+    waiter.thread = rt_thread_self();
+    rt_list_init(&waiter.susp_list);
+
+    waiter.thread->error = RT_EINTR;
+    ret = rt_thread_suspend_to_list(waiter.thread, &waiter.susp_list, RT_IPC_FLAG_FIFO, RT_UNINTERRUPTIBLE);
+    if (ret != RT_EOK)
+    {
+        rt_spin_unlock_irqrestore(&bucket->lock, level);
+        return ret;
+    }
+    _futex_enqueue(bucket, &waiter);
+
+    if (timeout > 0)
+    {
+        rt_tick_t timeout_tick = timeout;
+
+        rt_timer_control(&(waiter.thread->thread_timer), RT_TIMER_CTRL_SET_TIME, &timeout_tick);
+        rt_timer_start(&(waiter.thread->thread_timer));
+    }
+
+    rt_spin_unlock_irqrestore(&bucket->lock, level);
+
+    rt_schedule();
+
+    /* timed out: still in the bucket */
+    level = rt_spin_lock_irqsave(&bucket->lock);
+    if (!rt_list_isempty(&waiter.node))
+        rt_list_remove(&waiter.node);
+    rt_spin_unlock_irqrestore(&bucket->lock, level);
+
+    ret = waiter.thread->error;
+    if (ret != RT_EOK)
+        return ret > 0 ? -ret : ret;
+
+    return RT_EOK;
+}
+RTM_EXPORT(rt_futex_wait);
+
+/**
+ * @brief    This function will wake threads waiting on a word.
+ *
+ * @note     Threads are woken in priority order. Change the word before calling it. The cost without waiters
+ *           is one bucket lock, so callers usually track contention in the word and skip the call when there
+ *           was none.
+ *
+ * @param    addr is the address of the word.
+ *
+ * @param    count is the maximum number of threads to wake, RT_FUTEX_WAKE_ALL for all of them.
+ *
+ * @return   Return the number of threads woken.
+ */
+rt_uint32_t rt_futex_wake(volatile rt_atomic_t *addr, rt_uint32_t count)
+{
+    struct rt_futex_bucket *bucket;
+    struct rt_futex_waiter *waiter, *next;
+    rt_uint32_t woken = 0;
+    rt_base_t level;
+
+    RT_ASSERT(addr != RT_NULL);
+
+    bucket = _futex_bucket(addr);
+    level = rt_spin_lock_irqsave(&bucket->lock);
+
+    rt_list_for_each_entry_safe(waiter, next, &bucket->waiters, node)
+    {
+        if (woken >= count)
+            break;
+        if (waiter->addr != addr)
+            continue;
+
+        rt_list_remove(&waiter->node);
+
+        /* nobody to resume if its timer was faster */
+        if (rt_susp_list_dequeue(&waiter->susp_list, RT_EOK) != RT_NULL)
+            woken++;
+    }
+
+    rt_spin_unlock_irqrestore(&bucket->lock, level);
+
+    if (woken)
+        rt_schedule();
+
+    return woken;
+}
+RTM_EXPORT(rt_futex_wake);
+
+#endif /* RT_USING_FUTEX */
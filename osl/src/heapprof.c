@@ -0,0 +1,572 @@
+/*
+ * Copyright (c) 2006-2026, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * File      : heapprof.c
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-19     proyrb       first implementation, call site attribution over heap hooks
+ */
+
+#include <rthw.h>
+#include <rtthread.h>
+
+#ifdef RT_USING_HEAPPROF
+
+#if !defined(RT_USING_HEAP) || !defined(RT_USING_HOOK)
+#error "RT_USING_HEAPPROF requires RT_USING_HEAP and RT_USING_HOOK"
+#endif
+
+#define DBG_TAG           "kernel.heapprof"
+#define DBG_LVL           DBG_INFO
+#include <rtdbg.h>
+
+/* number of distinct call sites, one more slot collects the rest */
+#ifndef RT_HEAPPROF_SITE_MAX
+#define RT_HEAPPROF_SITE_MAX        64
+#endif
+
+/* number of live blocks that can be tracked, must be a power of two */
+#ifndef RT_HEAPPROF_LIVE_MAX
+#define RT_HEAPPROF_LIVE_MAX        512
+#endif
+
+/* frames between the heap hook and the caller of rt_malloc */
+#ifndef RT_HEAPPROF_BACKTRACE_SKIP
+#define RT_HEAPPROF_BACKTRACE_SKIP  2
+#endif
+
+#if (RT_HEAPPROF_LIVE_MAX & (RT_HEAPPROF_LIVE_MAX - 1)) != 0
+#error "RT_HEAPPROF_LIVE_MAX must be a power of two"
+#endif
+
+#define SITE_SLOTS          (RT_HEAPPROF_SITE_MAX + 1)
+#define SITE_OTHER          RT_HEAPPROF_SITE_MAX
+#define LIVE_MASK           (RT_HEAPPROF_LIVE_MAX - 1)
+
+/* a call site, the public record plus the hash of its key */
+struct heapprof_site
+{
+    struct rt_heapprof_site info;
+    rt_uint32_t hash;
+    rt_bool_t used;
+};
+
+/* a live block, keyed by its address */
+struct heapprof_live
+{
+    void *ptr;
+    rt_size_t size;
+    rt_uint16_t site;
+};
+
+static struct heapprof_site _sites[SITE_SLOTS];
+static struct heapprof_live _live[RT_HEAPPROF_LIVE_MAX];
+static rt_size_t _untracked;
+static rt_tick_t _start_tick;
+static rt_bool_t _running;
+static RT_DEFINE_SPINLOCK(_heapprof_lock);
+
+rt_inline rt_uint32_t _hash_mix(rt_uint32_t hash, rt_ubase_t value)
+{
+    /* FNV-1a over the bytes of the value */
+    int i;
+
+    for (i = 0; i < (int)sizeof(value); i++)
+    {
+        hash ^= (rt_uint8_t)(value >> (i * 8));
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+rt_inline rt_uint32_t _live_index(void *ptr)
+{
+    rt_uintptr_t addr = (rt_uintptr_t)ptr / RT_ALIGN_SIZE;
+
+    return (rt_uint32_t)(addr * 2654435761u) & LIVE_MASK;
+}
+
+/* build the key of the current call site */
+static rt_uint32_t _site_key(struct rt_heapprof_site *key)
+{
+    rt_thread_t thread = RT_NULL;
+    rt_uint32_t hash = 2166136261u;
+    int i;
+
+    rt_memset(key, 0, sizeof(*key));
+
+    if (rt_interrupt_get_nest() != 0)
+        key->tag = "isr";
+    else if ((thread = rt_thread_self()) == RT_NULL)
+        key->tag = "init";
+    else if (thread->heapprof_tag != RT_NULL)
+        key->tag = thread->heapprof_tag;
+    else
+    {
+#ifdef RT_HEAPPROF_USING_BACKTRACE
+        rt_backtrace_to_buffer(thread, RT_NULL, RT_HEAPPROF_BACKTRACE_SKIP,
+                               key->frames, RT_HEAPPROF_DEPTH);
+#endif /* RT_HEAPPROF_USING_BACKTRACE */
+        if (key->frames[0] == 0)
+            rt_strncpy(key->thread, thread->parent.name, RT_NAME_MAX);
+    }
+
+    hash = _hash_mix(hash, (rt_ubase_t)key->tag);
+    for (i = 0; i < RT_HEAPPROF_DEPTH; i++)
+        hash = _hash_mix(hash, key->frames[i]);
+    for (i = 0; i < RT_NAME_MAX && key->thread[i] != '\0'; i++)
+        hash = (hash ^ (rt_uint8_t)key->thread[i]) * 16777619u;
+
+    return hash;
+}
+
+rt_inline rt_bool_t _site_match(struct heapprof_site *site, struct rt_heapprof_site *key,
+                                rt_uint32_t hash)
+{
+    return site->hash == hash && site->info.tag == key->tag &&
+           rt_memcmp(site->info.frames, key->frames, sizeof(key->frames)) == 0 &&
+           rt_strncmp(site->info.thread, key->thread, RT_NAME_MAX) == 0;
+}
+
+/* find or create the site of a key, called with the lock held */
+static rt_uint16_t _site_lookup(struct rt_heapprof_site *key, rt_uint32_t hash)
+{
+    rt_uint32_t index = hash % RT_HEAPPROF_SITE_MAX;
+    int probe;
+
+    for (probe = 0; probe < RT_HEAPPROF_SITE_MAX; probe++)
+    {
+        struct heapprof_site *site = &_sites[index];
+
+        if (!site->used)
+        {
+            site->info = *key;
+            site->hash = hash;
+            site->used = RT_TRUE;
+            return (rt_uint16_t)index;
+        }
+        if (_site_match(site, key, hash))
+            return (rt_uint16_t)index;
+
+        index = (index + 1) % RT_HEAPPROF_SITE_MAX;
+    }
+
+    return SITE_OTHER;
+}
+
+/* called with the lock held, returns RT_FALSE if the table is full */
+static rt_bool_t _live_insert(void *ptr, rt_size_t size, rt_uint16_t site)
+{
+    rt_uint32_t index = _live_index(ptr);
+    int probe;
+
+    for (probe = 0; probe < RT_HEAPPROF_LIVE_MAX; probe++)
+    {
+        if (_live[index].ptr == RT_NULL)
+        {
+            _live[index].ptr  = ptr;
+            _live[index].size = size;
+            _live[index].site = site;
+            return RT_TRUE;
+        }
+        index = (index + 1) & LIVE_MASK;
+    }
+
+    _untracked++;
+    return RT_FALSE;
+}
+
+/* called with the lock held, returns RT_FALSE if the block is unknown */
+static rt_bool_t _live_remove(void *ptr, struct heapprof_live *removed)
+{
+    rt_uint32_t index = _live_index(ptr);
+    rt_uint32_t next, home;
+    int probe;
+
+    for (probe = 0; probe < RT_HEAPPROF_LIVE_MAX; probe++)
+    {
+        if (_live[index].ptr == RT_NULL)
+            return RT_FALSE;
+        if (_live[index].ptr == ptr)
+            break;
+        index = (index + 1) & LIVE_MASK;
+    }
+    if (probe == RT_HEAPPROF_LIVE_MAX)
+        return RT_FALSE;
+
+    *removed = _live[index];
+
+    /* backward shift deletion keeps the probe chains intact without tombstones */
+    next = (index + 1) & LIVE_MASK;
+    while (_live[next].ptr != RT_NULL)
+    {
+        home = _live_index(_live[next].ptr);
+        if (((next - home) & LIVE_MASK) >= ((next - index) & LIVE_MASK))
+        {
+            _live[index] = _live[next];
+            index = next;
+        }
+        next = (next + 1) & LIVE_MASK;
+    }
+    _live[index].ptr = RT_NULL;
+
+    return RT_TRUE;
+}
+
+static void _heapprof_record_alloc(void *ptr, rt_size_t size)
+{
+    struct rt_heapprof_site key;
+    struct rt_heapprof_site *info;
+    rt_uint32_t hash;
+    rt_uint16_t site;
+    rt_base_t level;
+
+    /* the key is built outside of the lock, unwinding may be slow */
+    hash = _site_key(&key);
+
+    level = rt_spin_lock_irqsave(&_heapprof_lock);
+    if (!_running)
+    {
+        rt_spin_unlock_irqrestore(&_heapprof_lock, level);
+        return;
+    }
+
+    site = _site_lookup(&key, hash);
+    info = &_sites[site].info;
+    if (ptr == RT_NULL)
+    {
+        info->fail_count++;
+    }
+    else
+    {
+        info->alloc_count++;
+        info->alloc_bytes += size;
+        /* blocks that can not be tracked would never leave the live count */
+        if (_live_insert(ptr, size, site))
+        {
+            info->live_count++;
+            info->live_bytes += size;
+            if (info->live_bytes > info->peak_bytes)
+                info->peak_bytes = info->live_bytes;
+        }
+    }
+    rt_spin_unlock_irqrestore(&_heapprof_lock, level);
+}
+
+static void _heapprof_record_free(void *ptr)
+{
+    struct heapprof_live removed;
+    struct rt_heapprof_site *info;
+    rt_base_t level;
+
+    if (ptr == RT_NULL)
+        return;
+
+    level = rt_spin_lock_irqsave(&_heapprof_lock);
+    if (_running && _live_remove(ptr, &removed))
+    {
+        info = &_sites[removed.site].info;
+        info->live_count--;
+        info->live_bytes -= removed.size;
+    }
+    rt_spin_unlock_irqrestore(&_heapprof_lock, level);
+}
+
+static void _heapprof_malloc_hook(void **ptr, rt_size_t size)
+{
+    _heapprof_record_alloc(*ptr, size);
+}
+
+static void _heapprof_free_hook(void **ptr)
+{
+    _heapprof_record_free(*ptr);
+}
+
+/*
+ * A reallocation is accounted as a free of the old block followed by an
+ * allocation of the new one. When the heap can not grow the block the old
+ * one stays valid but is no longer tracked, its later release is ignored.
+ */
+static void _heapprof_realloc_entry_hook(void **ptr, rt_size_t size)
+{
+    _heapprof_record_free(*ptr);
+}
+
+static void _heapprof_realloc_exit_hook(void **ptr, rt_size_t size)
+{
+    if (size != 0)
+        _heapprof_record_alloc(*ptr, size);
+}
+
+/**
+ * @brief   This function clears all call sites and live blocks.
+ *
+ * @note    Blocks allocated before the reset are not known afterwards and
+ *          their release does not change the statistics.
+ */
+void rt_heapprof_reset(void)
+{
+    rt_base_t level;
+
+    level = rt_spin_lock_irqsave(&_heapprof_lock);
+    rt_memset(_sites, 0, sizeof(_sites));
+    rt_memset(_live, 0, sizeof(_live));
+    _sites[SITE_OTHER].info.tag = "(other)";
+    _sites[SITE_OTHER].used = RT_TRUE;
+    _untracked = 0;
+    _start_tick = rt_tick_get();
+    rt_spin_unlock_irqrestore(&_heapprof_lock, level);
+}
+RTM_EXPORT(rt_heapprof_reset);
+
+/**
+ * @brief   This function starts attributing heap usage to call sites.
+ *
+ * @note    The profiler installs itself on the malloc, free and realloc hooks
+ *          of the system heap, so it can not run together with another user
+ *          of those hooks.
+ *
+ * @return  RT_EOK on success, -RT_EBUSY if it is already running.
+ */
+rt_err_t rt_heapprof_start(void)
+{
+    if (_running)
+        return -RT_EBUSY;
+
+    rt_heapprof_reset();
+    _running = RT_TRUE;
+
+    rt_malloc_sethook(_heapprof_malloc_hook);
+    rt_free_sethook(_heapprof_free_hook);
+    rt_realloc_set_entry_hook(_heapprof_realloc_entry_hook);
+    rt_realloc_set_exit_hook(_heapprof_realloc_exit_hook);
+
+    return RT_EOK;
+}
+RTM_EXPORT(rt_heapprof_start);
+
+/**
+ * @brief   This function stops the profiler, the collected data is kept.
+ */
+void rt_heapprof_stop(void)
+{
+    rt_base_t level;
+
+    rt_malloc_sethook(RT_NULL);
+    rt_free_sethook(RT_NULL);
+    rt_realloc_set_entry_hook(RT_NULL);
+    rt_realloc_set_exit_hook(RT_NULL);
+
+    level = rt_spin_lock_irqsave(&_heapprof_lock);
+    _running = RT_FALSE;
+    rt_spin_unlock_irqrestore(&_heapprof_lock, level);
+}
+RTM_EXPORT(rt_heapprof_stop);
+
+/**
+ * @brief   This function tags the allocations of the current thread.
+ *
+ * @note    A tag takes precedence over the return address, so it is the way to
+ *          attribute allocations on targets without a stack unwinder. The
+ *          string must stay valid while the profiler holds data.
+ *
+ * @param   tag is the new tag, or RT_NULL to remove it.
+ *
+ * @return  the previous tag, to be restored by the caller.
+ */
+const char *rt_heapprof_tag_set(const char *tag)
+{
+    rt_thread_t thread = rt_thread_self();
+    const char *old;
+
+    if (thread == RT_NULL)
+        return RT_NULL;
+
+    old = thread->heapprof_tag;
+    thread->heapprof_tag = tag;
+
+    return old;
+}
+RTM_EXPORT(rt_heapprof_tag_set);
+
+/**
+ * @brief   This function copies the heaviest call sites.
+ *
+ * @param   sites is the buffer to fill, ordered by live bytes descending.
+ *
+ * @param   count is the number of entries in the buffer.
+ *
+ * @param   elapsed is set to the ticks since the profiler was reset, may be RT_NULL.
+ *
+ * @return  the number of entries written.
+ */
+rt_size_t rt_heapprof_snapshot(struct rt_heapprof_site *sites, rt_size_t count, rt_tick_t *elapsed)
+{
+    rt_size_t filled = 0;
+    rt_size_t pos;
+    rt_base_t level;
+    int index;
+
+    RT_ASSERT(sites != RT_NULL || count == 0);
+
+    level = rt_spin_lock_irqsave(&_heapprof_lock);
+    for (index = 0; index < SITE_SLOTS; index++)
+    {
+        struct rt_heapprof_site *info = &_sites[index].info;
+
+        if (!_sites[index].used || (info->alloc_count == 0 && info->fail_count == 0))
+            continue;
+
+        /* insertion into the sorted top list */
+        pos = filled;
+        while (pos > 0 && sites[pos - 1].live_bytes < info->live_bytes)
+            pos--;
+        if (pos >= count)
+            continue;
+        if (filled < count)
+            filled++;
+        rt_memmove(&sites[pos + 1], &sites[pos], (filled - pos - 1) * sizeof(*sites));
+        sites[pos] = *info;
+    }
+    if (elapsed != RT_NULL)
+        *elapsed = rt_tick_get_delta(_start_tick);
+    rt_spin_unlock_irqrestore(&_heapprof_lock, level);
+
+    return filled;
+}
+RTM_EXPORT(rt_heapprof_snapshot);
+
+static void _heapprof_print_site(struct rt_heapprof_site *site, const char *sep)
+{
+    const char *lead = "";
+    int i;
+
+    if (site->tag != RT_NULL)
+    {
+        rt_kprintf("%s", site->tag);
+        lead = sep;
+    }
+    else if (site->frames[0] == 0)
+    {
+        rt_kprintf("%.*s", RT_NAME_MAX, site->thread);
+        lead = sep;
+    }
+
+    /* outermost caller first, the order flame graph tools expect */
+    for (i = RT_HEAPPROF_DEPTH - 1; i >= 0; i--)
+    {
+        if (site->frames[i] == 0)
+            continue;
+        rt_kprintf("%s0x%08lx", lead, (unsigned long)site->frames[i]);
+        lead = sep;
+    }
+}
+
+/**
+ * @brief   This function prints the heaviest call sites on the console.
+ *
+ * @param   count is the number of sites to print.
+ *
+ * @param   folded selects the folded stack format read by the host script
+ *          and flame graph tools instead of the table.
+ */
+void rt_heapprof_dump(rt_size_t count, rt_bool_t folded)
+{
+    struct rt_heapprof_site *sites;
+    const char *tag;
+    rt_size_t index, filled;
+    rt_tick_t elapsed;
+
+    if (count > SITE_SLOTS)
+        count = SITE_SLOTS;
+
+    /* the report buffer shows up as a site of its own */
+    tag = rt_heapprof_tag_set("heapprof");
+    sites = (struct rt_heapprof_site *)rt_malloc(sizeof(*sites) * count);
+    rt_heapprof_tag_set(tag);
+    if (sites == RT_NULL)
+    {
+        LOG_E("no memory for %d sites", count);
+        return;
+    }
+
+    filled = rt_heapprof_snapshot(sites, count, &elapsed);
+    if (folded)
+    {
+        rt_kprintf("# heapprof ticks=%d hz=%d untracked=%d\n", elapsed, RT_TICK_PER_SECOND, _untracked);
+    }
+    else
+    {
+        rt_kprintf("elapsed %d ticks, %d untracked blocks\n", elapsed, _untracked);
+        rt_kprintf("live       peak       count    allocs   bytes      fails site\n");
+        rt_kprintf("---------- ---------- -------- -------- ---------- ----- ----\n");
+    }
+
+    for (index = 0; index < filled; index++)
+    {
+        struct rt_heapprof_site *site = &sites[index];
+
+        if (folded)
+        {
+            _heapprof_print_site(site, ";");
+            rt_kprintf(" %d %d %d\n", site->live_bytes, site->alloc_count, site->alloc_bytes);
+        }
+        else
+        {
+            rt_kprintf("%-10d %-10d %-8d %-8d %-10d %-5d ",
+                       site->live_bytes, site->peak_bytes, site->live_count,
+                       site->alloc_count, site->alloc_bytes, site->fail_count);
+            _heapprof_print_site(site, " <- ");
+            rt_kprintf("\n");
+        }
+    }
+
+    tag = rt_heapprof_tag_set("heapprof");
+    rt_free(sites);
+    rt_heapprof_tag_set(tag);
+}
+RTM_EXPORT(rt_heapprof_dump);
+
+#ifdef RT_USING_FINSH
+#include <stdlib.h>
+
+static int heapprof(int argc, char *argv[])
+{
+    rt_size_t count = 10;
+
+    if (argc < 2)
+        goto _usage;
+
+    if (argc > 2)
+        count = atoi(argv[2]);
+
+    if (!rt_strcmp(argv[1], "start"))
+    {
+        if (rt_heapprof_start() != RT_EOK)
+            rt_kprintf("heap profiler is already running\n");
+    }
+    else if (!rt_strcmp(argv[1], "stop"))
+        rt_heapprof_stop();
+    else if (!rt_strcmp(argv[1], "reset"))
+        rt_heapprof_reset();
+    else if (!rt_strcmp(argv[1], "top"))
+        rt_heapprof_dump(count, RT_FALSE);
+    else if (!rt_strcmp(argv[1], "dump"))
+        rt_heapprof_dump(SITE_SLOTS, RT_TRUE);
+    else
+        goto _usage;
+
+    return 0;
+
+_usage:
+    rt_kprintf("Usage: heapprof start|stop|reset|top [n]|dump\n");
+    return -1;
+}
+MSH_CMD_EXPORT(heapprof, profile heap usage by call site);
+#endif /* RT_USING_FINSH */
+#endif /* RT_USING_HEAPPROF */
@@ -46,6 +46,9 @@
  * 2022-10-16     Bernard      add prioceiling feature in mutex
  * 2023-04-16     Xin-zheqi    redesigen queue recv and send function return real message size
  * 2023-09-15     xqyjlj       perf rt_hw_interrupt_disable/enable
+ * 2026-10-19     proyrb       index event waiters by bit with RT_EVENT_USING_WAITER_INDEX
+ * 2026-10-19     proyrb       add reader-writer lock and sequence lock
+ * 2026-10-19     proyrb       index priority ordered suspend lists with RT_USING_IPC_PRIO_INDEX
  */
 
 #include <rtthread.h>
@@ -228,6 +231,98 @@ rt_err_t rt_susp_list_resume_all_irq(rt_list_t *susp_list,
     return RT_EOK;
 }
 
+#ifdef RT_USING_IPC_PRIO_INDEX
+/*
+ * The first waiter of each priority on an indexed list is a run head. The run
+ * heads are linked in priority order through susp_run, so a new waiter only
+ * steps over the priorities ahead of it, not over every waiter. The links live
+ * in the waiters and each waiter unlinks itself when it leaves the list, so
+ * nothing refers to a thread once it is off the list.
+ *
+ * Inserting is O(distinct priorities ahead of the new waiter), not O(1). It
+ * pays off when many waiters share a few priorities; with every waiter at its
+ * own priority it walks as far as the plain sorted insert. Removing is O(1).
+ */
+#define _SUSP_RUN_ENTRY(node)   rt_list_entry(node, struct rt_thread, susp_run)
+
+/* whether node is a waiter queued on susp_list with the index at priority */
+rt_inline rt_bool_t _susp_same_run(rt_list_t *susp_list, rt_list_t *node, rt_uint8_t priority)
+{
+    struct rt_thread *thread;
+
+    if (node == susp_list)
+        return RT_FALSE;
+
+    thread = RT_THREAD_LIST_NODE_ENTRY(node);
+
+    return thread->susp_list == susp_list && thread->susp_prio == priority;
+}
+
+/* insertion behind the last waiter of the same or a higher priority */
+static void _susp_list_insert_prio(rt_list_t *susp_list, rt_thread_t thread)
+{
+    struct rt_thread *first, *head;
+    rt_uint8_t priority;
+    rt_bool_t found = RT_FALSE;
+
+    priority = rt_sched_thread_get_curr_prio(thread);
+    thread->susp_prio = priority;
+    thread->susp_run_head = RT_FALSE;
+    rt_list_init(&(thread->susp_run));
+
+    if (rt_list_isempty(susp_list))
+    {
+        /* the first waiter starts the runs */
+        rt_list_insert_after(susp_list, &RT_THREAD_LIST_NODE(thread));
+        thread->susp_list = susp_list;
+        thread->susp_run_head = RT_TRUE;
+        return;
+    }
+
+    first = RT_THREAD_LIST_NODE_ENTRY(susp_list->next);
+    if (first->susp_list != susp_list || !first->susp_run_head)
+    {
+        /* a list somebody queued without the index, keep it sorted */
+        struct rt_list_node *n;
+
+        for (n = susp_list->next; n != susp_list; n = n->next)
+        {
+            if (priority < rt_sched_thread_get_curr_prio(RT_THREAD_LIST_NODE_ENTRY(n)))
+                break;
+        }
+        rt_list_insert_before(n, &RT_THREAD_LIST_NODE(thread));
+        thread->susp_list = RT_NULL;
+        return;
+    }
+
+    /* the first run of a lower priority, the new waiter goes in front of it */
+    head = first;
+    do
+    {
+        if (head->susp_prio > priority)
+        {
+            found = RT_TRUE;
+            break;
+        }
+        head = _SUSP_RUN_ENTRY(head->susp_run.next);
+    } while (head != first);
+
+    if (found)
+        rt_list_insert_before(&RT_THREAD_LIST_NODE(head), &RT_THREAD_LIST_NODE(thread));
+    else
+        rt_list_insert_before(susp_list, &RT_THREAD_LIST_NODE(thread));
+    thread->susp_list = susp_list;
+
+    /* no waiter of its priority ahead of it, it starts a run */
+    if (!_susp_same_run(susp_list, RT_THREAD_LIST_NODE(thread).prev, priority))
+    {
+        /* in front of the lower run, or at the end of the ring */
+        rt_list_insert_before(&(head->susp_run), &(thread->susp_run));
+        thread->susp_run_head = RT_TRUE;
+    }
+}
+#endif /* RT_USING_IPC_PRIO_INDEX */
+
 /**
  * @brief   Add a thread to the suspend list
  *
@@ -246,9 +341,15 @@ rt_err_t rt_susp_list_enqueue(rt_list_t *susp_list, rt_thread_t thread, int ipc_
     {
     case RT_IPC_FLAG_FIFO:
         rt_list_insert_before(susp_list, &RT_THREAD_LIST_NODE(thread));
+#ifdef RT_USING_IPC_PRIO_INDEX
+        thread->susp_list = RT_NULL;
+#endif /* RT_USING_IPC_PRIO_INDEX */
         break; /* RT_IPC_FLAG_FIFO */
 
     case RT_IPC_FLAG_PRIO:
+#ifdef RT_USING_IPC_PRIO_INDEX
+        _susp_list_insert_prio(susp_list, thread);
+#else
         {
             struct rt_list_node *n;
             struct rt_thread *sthread;
@@ -274,6 +375,7 @@ rt_err_t rt_susp_list_enqueue(rt_list_t *susp_list, rt_thread_t thread, int ipc_
             if (n == susp_list)
                 rt_list_insert_before(susp_list, &RT_THREAD_LIST_NODE(thread));
         }
+#endif /* RT_USING_IPC_PRIO_INDEX */
         break;/* RT_IPC_FLAG_PRIO */
 
     default:
@@ -284,6 +386,42 @@ rt_err_t rt_susp_list_enqueue(rt_list_t *susp_list, rt_thread_t thread, int ipc_
     return RT_EOK;
 }
 
+/**
+ * @brief   Take a thread off the suspend list it is waiting on
+ *
+ * @note    Caller must hold the scheduler lock. Every removal from a suspend
+ *          list goes through here so the priority index stays in step.
+ *
+ * @param   thread the suspended thread
+ */
+void rt_susp_list_remove(rt_thread_t thread)
+{
+#ifdef RT_USING_IPC_PRIO_INDEX
+    rt_list_t *susp_list = thread->susp_list;
+    rt_list_t *next = RT_THREAD_LIST_NODE(thread).next;
+
+    if (susp_list != RT_NULL)
+    {
+        if (thread->susp_run_head)
+        {
+            /* the next waiter of the run takes its place among the run heads */
+            if (_susp_same_run(susp_list, next, thread->susp_prio) &&
+                !RT_THREAD_LIST_NODE_ENTRY(next)->susp_run_head)
+            {
+                rt_list_insert_after(&(thread->susp_run), &(RT_THREAD_LIST_NODE_ENTRY(next)->susp_run));
+                RT_THREAD_LIST_NODE_ENTRY(next)->susp_run_head = RT_TRUE;
+            }
+            rt_list_remove(&(thread->susp_run));
+            thread->susp_run_head = RT_FALSE;
+        }
+
+        thread->susp_list = RT_NULL;
+    }
+#endif /* RT_USING_IPC_PRIO_INDEX */
+
+    rt_list_remove(&RT_THREAD_LIST_NODE(thread));
+}
+
 /**
  * @brief   Print thread on suspend list to system console
  */
@@ -887,7 +1025,7 @@ rt_inline void _thread_update_priority(struct rt_thread *thread, rt_uint8_t prio
             struct rt_mutex* pending_mutex = (struct rt_mutex *)pending_obj;
 
             /* re-insert thread to suspended thread list to resort priority list */
-            rt_list_remove(&RT_THREAD_LIST_NODE(thread));
+            rt_susp_list_remove(thread);
 
             ret = rt_susp_list_enqueue(
                 &(pending_mutex->parent.suspend_thread), thread,
@@ -1094,7 +1232,7 @@ void rt_mutex_drop_thread(rt_mutex_t mutex, rt_thread_t thread)
     rt_sched_lock(&slvl);
 
     /* detach from suspended list */
-    rt_list_remove(&RT_THREAD_LIST_NODE(thread));
+    rt_susp_list_remove(thread);
 
     /**
      * Should change the priority of mutex owner thread
@@ -1647,7 +1785,7 @@ rt_err_t rt_mutex_release(rt_mutex_t mutex)
                 RT_ASSERT(rt_sched_thread_is_suspended(next_thread));
 
                 /* remove the thread from the suspended list of mutex */
-                rt_list_remove(&RT_THREAD_LIST_NODE(next_thread));
+                rt_susp_list_remove(next_thread);
 
                 /* resume thread to ready queue */
                 if (rt_sched_thread_ready(next_thread) != RT_EOK)
@@ -1745,12 +1883,683 @@ RTM_EXPORT(rt_mutex_control);
 /**@}*/
 #endif /* RT_USING_MUTEX */
 
+#ifdef RT_USING_RWLOCK
+#if !defined(RT_USING_MUTEX) || !defined(RT_USING_SEMAPHORE)
+#error "RT_USING_RWLOCK requires RT_USING_MUTEX and RT_USING_SEMAPHORE"
+#endif
+
+/**
+ * @addtogroup group_rwlock Reader-Writer Lock
+ * @{
+ */
+
+/*
+ * Readers count themselves in rwlock->state without taking any lock as long
+ * as no writer is around. A writer first takes the gate mutex and then sets
+ * RT_RWLOCK_WRITER, from then on new readers queue on the gate as well. So
+ * writers are preferred, and whoever waits on the gate lends its priority to
+ * the writer through the priority inheritance of the mutex. The writer waits
+ * on the drained semaphore until the readers already inside have left, the
+ * last of them releases it.
+ */
+
+static void _rwlock_object_init(rt_rwlock_t rwlock, const char *name)
+{
+    rt_atomic_store(&(rwlock->state), 0);
+    rwlock->writer = RT_NULL;
+
+    rt_mutex_init(&(rwlock->gate), name, RT_IPC_FLAG_PRIO);
+    rt_sem_init(&(rwlock->drained), name, 0, RT_IPC_FLAG_PRIO);
+}
+
+/* ticks left of a timeout that started at start */
+rt_inline rt_int32_t _rwlock_time_left(rt_int32_t timeout, rt_tick_t start)
+{
+    rt_tick_t elapsed;
+
+    if (timeout <= 0)
+        return timeout;
+
+    elapsed = rt_tick_get_delta(start);
+    return elapsed >= (rt_tick_t)timeout ? 0 : (rt_int32_t)(timeout - elapsed);
+}
+
+/**
+ * @brief    Initialize a static reader-writer lock object.
+ *
+ * @note     The gate mutex and the semaphore inside the lock are initialized with the same name, so they are
+ *           listed together with the other mutexes and semaphores of the system.
+ *
+ * @see      rt_rwlock_create()
+ *
+ * @param    rwlock is a pointer to the reader-writer lock to initialize.
+ *
+ * @param    name is a pointer to the name that given to the lock.
+ *
+ * @return   Return the operation status. When the return value is RT_EOK, the initialization is successful.
+ *
+ * @warning  This function can ONLY be called from threads.
+ */
+rt_err_t rt_rwlock_init(rt_rwlock_t rwlock, const char *name)
+{
+    /* parameter check */
+    RT_ASSERT(rwlock != RT_NULL);
+
+    rt_object_init(&(rwlock->parent), RT_Object_Class_RWLock, name);
+    _rwlock_object_init(rwlock, name);
+
+    return RT_EOK;
+}
+RTM_EXPORT(rt_rwlock_init);
+
+/**
+ * @brief    This function will detach a static reader-writer lock object.
+ *
+ * @note     Threads waiting for the lock are resumed with an error.
+ *
+ * @see      rt_rwlock_delete()
+ *
+ * @param    rwlock is a pointer to a reader-writer lock initialized by rt_rwlock_init().
+ *
+ * @return   Return the operation status. When the return value is RT_EOK, the detach is successful.
+ */
+rt_err_t rt_rwlock_detach(rt_rwlock_t rwlock)
+{
+    /* parameter check */
+    RT_ASSERT(rwlock != RT_NULL);
+    RT_ASSERT(rt_object_get_type(&rwlock->parent) == RT_Object_Class_RWLock);
+    RT_ASSERT(rt_object_is_systemobject(&rwlock->parent));
+
+    rt_mutex_detach(&(rwlock->gate));
+    rt_sem_detach(&(rwlock->drained));
+    rt_object_detach(&(rwlock->parent));
+
+    return RT_EOK;
+}
+RTM_EXPORT(rt_rwlock_detach);
+
+#ifdef RT_USING_HEAP
+/**
+ * @brief    This function will create a reader-writer lock object.
+ *
+ * @see      rt_rwlock_init()
+ *
+ * @param    name is a pointer to the name that given to the lock.
+ *
+ * @return   Return a pointer to the lock object. When the return value is RT_NULL, it means the creation failed.
+ *
+ * @warning  This function can ONLY be called from threads.
+ */
+rt_rwlock_t rt_rwlock_create(const char *name)
+{
+    struct rt_rwlock *rwlock;
+
+    RT_DEBUG_NOT_IN_INTERRUPT;
+
+    rwlock = (rt_rwlock_t)rt_object_allocate(RT_Object_Class_RWLock, name);
+    if (rwlock == RT_NULL)
+        return rwlock;
+
+    _rwlock_object_init(rwlock, name);
+
+    return rwlock;
+}
+RTM_EXPORT(rt_rwlock_create);
+
+/**
+ * @brief    This function will delete a reader-writer lock object and release its memory space.
+ *
+ * @see      rt_rwlock_detach()
+ *
+ * @param    rwlock is a pointer to a reader-writer lock created by rt_rwlock_create().
+ *
+ * @return   Return the operation status. When the return value is RT_EOK, the deletion is successful.
+ */
+rt_err_t rt_rwlock_delete(rt_rwlock_t rwlock)
+{
+    /* parameter check */
+    RT_ASSERT(rwlock != RT_NULL);
+    RT_ASSERT(rt_object_get_type(&rwlock->parent) == RT_Object_Class_RWLock);
+    RT_ASSERT(rt_object_is_systemobject(&rwlock->parent) == RT_FALSE);
+
+    RT_DEBUG_NOT_IN_INTERRUPT;
+
+    rt_mutex_detach(&(rwlock->gate));
+    rt_sem_detach(&(rwlock->drained));
+    rt_object_delete(&(rwlock->parent));
+
+    return RT_EOK;
+}
+RTM_EXPORT(rt_rwlock_delete);
+#endif /* RT_USING_HEAP */
+
+/**
+ * @brief    This function will take a reader-writer lock for reading.
+ *
+ * @note     Any number of threads can hold the lock for reading at the same time. Without a writer around this
+ *           is a single atomic operation. A thread may take the read lock again while it holds it, unless a
+ *           writer is waiting, which would deadlock.
+ *
+ * @param    rwlock is a pointer to a reader-writer lock object.
+ *
+ * @param    timeout is a timeout period (unit: an OS tick), RT_WAITING_NO or RT_WAITING_FOREVER.
+ *
+ * @return   Return the operation status. ONLY When the return value is RT_EOK, the operation is successful.
+ *           -RT_ETIMEOUT if a writer held the lock for the whole timeout, -RT_EBUSY if the calling thread
+ *           holds the write lock.
+ *
+ * @warning  This function can ONLY be called in the thread context.
+ */
+rt_err_t rt_rwlock_take_read(rt_rwlock_t rwlock, rt_int32_t timeout)
+{
+    rt_atomic_t state;
+    rt_err_t ret;
+
+    /* parameter check */
+    RT_ASSERT(rwlock != RT_NULL);
+    RT_ASSERT(rt_object_get_type(&rwlock->parent) == RT_Object_Class_RWLock);
+
+    RT_OBJECT_HOOK_CALL(rt_object_trytake_hook, (&(rwlock->parent)));
+
+    state = rt_atomic_load(&(rwlock->state));
+    while (!(state & RT_RWLOCK_WRITER))
+    {
+        if (rt_atomic_compare_exchange_strong(&(rwlock->state), &state, state + 1))
+        {
+            RT_OBJECT_HOOK_CALL(rt_object_take_hook, (&(rwlock->parent)));
+            return RT_EOK;
+        }
+    }
+
+    if (rwlock->writer == rt_thread_self())
+        return -RT_EBUSY;
+
+    /* queue behind the writer, it inherits our priority meanwhile */
+    ret = rt_mutex_take(&(rwlock->gate), timeout);
+    if (ret != RT_EOK)
+        return ret;
+
+    rt_atomic_add(&(rwlock->state), 1);
+    rt_mutex_release(&(rwlock->gate));
+
+    RT_OBJECT_HOOK_CALL(rt_object_take_hook, (&(rwlock->parent)));
+
+    return RT_EOK;
+}
+RTM_EXPORT(rt_rwlock_take_read);
+
+/**
+ * @brief    This function will take a reader-writer lock for writing.
+ *
+ * @note     The writer excludes readers and other writers. From the moment it asks for the lock no new reader
+ *           gets in, and it runs with the priority of the highest thread waiting for the lock. The write lock
+ *           is not recursive.
+ *
+ * @note     A read lock cannot be upgraded. The readers are not tracked per thread, so a thread holding the
+ *           read lock is not detected here: it waits for itself to leave until the timeout expires, or
+ *           forever with RT_WAITING_FOREVER. Release the read lock before taking the write lock.
+ *
+ * @param    rwlock is a pointer to a reader-writer lock object.
+ *
+ * @param    timeout is a timeout period (unit: an OS tick) covering both the wait for other writers and for
+ *           the readers to leave, RT_WAITING_NO or RT_WAITING_FOREVER.
+ *
+ * @return   Return the operation status. ONLY When the return value is RT_EOK, the operation is successful.
+ *           -RT_ETIMEOUT if the lock could not be taken in time, -RT_EBUSY if the calling thread holds the
+ *           write lock already.
+ *
+ * @warning  This function can ONLY be called in the thread context.
+ */
+rt_err_t rt_rwlock_take_write(rt_rwlock_t rwlock, rt_int32_t timeout)
+{
+    struct rt_thread *thread;
+    rt_atomic_t state;
+    rt_tick_t start;
+    rt_err_t ret;
+
+    /* parameter check */
+    RT_ASSERT(rwlock != RT_NULL);
+    RT_ASSERT(rt_object_get_type(&rwlock->parent) == RT_Object_Class_RWLock);
+
+    RT_OBJECT_HOOK_CALL(rt_object_trytake_hook, (&(rwlock->parent)));
+
+    thread = rt_thread_self();
+    if (rwlock->writer == thread)
+        return -RT_EBUSY;
+
+    start = rt_tick_get();
+    ret = rt_mutex_take(&(rwlock->gate), timeout);
+    if (ret != RT_EOK)
+        return ret;
+
+    state = rt_atomic_or(&(rwlock->state), RT_RWLOCK_WRITER);
+    if (state & RT_RWLOCK_READERS_MASK)
+    {
+        ret = rt_sem_take(&(rwlock->drained), _rwlock_time_left(timeout, start));
+        if (ret != RT_EOK)
+        {
+            state = rt_atomic_load(&(rwlock->state));
+            while (state & RT_RWLOCK_READERS_MASK)
+            {
+                if (rt_atomic_compare_exchange_strong(&(rwlock->state), &state, state & ~RT_RWLOCK_WRITER))
+                {
+                    rt_mutex_release(&(rwlock->gate));
+                    return ret;
+                }
+            }
+
+            /* the last reader left meanwhile, take its release so it is not left for the next writer */
+            rt_sem_take(&(rwlock->drained), RT_WAITING_FOREVER);
+        }
+    }
+
+    rwlock->writer = thread;
+
+    RT_OBJECT_HOOK_CALL(rt_object_take_hook, (&(rwlock->parent)));
+
+    return RT_EOK;
+}
+RTM_EXPORT(rt_rwlock_take_write);
+
+/**
+ * @brief    This function will release a reader-writer lock taken for reading or for writing.
+ *
+ * @param    rwlock is a pointer to a reader-writer lock object.
+ *
+ * @return   Return the operation status. When the return value is RT_EOK, the operation is successful.
+ *           -RT_ERROR if the lock was not held.
+ */
+rt_err_t rt_rwlock_release(rt_rwlock_t rwlock)
+{
+    rt_atomic_t state;
+
+    /* parameter check */
+    RT_ASSERT(rwlock != RT_NULL);
+    RT_ASSERT(rt_object_get_type(&rwlock->parent) == RT_Object_Class_RWLock);
+
+    if (rwlock->writer == rt_thread_self())
+    {
+        rwlock->writer = RT_NULL;
+        rt_atomic_and(&(rwlock->state), ~RT_RWLOCK_WRITER);
+
+        RT_OBJECT_HOOK_CALL(rt_object_put_hook, (&(rwlock->parent)));
+
+        return rt_mutex_release(&(rwlock->gate));
+    }
+
+    state = rt_atomic_load(&(rwlock->state));
+    do
+    {
+        if ((state & RT_RWLOCK_READERS_MASK) == 0)
+            return -RT_ERROR;
+    } while (!rt_atomic_compare_exchange_strong(&(rwlock->state), &state, state - 1));
+
+    /* the last reader lets the waiting writer in */
+    if ((state & RT_RWLOCK_WRITER) && (state & RT_RWLOCK_READERS_MASK) == 1)
+        rt_sem_release(&(rwlock->drained));
+
+    RT_OBJECT_HOOK_CALL(rt_object_put_hook, (&(rwlock->parent)));
+
+    return RT_EOK;
+}
+RTM_EXPORT(rt_rwlock_release);
+
+/**@}*/
+#endif /* RT_USING_RWLOCK */
+
+#ifdef RT_USING_SEQLOCK
+/**
+ * @addtogroup group_seqlock Sequence Lock
+ * @{
+ */
+
+/*
+ * The writers make the sequence odd while they change the protected data and
+ * even again when done. Readers never write to shared memory: they copy the
+ * data and retry if the sequence was odd or changed meanwhile. Writers hold a
+ * spinlock with interrupts off, so they are short and a reader on the same
+ * core never sees a write in progress.
+ */
+
+/**
+ * @brief    Initialize a static sequence lock object.
+ *
+ * @see      rt_seqlock_create()
+ *
+ * @param    seqlock is a pointer to the sequence lock to initialize.
+ *
+ * @param    name is a pointer to the name that given to the lock.
+ *
+ * @return   Return the operation status. When the return value is RT_EOK, the initialization is successful.
+ */
+rt_err_t rt_seqlock_init(rt_seqlock_t seqlock, const char *name)
+{
+    /* parameter check */
+    RT_ASSERT(seqlock != RT_NULL);
+
+    rt_object_init(&(seqlock->parent), RT_Object_Class_SeqLock, name);
+    rt_atomic_store(&(seqlock->sequence), 0);
+    rt_spin_lock_init(&(seqlock->lock));
+
+    return RT_EOK;
+}
+RTM_EXPORT(rt_seqlock_init);
+
+/**
+ * @brief    This function will detach a static sequence lock object.
+ *
+ * @param    seqlock is a pointer to a sequence lock initialized by rt_seqlock_init().
+ *
+ * @return   Return the operation status. When the return value is RT_EOK, the detach is successful.
+ */
+rt_err_t rt_seqlock_detach(rt_seqlock_t seqlock)
+{
+    /* parameter check */
+    RT_ASSERT(seqlock != RT_NULL);
+    RT_ASSERT(rt_object_get_type(&seqlock->parent) == RT_Object_Class_SeqLock);
+    RT_ASSERT(rt_object_is_systemobject(&seqlock->parent));
+
+    rt_object_detach(&(seqlock->parent));
+
+    return RT_EOK;
+}
+RTM_EXPORT(rt_seqlock_detach);
+
+#ifdef RT_USING_HEAP
+/**
+ * @brief    This function will create a sequence lock object.
+ *
+ * @see      rt_seqlock_init()
+ *
+ * @param    name is a pointer to the name that given to the lock.
+ *
+ * @return   Return a pointer to the lock object. When the return value is RT_NULL, it means the creation failed.
+ */
+rt_seqlock_t rt_seqlock_create(const char *name)
+{
+    struct rt_seqlock *seqlock;
+
+    RT_DEBUG_NOT_IN_INTERRUPT;
+
+    seqlock = (rt_seqlock_t)rt_object_allocate(RT_Object_Class_SeqLock, name);
+    if (seqlock == RT_NULL)
+        return seqlock;
+
+    rt_atomic_store(&(seqlock->sequence), 0);
+    rt_spin_lock_init(&(seqlock->lock));
+
+    return seqlock;
+}
+RTM_EXPORT(rt_seqlock_create);
+
+/**
+ * @brief    This function will delete a sequence lock object and release its memory space.
+ *
+ * @param    seqlock is a pointer to a sequence lock created by rt_seqlock_create().
+ *
+ * @return   Return the operation status. When the return value is RT_EOK, the deletion is successful.
+ */
+rt_err_t rt_seqlock_delete(rt_seqlock_t seqlock)
+{
+    /* parameter check */
+    RT_ASSERT(seqlock != RT_NULL);
+    RT_ASSERT(rt_object_get_type(&seqlock->parent) == RT_Object_Class_SeqLock);
+    RT_ASSERT(rt_object_is_systemobject(&seqlock->parent) == RT_FALSE);
+
+    RT_DEBUG_NOT_IN_INTERRUPT;
+
+    rt_object_delete(&(seqlock->parent));
+
+    return RT_EOK;
+}
+RTM_EXPORT(rt_seqlock_delete);
+#endif /* RT_USING_HEAP */
+
+/**
+ * @brief    This function will start a write section of a sequence lock.
+ *
+ * @note     Interrupts are disabled until rt_seqlock_write_end(), keep the section short.
+ *
+ * @param    seqlock is a pointer to a sequence lock object.
+ *
+ * @return   Return the interrupt level to pass to rt_seqlock_write_end().
+ */
+rt_base_t rt_seqlock_write_begin(rt_seqlock_t seqlock)
+{
+    rt_base_t level;
+
+    /* parameter check */
+    RT_ASSERT(seqlock != RT_NULL);
+    RT_ASSERT(rt_object_get_type(&seqlock->parent) == RT_Object_Class_SeqLock);
+
+    level = rt_spin_lock_irqsave(&(seqlock->lock));
+    rt_atomic_add(&(seqlock->sequence), 1);
+    rt_atomic_thread_fence_release();
+
+    return level;
+}
+RTM_EXPORT(rt_seqlock_write_begin);
+
+/**
+ * @brief    This function will end a write section of a sequence lock.
+ *
+ * @param    seqlock is a pointer to a sequence lock object.
+ *
+ * @param    level is the value returned by rt_seqlock_write_begin().
+ */
+void rt_seqlock_write_end(rt_seqlock_t seqlock, rt_base_t level)
+{
+    rt_atomic_thread_fence_release();
+    rt_atomic_add(&(seqlock->sequence), 1);
+    rt_spin_unlock_irqrestore(&(seqlock->lock), level);
+}
+RTM_EXPORT(rt_seqlock_write_end);
+
+/**
+ * @brief    This function will start a read section of a sequence lock.
+ *
+ * @param    seqlock is a pointer to a sequence lock object.
+ *
+ * @return   Return the sequence to pass to rt_seqlock_read_retry().
+ */
+rt_uint32_t rt_seqlock_read_begin(rt_seqlock_t seqlock)
+{
+    rt_uint32_t start;
+
+    start = (rt_uint32_t)rt_atomic_load(&(seqlock->sequence));
+    rt_atomic_thread_fence_acquire();
+
+    return start;
+}
+RTM_EXPORT(rt_seqlock_read_begin);
+
+/**
+ * @brief    This function will check whether the data read since rt_seqlock_read_begin() is consistent.
+ *
+ * @param    seqlock is a pointer to a sequence lock object.
+ *
+ * @param    start is the value returned by rt_seqlock_read_begin().
+ *
+ * @return   Return RT_TRUE if a writer interfered and the read section must be repeated.
+ */
+rt_bool_t rt_seqlock_read_retry(rt_seqlock_t seqlock, rt_uint32_t start)
+{
+    rt_atomic_thread_fence_acquire();
+
+    return (start & 1) || (rt_uint32_t)rt_atomic_load(&(seqlock->sequence)) != start;
+}
+RTM_EXPORT(rt_seqlock_read_retry);
+
+/**
+ * @brief    This function will copy a snapshot into the data protected by a sequence lock.
+ *
+ * @param    seqlock is a pointer to a sequence lock object.
+ *
+ * @param    shared is the protected data.
+ *
+ * @param    data is the new content.
+ *
+ * @param    size is the size of the data in bytes.
+ */
+void rt_seqlock_write(rt_seqlock_t seqlock, void *shared, const void *data, rt_size_t size)
+{
+    rt_base_t level;
+
+    level = rt_seqlock_write_begin(seqlock);
+    rt_memcpy(shared, data, size);
+    rt_seqlock_write_end(seqlock, level);
+}
+RTM_EXPORT(rt_seqlock_write);
+
+/**
+ * @brief    This function will copy a consistent snapshot out of the data protected by a sequence lock.
+ *
+ * @note     The reader never blocks a writer. It copies again as long as writers interfere, for at most
+ *           the timeout. It can be called from interrupts with RT_WAITING_NO.
+ *
+ * @param    seqlock is a pointer to a sequence lock object.
+ *
+ * @param    data receives the snapshot.
+ *
+ * @param    shared is the protected data.
+ *
+ * @param    size is the size of the data in bytes.
+ *
+ * @param    timeout is a timeout period (unit: an OS tick), RT_WAITING_NO for a single attempt or
+ *           RT_WAITING_FOREVER.
+ *
+ * @return   Return the operation status. When the return value is RT_EOK, data holds a consistent snapshot.
+ *           -RT_ETIMEOUT if writers kept interfering.
+ */
+rt_err_t rt_seqlock_read(rt_seqlock_t seqlock, void *data, const void *shared, rt_size_t size,
+                         rt_int32_t timeout)
+{
+    rt_uint32_t start;
+    rt_tick_t begin;
+
+    /* parameter check */
+    RT_ASSERT(seqlock != RT_NULL);
+    RT_ASSERT(rt_object_get_type(&seqlock->parent) == RT_Object_Class_SeqLock);
+
+    begin = rt_tick_get();
+    for (;;)
+    {
+        start = rt_seqlock_read_begin(seqlock);
+        if (!(start & 1))
+        {
+            rt_memcpy(data, shared, size);
+            if (!rt_seqlock_read_retry(seqlock, start))
+                return RT_EOK;
+        }
+
+        if (timeout == RT_WAITING_NO ||
+            (timeout > 0 && rt_tick_get_delta(begin) >= (rt_tick_t)timeout))
+        {
+            return -RT_ETIMEOUT;
+        }
+    }
+}
+RTM_EXPORT(rt_seqlock_read);
+
+/**@}*/
+#endif /* RT_USING_SEQLOCK */
+
 #ifdef RT_USING_EVENT
 /**
  * @addtogroup group_event Event
  * @{
  */
 
+#ifdef RT_EVENT_USING_WAITER_INDEX
+/*
+ * Waiters are kept on a list per event bit, so a send only visits the lists
+ * of the bits it sets:
+ * - an AND waiter is filed under one bit it still misses, it can not be
+ *   satisfied before that bit arrives. A send of that bit which leaves other
+ *   bits missing moves the waiter on to one of them;
+ * - an OR waiter on a single bit is filed under that bit.
+ * OR waiters on several bits stay on the suspend list of the ipc object, which
+ * is only walked by sends touching multi_set.
+ */
+static rt_list_t *_event_waiter_list(rt_event_t event, rt_uint32_t set, rt_uint8_t option)
+{
+    rt_uint32_t key;
+
+    if (option & RT_EVENT_FLAG_AND)
+    {
+        key = set & ~event->set;
+    }
+    else if ((set & (set - 1)) == 0)
+    {
+        key = set;
+    }
+    else
+    {
+        event->multi_set |= set;
+        return &(event->parent.suspend_thread);
+    }
+
+    key = __rt_ffs((int)key) - 1;
+    event->waiter_set |= 1ul << key;
+
+    return &(event->waiters[key]);
+}
+
+static void _event_waiter_init(rt_event_t event)
+{
+    int index;
+
+    event->waiter_set = 0;
+    event->multi_set = 0;
+    for (index = 0; index < 32; index++)
+        rt_list_init(&(event->waiters[index]));
+}
+
+/*
+ * Resume a waiter if the event set satisfies it, return RT_FALSE otherwise.
+ * Same check as the full list walk of rt_event_send().
+ */
+static rt_bool_t _event_waiter_wake(rt_event_t event, struct rt_thread *thread, rt_uint32_t *clear_set)
+{
+    if (thread->event_info & RT_EVENT_FLAG_AND)
+    {
+        if ((thread->event_set & event->set) != thread->event_set)
+            return RT_FALSE;
+    }
+    else
+    {
+        if ((thread->event_set & event->set) == 0)
+            return RT_FALSE;
+
+        /* save the received event set */
+        thread->event_set = thread->event_set & event->set;
+    }
+
+    if (thread->event_info & RT_EVENT_FLAG_CLEAR)
+        *clear_set |= thread->event_set;
+
+    rt_sched_thread_ready(thread);
+    thread->error = RT_EOK;
+
+    return RT_TRUE;
+}
+#endif /* RT_EVENT_USING_WAITER_INDEX */
+
+static void _event_resume_all(rt_event_t event)
+{
+    rt_susp_list_resume_all(&(event->parent.suspend_thread), RT_ERROR);
+#ifdef RT_EVENT_USING_WAITER_INDEX
+    while (event->waiter_set)
+    {
+        int bit = __rt_ffs((int)event->waiter_set) - 1;
+
+        rt_susp_list_resume_all(&(event->waiters[bit]), RT_ERROR);
+        event->waiter_set &= ~(1ul << bit);
+    }
+    event->multi_set = 0;
+#endif /* RT_EVENT_USING_WAITER_INDEX */
+}
+
 /**
  * @brief    The function will initialize a static event object.
  *
@@ -1803,6 +2612,9 @@ rt_err_t rt_event_init(rt_event_t event, const char *name, rt_uint8_t flag)
     /* initialize event */
     event->set = 0;
     rt_spin_lock_init(&(event->spinlock));
+#ifdef RT_EVENT_USING_WAITER_INDEX
+    _event_waiter_init(event);
+#endif /* RT_EVENT_USING_WAITER_INDEX */
 
     return RT_EOK;
 }
@@ -1838,7 +2650,7 @@ rt_err_t rt_event_detach(rt_event_t event)
 
     level = rt_spin_lock_irqsave(&(event->spinlock));
     /* resume all suspended thread */
-    rt_susp_list_resume_all(&(event->parent.suspend_thread), RT_ERROR);
+    _event_resume_all(event);
     rt_spin_unlock_irqrestore(&(event->spinlock), level);
 
     /* detach event object */
@@ -1899,6 +2711,9 @@ rt_event_t rt_event_create(const char *name, rt_uint8_t flag)
     /* initialize event */
     event->set = 0;
     rt_spin_lock_init(&(event->spinlock));
+#ifdef RT_EVENT_USING_WAITER_INDEX
+    _event_waiter_init(event);
+#endif /* RT_EVENT_USING_WAITER_INDEX */
 
     return event;
 }
@@ -1934,7 +2749,7 @@ rt_err_t rt_event_delete(rt_event_t event)
 
     rt_spin_lock(&(event->spinlock));
     /* resume all suspended thread */
-    rt_susp_list_resume_all(&(event->parent.suspend_thread), RT_ERROR);
+    _event_resume_all(event);
     rt_spin_unlock(&(event->spinlock));
 
     /* delete event object */
@@ -1969,7 +2784,13 @@ rt_err_t rt_event_send(rt_event_t event, rt_uint32_t set)
     struct rt_thread *thread;
     rt_sched_lock_level_t slvl;
     rt_base_t level;
+#ifdef RT_EVENT_USING_WAITER_INDEX
+    rt_list_t *list;
+    rt_uint32_t pending, multi_set;
+    int bit;
+#else
     rt_base_t status;
+#endif /* RT_EVENT_USING_WAITER_INDEX */
     rt_bool_t need_schedule;
     rt_uint32_t need_clear_set = 0;
 
@@ -1990,6 +2811,61 @@ rt_err_t rt_event_send(rt_event_t event, rt_uint32_t set)
     RT_OBJECT_HOOK_CALL(rt_object_put_hook, (&(event->parent.parent)));
 
     rt_sched_lock(&slvl);
+#ifdef RT_EVENT_USING_WAITER_INDEX
+    /* only the lists of the bits just sent can hold a satisfied waiter */
+    pending = set & event->waiter_set;
+    while (pending)
+    {
+        bit = __rt_ffs((int)pending) - 1;
+        pending &= ~(1ul << bit);
+
+        list = &(event->waiters[bit]);
+        n = list->next;
+        while (n != list)
+        {
+            thread = RT_THREAD_LIST_NODE_ENTRY(n);
+            n = n->next;
+
+            if (_event_waiter_wake(event, thread, &need_clear_set))
+            {
+                need_schedule = RT_TRUE;
+            }
+            else
+            {
+                /* an AND waiter still missing bits, file it under one of them */
+                rt_susp_list_remove(thread);
+                rt_susp_list_enqueue(_event_waiter_list(event, thread->event_set, thread->event_info),
+                                     thread, event->parent.parent.flag);
+            }
+        }
+
+        if (rt_list_isempty(list))
+            event->waiter_set &= ~(1ul << bit);
+    }
+
+    if (set & event->multi_set)
+    {
+        /* rebuild the summary from the waiters left behind */
+        multi_set = 0;
+        n = event->parent.suspend_thread.next;
+        while (n != &(event->parent.suspend_thread))
+        {
+            thread = RT_THREAD_LIST_NODE_ENTRY(n);
+            n = n->next;
+
+            if (_event_waiter_wake(event, thread, &need_clear_set))
+                need_schedule = RT_TRUE;
+            else
+                multi_set |= thread->event_set;
+        }
+        event->multi_set = multi_set;
+    }
+
+    if (need_clear_set)
+    {
+        event->set &= ~need_clear_set;
+    }
+#else
     if (!rt_list_isempty(&event->parent.suspend_thread))
     {
         /* search thread list to resume thread */
@@ -2050,6 +2926,7 @@ rt_err_t rt_event_send(rt_event_t event, rt_uint32_t set)
             event->set &= ~need_clear_set;
         }
     }
+#endif /* RT_EVENT_USING_WAITER_INDEX */
 
     rt_sched_unlock(slvl);
     rt_spin_unlock_irqrestore(&(event->spinlock), level);
@@ -2177,8 +3054,13 @@ static rt_err_t _rt_event_recv(rt_event_t   event,
         thread->event_info = option;
 
         /* put thread to suspended thread list */
+#ifdef RT_EVENT_USING_WAITER_INDEX
+        ret = rt_thread_suspend_to_list(thread, _event_waiter_list(event, set, option),
+                                        event->parent.parent.flag, suspend_flag);
+#else
         ret = rt_thread_suspend_to_list(thread, &(event->parent.suspend_thread),
                                         event->parent.parent.flag, suspend_flag);
+#endif /* RT_EVENT_USING_WAITER_INDEX */
         if (ret != RT_EOK)
         {
             rt_spin_unlock_irqrestore(&(event->spinlock), level);
@@ -2280,7 +3162,7 @@ rt_err_t rt_event_control(rt_event_t event, int cmd, void *arg)
         level = rt_spin_lock_irqsave(&(event->spinlock));
 
         /* resume all waiting thread */
-        rt_susp_list_resume_all(&event->parent.suspend_thread, RT_ERROR);
+        _event_resume_all(event);
 
         /* initialize event set */
         event->set = 0;
@@ -0,0 +1,334 @@
+/*
+ * Copyright (c) 2006-2026, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-19     proyrb       the first version
+ */
+
+#include <rtthread.h>
+#include <float.h>
+
+/*
+ * Numeric conversion core shared by rt_vsnprintf() and the rt_fmt_xxx()
+ * functions. Integers are converted two digits per step from a table, so a
+ * 32-bit value takes at most five divisions by the constant 100, which the
+ * compiler turns into multiplications. 64-bit values are first split into
+ * chunks of eight digits, one 64-bit division per chunk.
+ */
+
+static const char _fmt_digit_pairs[200] =
+{
+    '0','0','0','1','0','2','0','3','0','4','0','5','0','6','0','7','0','8','0','9',
+    '1','0','1','1','1','2','1','3','1','4','1','5','1','6','1','7','1','8','1','9',
+    '2','0','2','1','2','2','2','3','2','4','2','5','2','6','2','7','2','8','2','9',
+    '3','0','3','1','3','2','3','3','3','4','3','5','3','6','3','7','3','8','3','9',
+    '4','0','4','1','4','2','4','3','4','4','4','5','4','6','4','7','4','8','4','9',
+    '5','0','5','1','5','2','5','3','5','4','5','5','5','6','5','7','5','8','5','9',
+    '6','0','6','1','6','2','6','3','6','4','6','5','6','6','6','7','6','8','6','9',
+    '7','0','7','1','7','2','7','3','7','4','7','5','7','6','7','7','7','8','7','9',
+    '8','0','8','1','8','2','8','3','8','4','8','5','8','6','8','7','8','8','8','9',
+    '9','0','9','1','9','2','9','3','9','4','9','5','9','6','9','7','9','8','9','9',
+};
+
+static const rt_uint32_t _fmt_pow10[10] =
+{
+    1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u, 100000000u, 1000000000u
+};
+
+static const rt_uint32_t _fmt_pow5[10] =
+{
+    1u, 5u, 25u, 125u, 625u, 3125u, 15625u, 78125u, 390625u, 1953125u
+};
+
+/**
+ * @brief  Convert an unsigned 32-bit value to decimal digits in reverse order.
+ *
+ * @param  buf is the buffer to write to, it must hold 10 characters.
+ *
+ * @param  value is the value to convert.
+ *
+ * @return The number of digits written, the least significant one first.
+ *
+ * @note   The reverse order is what the printf engines build their output in.
+ *         Nothing is terminated.
+ */
+rt_size_t rt_fmt_u32_rev(char *buf, rt_uint32_t value)
+{
+    const char *pair;
+    rt_size_t len = 0;
+
+    while (value >= 100u)
+    {
+        pair = &_fmt_digit_pairs[(value % 100u) * 2u];
+        value /= 100u;
+        buf[len++] = pair[1];
+        buf[len++] = pair[0];
+    }
+
+    if (value >= 10u)
+    {
+        pair = &_fmt_digit_pairs[value * 2u];
+        buf[len++] = pair[1];
+        buf[len++] = pair[0];
+    }
+    else
+    {
+        buf[len++] = (char)('0' + value);
+    }
+
+    return len;
+}
+RTM_EXPORT(rt_fmt_u32_rev);
+
+/**
+ * @brief  Convert an unsigned 64-bit value to decimal digits in reverse order.
+ *
+ * @param  buf is the buffer to write to, it must hold 20 characters.
+ *
+ * @param  value is the value to convert.
+ *
+ * @return The number of digits written, the least significant one first.
+ */
+rt_size_t rt_fmt_u64_rev(char *buf, rt_uint64_t value)
+{
+    const char *pair;
+    rt_uint64_t high;
+    rt_uint32_t low;
+    rt_size_t len = 0;
+    int i;
+
+    while (value > 0xFFFFFFFFull)
+    {
+        high = value / 100000000u;
+        low = (rt_uint32_t)(value - high * 100000000u);
+        value = high;
+
+        /* a full chunk keeps its leading zeros */
+        for (i = 0; i < 4; i++)
+        {
+            pair = &_fmt_digit_pairs[(low % 100u) * 2u];
+            low /= 100u;
+            buf[len++] = pair[1];
+            buf[len++] = pair[0];
+        }
+    }
+
+    return len + rt_fmt_u32_rev(buf + len, (rt_uint32_t)value);
+}
+RTM_EXPORT(rt_fmt_u64_rev);
+
+/**
+ * @brief  Split a double into the integral part and the rounded fraction of
+ *         a fixed precision decimal representation.
+ *
+ * @param  value is the value to split, its sign is ignored.
+ *
+ * @param  precision is the number of fraction digits, 0 to 9.
+ *
+ * @param  integral receives the integral part.
+ *
+ * @param  fraction receives the fraction scaled by 10^precision.
+ *
+ * @return RT_EOK on success, -RT_EINVAL if the value is not finite or larger
+ *         than 1e9, or the precision is out of range.
+ *
+ * @details The binary fraction of the mantissa is multiplied by 5^precision
+ *          and shifted, which is exact with 32x32 bit multiplications and
+ *          needs no division per digit. Ties round to even, as in the
+ *          standard printf.
+ */
+rt_err_t rt_fmt_fixed_split(double value, int precision, rt_uint32_t *integral, rt_uint32_t *fraction)
+{
+#if DBL_MANT_DIG == 53
+    union
+    {
+        double      f;
+        rt_uint64_t u;
+    } bits;
+    rt_uint64_t mant, frac, prod, prod_hi, sticky, q2;
+    rt_uint32_t prod_lo, whole, q;
+    int shift;
+
+    if (precision < 0 || precision > 9)
+        return -RT_EINVAL;
+
+    bits.f = value;
+    bits.u &= ~(1ull << 63);
+    /* NaN and infinity fail the comparison as well */
+    if (!(bits.f <= 1e9))
+        return -RT_EINVAL;
+
+    if ((bits.u >> 52) == 0)
+    {
+        /* zero or subnormal, rounds to zero at any supported precision */
+        *integral = 0;
+        *fraction = 0;
+        return RT_EOK;
+    }
+
+    /* value = mant / 2^shift, the shift is at least 23 below 1e9 */
+    mant = (bits.u & ((1ull << 52) - 1)) | (1ull << 52);
+    shift = 1075 - (int)(bits.u >> 52);
+
+    if (shift >= 64)
+    {
+        whole = 0;
+        frac = mant;
+    }
+    else
+    {
+        whole = (rt_uint32_t)(mant >> shift);
+        frac = mant & ((1ull << shift) - 1);
+    }
+
+    /* frac * 10^p / 2^shift = frac * 5^p / 2^(shift - p), below 2^74 */
+    prod = (rt_uint64_t)(rt_uint32_t)frac * _fmt_pow5[precision];
+    prod_hi = (rt_uint64_t)(rt_uint32_t)(frac >> 32) * _fmt_pow5[precision] + (prod >> 32);
+    prod_lo = (rt_uint32_t)prod;
+
+    /* q2 is the scaled fraction with one extra bit, the half */
+    shift = shift - precision - 1;
+    if (shift >= 75)
+    {
+        q2 = 0;
+        sticky = 0;
+    }
+    else if (shift < 32)
+    {
+        q2 = (prod_hi << (32 - shift)) | (prod_lo >> shift);
+        sticky = prod_lo & ((1u << shift) - 1);
+    }
+    else
+    {
+        q2 = prod_hi >> (shift - 32);
+        sticky = prod_lo | (prod_hi & ((1ull << (shift - 32)) - 1));
+    }
+
+    q = (rt_uint32_t)(q2 >> 1);
+    if ((q2 & 1) && (sticky || ((precision ? q : whole) & 1)))
+    {
+        q++;
+        /* rollover, e.g. 0.99 with precision 1 is 1.0 */
+        if (q == _fmt_pow10[precision])
+        {
+            q = 0;
+            whole++;
+        }
+    }
+
+    *integral = whole;
+    *fraction = q;
+
+    return RT_EOK;
+#else
+    return -RT_EINVAL;
+#endif /* DBL_MANT_DIG == 53 */
+}
+RTM_EXPORT(rt_fmt_fixed_split);
+
+/* copy the reversed digits to buf in reading order */
+rt_inline int _fmt_out(char *buf, const char *rev, rt_size_t len)
+{
+    rt_size_t i;
+
+    for (i = 0; i < len; i++)
+        buf[i] = rev[len - 1 - i];
+
+    return (int)len;
+}
+
+/**
+ * @brief  Convert an unsigned 32-bit value to a decimal string, without
+ *         parsing a format string.
+ *
+ * @param  buf is the buffer to write to, it must hold RT_FMT_INT_SIZE characters.
+ *
+ * @param  value is the value to convert.
+ *
+ * @return The length of the string, without the terminating null character.
+ */
+int rt_fmt_u32(char *buf, rt_uint32_t value)
+{
+    char rev[10];
+    int len;
+
+    len = _fmt_out(buf, rev, rt_fmt_u32_rev(rev, value));
+    buf[len] = '\0';
+
+    return len;
+}
+RTM_EXPORT(rt_fmt_u32);
+
+/**
+ * @brief  Convert a signed 32-bit value to a decimal string, without parsing
+ *         a format string.
+ *
+ * @param  buf is the buffer to write to, it must hold RT_FMT_INT_SIZE characters.
+ *
+ * @param  value is the value to convert.
+ *
+ * @return The length of the string, without the terminating null character.
+ */
+int rt_fmt_i32(char *buf, rt_int32_t value)
+{
+    if (value < 0)
+    {
+        buf[0] = '-';
+        return 1 + rt_fmt_u32(buf + 1, 0u - (rt_uint32_t)value);
+    }
+
+    return rt_fmt_u32(buf, (rt_uint32_t)value);
+}
+RTM_EXPORT(rt_fmt_i32);
+
+/**
+ * @brief  Convert a double to a fixed point decimal string, as "%.*f" does,
+ *         without parsing a format string.
+ *
+ * @param  buf is the buffer to write to, it must hold RT_FMT_FIXED_SIZE characters.
+ *
+ * @param  value is the value to convert, at most 1e9 in magnitude.
+ *
+ * @param  precision is the number of fraction digits, 0 to 9.
+ *
+ * @return The length of the string, without the terminating null character.
+ *         -RT_EINVAL if the value or precision is out of range, buf is left
+ *         untouched then.
+ */
+int rt_fmt_fixed(char *buf, double value, int precision)
+{
+    union
+    {
+        double      f;
+        rt_uint64_t u;
+    } bits;
+    rt_uint32_t integral, fraction;
+    char rev[10];
+    int digits, len = 0;
+
+    if (rt_fmt_fixed_split(value, precision, &integral, &fraction) != RT_EOK)
+        return -RT_EINVAL;
+
+    /* the sign of -0.0 and of tiny negatives is kept, like printf */
+    bits.f = value;
+    if (bits.u >> 63)
+        buf[len++] = '-';
+
+    len += _fmt_out(buf + len, rev, rt_fmt_u32_rev(rev, integral));
+
+    if (precision > 0)
+    {
+        buf[len++] = '.';
+        digits = (int)rt_fmt_u32_rev(rev, fraction);
+        for (; digits < precision; precision--)
+            buf[len++] = '0';
+        len += _fmt_out(buf + len, rev, digits);
+    }
+    buf[len] = '\0';
+
+    return len;
+}
+RTM_EXPORT(rt_fmt_fixed);
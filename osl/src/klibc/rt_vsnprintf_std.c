@@ -7,6 +7,7 @@
  * Date           Author       Notes
  * 2021-11-27     Meco Man     porting for rt_vsnprintf as the fully functional version
  * 2024-11-19     Meco Man     move to klibc
+ * 2026-10-19     proyrb       convert decimal digits with the rt_fmt core
  */
 
 /**
@@ -508,6 +509,10 @@ static void print_integer(output_gadget_t* output, printf_unsigned_value_t value
       // don't differ on 0 values
     }
   }
+  else if (base == BASE_DECIMAL && RT_KLIBC_USING_VSNPRINTF_INTEGER_BUFFER_SIZE >= 20) {
+    // two digits per step, see kfmt.c
+    len = (printf_size_t) rt_fmt_u64_rev(buf, value);
+  }
   else {
     do {
       const char digit = (char)(value % base);
@@ -668,6 +673,21 @@ static struct double_components get_normalized_components(bool negative, printf_
 }
 #endif // RT_KLIBC_USING_VSNPRINTF_EXPONENTIAL_SPECIFIERS
 
+// Append the digits of value in reverse order, two at a time (see kfmt.c)
+static printf_size_t append_decimal_digits(char *buf, printf_size_t len, uint64_t value)
+{
+  if (len + 20U <= RT_KLIBC_USING_VSNPRINTF_DECIMAL_BUFFER_SIZE) {
+    return len + (printf_size_t) rt_fmt_u64_rev(buf + len, value);
+  }
+
+  char digits[20];
+  printf_size_t count = (printf_size_t) rt_fmt_u64_rev(digits, value);
+  for (printf_size_t i = 0; (i < count) && (len < RT_KLIBC_USING_VSNPRINTF_DECIMAL_BUFFER_SIZE); i++) {
+    buf[len++] = digits[i];
+  }
+  return len;
+}
+
 static void print_broken_up_decimal(
   struct double_components number_, output_gadget_t* output, printf_size_t precision,
   printf_size_t width, printf_flags_t flags, char *buf, printf_size_t len)
@@ -693,13 +713,9 @@ static void print_broken_up_decimal(
     }
 
     if (number_.fractional > 0 || !(flags & FLAGS_ADAPT_EXP) || (flags & FLAGS_HASH) ) {
-      while (len < RT_KLIBC_USING_VSNPRINTF_DECIMAL_BUFFER_SIZE) {
-        --count;
-        buf[len++] = (char)('0' + number_.fractional % 10U);
-        if (!(number_.fractional /= 10U)) {
-          break;
-        }
-      }
+      printf_size_t start = len;
+      len = append_decimal_digits(buf, len, (uint64_t) number_.fractional);
+      count -= len - start;
       // add extra 0s
       while ((len < RT_KLIBC_USING_VSNPRINTF_DECIMAL_BUFFER_SIZE) && (count > 0U)) {
         buf[len++] = '0';
@@ -718,12 +734,7 @@ static void print_broken_up_decimal(
 
   // Write the integer part of the number (it comes after the fractional
   // since the character order is reversed)
-  while (len < RT_KLIBC_USING_VSNPRINTF_DECIMAL_BUFFER_SIZE) {
-    buf[len++] = (char)('0' + (number_.integral % 10));
-    if (!(number_.integral /= 10)) {
-      break;
-    }
-  }
+  len = append_decimal_digits(buf, len, (uint64_t) number_.integral);
 
   // pad leading zeros
   if (!(flags & FLAGS_LEFT) && (flags & FLAGS_ZEROPAD)) {
@@ -753,7 +764,18 @@ static void print_broken_up_decimal(
       // internal ftoa for fixed decimal floating point
 static void print_decimal_number(output_gadget_t* output, double number, printf_size_t precision, printf_size_t width, printf_flags_t flags, char* buf, printf_size_t len)
 {
-  struct double_components value_ = get_components(number, precision);
+  struct double_components value_;
+  rt_uint32_t integral, fractional;
+
+  // exact split without double scaling, for the usual precisions
+  if (rt_fmt_fixed_split(number, (int) precision, &integral, &fractional) == RT_EOK) {
+    value_.integral = integral;
+    value_.fractional = fractional;
+    value_.is_negative = get_sign_bit(number);
+  }
+  else {
+    value_ = get_components(number, precision);
+  }
   print_broken_up_decimal(value_, output, precision, width, flags, buf, len);
 }
 
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2006-2026, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-19     proyrb       the first version
+ */
+
+#include <rtklibc.h>
+#include <utest.h>
+
+#define FMT_CHECK(expected, call)                       \
+do {                                                    \
+    rt_memset(buffer, 0xCC, sizeof(buffer));            \
+    uassert_int_equal(call, rt_strlen(expected));       \
+    uassert_str_equal(expected, buffer);                \
+} while (0)
+
+static void TC_rt_fmt_integer(void)
+{
+    char buffer[RT_FMT_INT_SIZE];
+
+    FMT_CHECK("0",                      rt_fmt_u32(buffer, 0));
+    FMT_CHECK("7",                      rt_fmt_u32(buffer, 7));
+    FMT_CHECK("10",                     rt_fmt_u32(buffer, 10));
+    FMT_CHECK("99",                     rt_fmt_u32(buffer, 99));
+    FMT_CHECK("100",                    rt_fmt_u32(buffer, 100));
+    FMT_CHECK("1000000",                rt_fmt_u32(buffer, 1000000));
+    FMT_CHECK("4294967295",             rt_fmt_u32(buffer, 4294967295U));
+    FMT_CHECK("0",                      rt_fmt_i32(buffer, 0));
+    FMT_CHECK("-1",                     rt_fmt_i32(buffer, -1));
+    FMT_CHECK("-42",                    rt_fmt_i32(buffer, -42));
+    FMT_CHECK("2147483647",             rt_fmt_i32(buffer, 2147483647));
+    FMT_CHECK("-2147483648",            rt_fmt_i32(buffer, -2147483647 - 1));
+}
+
+static void TC_rt_fmt_u64_rev(void)
+{
+    char buffer[20];
+    rt_size_t len;
+
+    /* a chunk of eight digits with leading zeros inside */
+    len = rt_fmt_u64_rev(buffer, 12300000004ULL);
+    uassert_int_equal(len, 11);
+    uassert_buf_equal(buffer, "40000000321", 11);
+
+    len = rt_fmt_u64_rev(buffer, 18446744073709551615ULL);
+    uassert_int_equal(len, 20);
+    uassert_buf_equal(buffer, "51615590737044764481", 20);
+}
+
+static void TC_rt_fmt_fixed(void)
+{
+    char buffer[RT_FMT_FIXED_SIZE];
+
+    /* same values as the %f cases of TC_rt_sprintf.c */
+    FMT_CHECK("3.1415",                 rt_fmt_fixed(buffer, 3.1415354, 4));
+    FMT_CHECK("30343.142",              rt_fmt_fixed(buffer, 30343.1415354, 3));
+    FMT_CHECK("34",                     rt_fmt_fixed(buffer, 34.1415354, 0));
+    FMT_CHECK("1",                      rt_fmt_fixed(buffer, 1.3, 0));
+    FMT_CHECK("2",                      rt_fmt_fixed(buffer, 1.55, 0));
+    FMT_CHECK("1.6",                    rt_fmt_fixed(buffer, 1.64, 1));
+    FMT_CHECK("42.90",                  rt_fmt_fixed(buffer, 42.8952, 2));
+    FMT_CHECK("42.895200000",           rt_fmt_fixed(buffer, 42.8952, 9));
+    FMT_CHECK("42.500000",              rt_fmt_fixed(buffer, 42.5, 6));
+    FMT_CHECK("42.5",                   rt_fmt_fixed(buffer, 42.5, 1));
+    FMT_CHECK("42167.000000",           rt_fmt_fixed(buffer, 42167.0, 6));
+    FMT_CHECK("-12345.987654321",       rt_fmt_fixed(buffer, -12345.987654321, 9));
+    FMT_CHECK("4.0",                    rt_fmt_fixed(buffer, 3.999, 1));
+    FMT_CHECK("3",                      rt_fmt_fixed(buffer, 3.49, 0));
+    FMT_CHECK("3.5",                    rt_fmt_fixed(buffer, 3.49, 1));
+    FMT_CHECK("-42.987",                rt_fmt_fixed(buffer, -42.987, 3));
+
+    /* exact ties round to even */
+    FMT_CHECK("4",                      rt_fmt_fixed(buffer, 3.5, 0));
+    FMT_CHECK("4",                      rt_fmt_fixed(buffer, 4.5, 0));
+    FMT_CHECK("0",                      rt_fmt_fixed(buffer, 0.5, 0));
+    FMT_CHECK("0.12",                   rt_fmt_fixed(buffer, 0.125, 2));
+    FMT_CHECK("0.38",                   rt_fmt_fixed(buffer, 0.375, 2));
+    /* no double rounding, 12.705 is stored slightly above */
+    FMT_CHECK("12.71",                  rt_fmt_fixed(buffer, 12.705, 2));
+
+    FMT_CHECK("1.0",                    rt_fmt_fixed(buffer, 0.99, 1));
+    FMT_CHECK("0.000",                  rt_fmt_fixed(buffer, 1e-320, 3));
+    FMT_CHECK("-0.00",                  rt_fmt_fixed(buffer, -0.0, 2));
+    FMT_CHECK("-0.00",                  rt_fmt_fixed(buffer, -0.001, 2));
+    FMT_CHECK("1000000000.000000000",   rt_fmt_fixed(buffer, 1e9, 9));
+
+    uassert_int_equal(rt_fmt_fixed(buffer, 1.5, 10), -RT_EINVAL);
+    uassert_int_equal(rt_fmt_fixed(buffer, 1.5, -1), -RT_EINVAL);
+    uassert_int_equal(rt_fmt_fixed(buffer, 2e9, 2), -RT_EINVAL);
+    uassert_int_equal(rt_fmt_fixed(buffer, 1.0 / 0.0, 2), -RT_EINVAL);
+}
+
+static void TC_rt_fmt_matches_sprintf(void)
+{
+    char buffer[RT_FMT_FIXED_SIZE];
+    char expected[32];
+    double value;
+    int i, precision;
+
+    for (i = -2000; i <= 2000; i++)
+    {
+        rt_sprintf(expected, "%d", i * 104729);
+        FMT_CHECK(expected, rt_fmt_i32(buffer, i * 104729));
+
+        value = i * 0.0625 + i / 7.0;
+        for (precision = 0; precision <= 9; precision++)
+        {
+            rt_sprintf(expected, "%.*f", precision, value);
+            FMT_CHECK(expected, rt_fmt_fixed(buffer, value, precision));
+        }
+    }
+}
+
+static void utest_do_tc(void)
+{
+    UTEST_UNIT_RUN(TC_rt_fmt_integer);
+    UTEST_UNIT_RUN(TC_rt_fmt_u64_rev);
+    UTEST_UNIT_RUN(TC_rt_fmt_fixed);
+#ifdef RT_KLIBC_USING_VSNPRINTF_STANDARD
+    UTEST_UNIT_RUN(TC_rt_fmt_matches_sprintf);
+#endif /* RT_KLIBC_USING_VSNPRINTF_STANDARD */
+}
+
+UTEST_TC_EXPORT(utest_do_tc, "core.klibc.rt_fmt", RT_NULL, RT_NULL, 1000);
@@ -17,6 +17,7 @@
  * 2022-01-07     Gabriel      Moving __on_rt_xxxxx_hook to mempool.c
  * 2023-09-15     xqyjlj       perf rt_hw_interrupt_disable/enable
  * 2023-12-10     xqyjlj       fix spinlock assert
+ * 2026-10-19     proyrb       add lock free free list, RT_MEMPOOL_USING_LOCKFREE
  */
 
 #include <rthw.h>
@@ -59,6 +60,166 @@ void rt_mp_free_sethook(void (*hook)(struct rt_mempool *mp, void *block))
 /**@}*/
 #endif /* RT_USING_HOOK */
 
+#ifdef RT_MEMPOOL_USING_LOCKFREE
+/*
+ * The free list is a stack of block indexes. block_head keeps the index of
+ * the top block plus one (0 for an empty pool) in its low index_bits bits and
+ * a tag in the others, which changes on every push and pop so that a stale
+ * compare and exchange fails instead of linking a reused block (ABA). The
+ * header of a free block keeps the head index of the block below it.
+ *
+ * Allocation and release of available blocks take neither the spinlock nor
+ * the scheduler; both stay for threads that have to wait on an empty pool.
+ */
+#define MP_BLOCK_STRIDE(mp)     ((mp)->block_size + sizeof(rt_uint8_t *))
+#define MP_INDEX_MASK(mp)       (((rt_ubase_t)1 << (mp)->index_bits) - 1)
+
+rt_inline rt_uint8_t *_mp_block_of(struct rt_mempool *mp, rt_ubase_t head)
+{
+    rt_ubase_t index = head & MP_INDEX_MASK(mp);
+
+    if (index == 0)
+        return RT_NULL;
+
+    return (rt_uint8_t *)mp->start_address + (index - 1) * MP_BLOCK_STRIDE(mp);
+}
+
+rt_inline rt_ubase_t _mp_next_head(struct rt_mempool *mp, rt_ubase_t head, rt_ubase_t index)
+{
+    return ((head & ~MP_INDEX_MASK(mp)) + MP_INDEX_MASK(mp) + 1) | index;
+}
+
+static void _mp_lockfree_init(struct rt_mempool *mp)
+{
+    rt_uint8_t *block_ptr = (rt_uint8_t *)mp->start_address;
+    rt_size_t offset;
+
+    mp->index_bits = 1;
+    while (((rt_ubase_t)1 << mp->index_bits) <= mp->block_total_count)
+        mp->index_bits ++;
+    RT_ASSERT(mp->index_bits < sizeof(rt_ubase_t) * 8);
+
+    for (offset = 0; offset < mp->block_total_count; offset ++)
+    {
+        *(rt_ubase_t *)(block_ptr + offset * MP_BLOCK_STRIDE(mp)) =
+            (offset + 1 < mp->block_total_count) ? offset + 2 : 0;
+    }
+
+    rt_atomic_store(&(mp->block_head), mp->block_total_count ? 1 : 0);
+    rt_atomic_store(&(mp->block_waiting), 0);
+}
+
+static rt_uint8_t *_mp_pop(struct rt_mempool *mp)
+{
+    rt_atomic_t head, next;
+    rt_uint8_t *block_ptr;
+
+    head = rt_atomic_load(&(mp->block_head));
+    do
+    {
+        block_ptr = _mp_block_of(mp, (rt_ubase_t)head);
+        if (block_ptr == RT_NULL)
+            return RT_NULL;
+
+        /* the block may be taken meanwhile, the tag fails the exchange then */
+        next = (rt_atomic_t)_mp_next_head(mp, (rt_ubase_t)head,
+                                          *(volatile rt_ubase_t *)block_ptr & MP_INDEX_MASK(mp));
+    } while (!rt_atomic_compare_exchange_strong(&(mp->block_head), &head, next));
+
+    return block_ptr;
+}
+
+static void _mp_push(struct rt_mempool *mp, rt_uint8_t *block_ptr)
+{
+    rt_atomic_t head, next;
+    rt_ubase_t index;
+
+    index = (rt_ubase_t)(block_ptr - (rt_uint8_t *)mp->start_address) / MP_BLOCK_STRIDE(mp) + 1;
+
+    head = rt_atomic_load(&(mp->block_head));
+    do
+    {
+        *(volatile rt_ubase_t *)block_ptr = (rt_ubase_t)head & MP_INDEX_MASK(mp);
+        next = (rt_atomic_t)_mp_next_head(mp, (rt_ubase_t)head, index);
+    } while (!rt_atomic_compare_exchange_strong(&(mp->block_head), &head, next));
+}
+
+/*
+ * Blocking path of rt_mp_alloc. A waiter is counted in block_waiting before
+ * its last look at the free list, and rt_mp_free pushes before it reads the
+ * count, so a block released meanwhile is either seen here or wakes us.
+ */
+static rt_uint8_t *_mp_alloc_wait(struct rt_mempool *mp, rt_int32_t time)
+{
+    rt_uint8_t *block_ptr;
+    rt_base_t level;
+    struct rt_thread *thread;
+    rt_uint32_t before_sleep = 0;
+
+    RT_DEBUG_NOT_IN_INTERRUPT;
+
+    /* get current thread */
+    thread = rt_thread_self();
+
+    level = rt_spin_lock_irqsave(&(mp->spinlock));
+    rt_atomic_add(&(mp->block_waiting), 1);
+
+    while ((block_ptr = _mp_pop(mp)) == RT_NULL)
+    {
+        if (time == 0)
+        {
+            rt_set_errno(-RT_ETIMEOUT);
+            break;
+        }
+
+        thread->error = RT_EOK;
+
+        /* need suspend thread */
+        rt_thread_suspend_to_list(thread, &mp->suspend_thread, RT_IPC_FLAG_FIFO, RT_UNINTERRUPTIBLE);
+
+        if (time > 0)
+        {
+            rt_tick_t time_tick = time;
+            /* get the start tick of timer */
+            before_sleep = rt_tick_get();
+
+            /* init thread timer and start it */
+            rt_timer_control(&(thread->thread_timer),
+                             RT_TIMER_CTRL_SET_TIME,
+                             &time_tick);
+            rt_timer_start(&(thread->thread_timer));
+        }
+
+        /* enable interrupt */
+        rt_spin_unlock_irqrestore(&(mp->spinlock), level);
+
+        /* do a schedule */
+        rt_schedule();
+
+        if (thread->error != RT_EOK)
+        {
+            /* a detached or deleted pool has dropped its waiters already */
+            if (thread->error != RT_ERROR)
+                rt_atomic_sub(&(mp->block_waiting), 1);
+            return RT_NULL;
+        }
+
+        if (time > 0)
+        {
+            time -= rt_tick_get() - before_sleep;
+            if (time < 0)
+                time = 0;
+        }
+        level = rt_spin_lock_irqsave(&(mp->spinlock));
+    }
+
+    rt_atomic_sub(&(mp->block_waiting), 1);
+    rt_spin_unlock_irqrestore(&(mp->spinlock), level);
+
+    return block_ptr;
+}
+#endif /* RT_MEMPOOL_USING_LOCKFREE */
+
 /**
  * @addtogroup group_memory_management
  */
@@ -87,8 +248,10 @@ rt_err_t rt_mp_init(struct rt_mempool *mp,
                     rt_size_t          size,
                     rt_size_t          block_size)
 {
+#ifndef RT_MEMPOOL_USING_LOCKFREE
     rt_uint8_t *block_ptr;
     rt_size_t offset;
+#endif /* RT_MEMPOOL_USING_LOCKFREE */
 
     /* parameter check */
     RT_ASSERT(mp != RT_NULL);
@@ -115,6 +278,9 @@ rt_err_t rt_mp_init(struct rt_mempool *mp,
     rt_list_init(&(mp->suspend_thread));
 
     /* initialize free block list */
+#ifdef RT_MEMPOOL_USING_LOCKFREE
+    _mp_lockfree_init(mp);
+#else
     block_ptr = (rt_uint8_t *)mp->start_address;
     for (offset = 0; offset < mp->block_total_count; offset ++)
     {
@@ -126,6 +292,7 @@ rt_err_t rt_mp_init(struct rt_mempool *mp,
         RT_NULL;
 
     mp->block_list = block_ptr;
+#endif /* RT_MEMPOOL_USING_LOCKFREE */
     rt_spin_lock_init(&(mp->spinlock));
 
     return RT_EOK;
@@ -151,6 +318,9 @@ rt_err_t rt_mp_detach(struct rt_mempool *mp)
     level = rt_spin_lock_irqsave(&(mp->spinlock));
     /* wake up all suspended threads */
     rt_susp_list_resume_all(&mp->suspend_thread, RT_ERROR);
+#ifdef RT_MEMPOOL_USING_LOCKFREE
+    rt_atomic_store(&(mp->block_waiting), 0);
+#endif /* RT_MEMPOOL_USING_LOCKFREE */
 
     /* detach object */
     rt_object_detach(&(mp->parent));
@@ -177,9 +347,11 @@ rt_mp_t rt_mp_create(const char *name,
                      rt_size_t   block_count,
                      rt_size_t   block_size)
 {
-    rt_uint8_t *block_ptr;
     struct rt_mempool *mp;
+#ifndef RT_MEMPOOL_USING_LOCKFREE
+    rt_uint8_t *block_ptr;
     rt_size_t offset;
+#endif /* RT_MEMPOOL_USING_LOCKFREE */
 
     RT_DEBUG_NOT_IN_INTERRUPT;
 
@@ -216,6 +388,9 @@ rt_mp_t rt_mp_create(const char *name,
     rt_list_init(&(mp->suspend_thread));
 
     /* initialize free block list */
+#ifdef RT_MEMPOOL_USING_LOCKFREE
+    _mp_lockfree_init(mp);
+#else
     block_ptr = (rt_uint8_t *)mp->start_address;
     for (offset = 0; offset < mp->block_total_count; offset ++)
     {
@@ -227,6 +402,7 @@ rt_mp_t rt_mp_create(const char *name,
         = RT_NULL;
 
     mp->block_list = block_ptr;
+#endif /* RT_MEMPOOL_USING_LOCKFREE */
     rt_spin_lock_init(&(mp->spinlock));
 
     return mp;
@@ -254,6 +430,9 @@ rt_err_t rt_mp_delete(rt_mp_t mp)
     level = rt_spin_lock_irqsave(&(mp->spinlock));
     /* wake up all suspended threads */
     rt_susp_list_resume_all(&mp->suspend_thread, RT_ERROR);
+#ifdef RT_MEMPOOL_USING_LOCKFREE
+    rt_atomic_store(&(mp->block_waiting), 0);
+#endif /* RT_MEMPOOL_USING_LOCKFREE */
 
     rt_spin_unlock_irqrestore(&(mp->spinlock), level);
 
@@ -277,17 +456,46 @@ RTM_EXPORT(rt_mp_delete);
  *             - 0 for not waiting, allocating memory immediately.
  *
  * @return the allocated memory block or RT_NULL on allocated failed.
+ *
+ * @note With RT_MEMPOOL_USING_LOCKFREE an available block is taken without the
+ *       spinlock, which makes the non-waiting call cheap enough for interrupt
+ *       handlers. Only a caller that has to wait on an empty pool takes the lock.
  */
 void *rt_mp_alloc(rt_mp_t mp, rt_int32_t time)
 {
     rt_uint8_t *block_ptr;
+#ifndef RT_MEMPOOL_USING_LOCKFREE
     rt_base_t level;
     struct rt_thread *thread;
     rt_uint32_t before_sleep = 0;
+#endif /* RT_MEMPOOL_USING_LOCKFREE */
 
     /* parameter check */
     RT_ASSERT(mp != RT_NULL);
 
+#ifdef RT_MEMPOOL_USING_LOCKFREE
+    block_ptr = _mp_pop(mp);
+    if (block_ptr == RT_NULL)
+    {
+        /* memory block is unavailable. */
+        if (time == 0)
+        {
+            rt_set_errno(-RT_ETIMEOUT);
+
+            return RT_NULL;
+        }
+
+        block_ptr = _mp_alloc_wait(mp, time);
+        if (block_ptr == RT_NULL)
+            return RT_NULL;
+    }
+
+    /* decrease the free block counter */
+    rt_atomic_sub(&(mp->block_free_count), 1);
+
+    /* point to memory pool */
+    *(rt_uint8_t **)block_ptr = (rt_uint8_t *)mp;
+#else
     /* get current thread */
     thread = rt_thread_self();
 
@@ -357,6 +565,7 @@ void *rt_mp_alloc(rt_mp_t mp, rt_int32_t time)
     *(rt_uint8_t **)block_ptr = (rt_uint8_t *)mp;
 
     rt_spin_unlock_irqrestore(&(mp->spinlock), level);
+#endif /* RT_MEMPOOL_USING_LOCKFREE */
 
     RT_OBJECT_HOOK_CALL(rt_mp_alloc_hook,
                         (mp, (rt_uint8_t *)(block_ptr + sizeof(rt_uint8_t *))));
@@ -385,6 +594,18 @@ void rt_mp_free(void *block)
 
     RT_OBJECT_HOOK_CALL(rt_mp_free_hook, (mp, block));
 
+#ifdef RT_MEMPOOL_USING_LOCKFREE
+    _mp_push(mp, (rt_uint8_t *)block_ptr);
+
+    /* increase the free block count */
+    rt_atomic_add(&(mp->block_free_count), 1);
+
+    /* nobody waits on a pool that still has blocks, skip the lock */
+    if (rt_atomic_load(&(mp->block_waiting)) == 0)
+        return;
+
+    level = rt_spin_lock_irqsave(&(mp->spinlock));
+#else
     level = rt_spin_lock_irqsave(&(mp->spinlock));
 
     /* increase the free block count */
@@ -393,6 +614,7 @@ void rt_mp_free(void *block)
     /* link the block into the block list */
     *block_ptr = mp->block_list;
     mp->block_list = (rt_uint8_t *)block_ptr;
+#endif /* RT_MEMPOOL_USING_LOCKFREE */
 
     if (rt_susp_list_dequeue(&mp->suspend_thread, RT_EOK))
     {
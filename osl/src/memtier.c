@@ -0,0 +1,349 @@
+/*
+ * Copyright (c) 2006-2026, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * File      : memtier.c
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-19     proyrb       first implementation, placement classes over memheap
+ */
+
+#include <rthw.h>
+#include <rtthread.h>
+
+#ifdef RT_USING_MEMTIER
+
+#ifndef RT_USING_MEMHEAP
+#error "RT_USING_MEMTIER requires RT_USING_MEMHEAP"
+#endif
+
+#define DBG_TAG           "kernel.memtier"
+#define DBG_LVL           DBG_INFO
+#include <rtdbg.h>
+
+/* requests up to this size may live in the fast tier */
+#ifndef RT_MEMTIER_FAST_MAX_SIZE
+#define RT_MEMTIER_FAST_MAX_SIZE    256
+#endif
+
+/* requests from this size on go to the bulk tier when placed automatically */
+#ifndef RT_MEMTIER_BULK_MIN_SIZE
+#define RT_MEMTIER_BULK_MIN_SIZE    (16 * 1024)
+#endif
+
+#define MEMTIER_ITEM_SIZE       RT_ALIGN(sizeof(struct rt_memheap_item), RT_ALIGN_SIZE)
+#define MEMTIER_BLOCK_SIZE(ptr) \
+    ((rt_uintptr_t)(((struct rt_memheap_item *)((rt_uint8_t *)(ptr) - MEMTIER_ITEM_SIZE))->next) - \
+     (rt_uintptr_t)(ptr))
+
+static struct rt_memtier _tiers[RT_MEMTIER_CLASS_MAX];
+
+/*
+ * Placement order of each class, terminated by RT_MEMTIER_CLASS_MAX.
+ * The fast tier is tightly coupled memory which the DMA controllers and the
+ * display engines can not reach, so DMA requests never fall back into it and
+ * bulk requests are kept out of it to leave room for small hot objects.
+ */
+static const rt_uint8_t _tier_order[RT_MEMTIER_CLASS_MAX][RT_MEMTIER_CLASS_MAX] =
+{
+    {RT_MEMTIER_FAST, RT_MEMTIER_DMA,  RT_MEMTIER_BULK},
+    {RT_MEMTIER_DMA,  RT_MEMTIER_BULK, RT_MEMTIER_CLASS_MAX},
+    {RT_MEMTIER_BULK, RT_MEMTIER_DMA,  RT_MEMTIER_CLASS_MAX},
+};
+
+static const char *_tier_name[RT_MEMTIER_CLASS_MAX] = {"fast", "dma", "bulk"};
+
+rt_inline rt_uint8_t _tier_select(rt_size_t size)
+{
+    if (size <= RT_MEMTIER_FAST_MAX_SIZE)
+        return RT_MEMTIER_FAST;
+    if (size >= RT_MEMTIER_BULK_MIN_SIZE)
+        return RT_MEMTIER_BULK;
+    return RT_MEMTIER_DMA;
+}
+
+static struct rt_memtier *_tier_find(void *ptr)
+{
+    int index;
+    rt_uintptr_t addr = (rt_uintptr_t)ptr;
+
+    for (index = 0; index < RT_MEMTIER_CLASS_MAX; index++)
+    {
+        struct rt_memtier *tier = &_tiers[index];
+        rt_uintptr_t start = (rt_uintptr_t)tier->heap.start_addr;
+
+        if (tier->attached && addr >= start && addr < start + tier->heap.pool_size)
+            return tier;
+    }
+
+    return RT_NULL;
+}
+
+/**
+ * @brief   This function attaches a memory region to a placement class.
+ *
+ * @note    Each class owns at most one region. The region is managed by a
+ *          memheap object named after the tier, so it is listed together with
+ *          the other memory heaps of the system.
+ *
+ * @param   tier_class is the placement class, RT_MEMTIER_FAST/DMA/BULK.
+ *
+ * @param   name is the name of the backing memheap.
+ *
+ * @param   begin_addr is the start address of the region.
+ *
+ * @param   size is the size of the region.
+ *
+ * @return  RT_EOK on success, -RT_EINVAL for a bad class and -RT_EBUSY if the
+ *          class already has a region attached.
+ */
+rt_err_t rt_memtier_attach(rt_uint8_t tier_class, const char *name,
+                           void *begin_addr, rt_size_t size)
+{
+    struct rt_memtier *tier;
+
+    RT_ASSERT(begin_addr != RT_NULL);
+
+    if (tier_class >= RT_MEMTIER_CLASS_MAX)
+        return -RT_EINVAL;
+
+    tier = &_tiers[tier_class];
+    if (tier->attached)
+        return -RT_EBUSY;
+
+    rt_memheap_init(&tier->heap, name, begin_addr, size);
+    rt_atomic_store(&tier->alloc_count, 0);
+    rt_atomic_store(&tier->live_count, 0);
+    rt_atomic_store(&tier->spill_count, 0);
+    rt_atomic_store(&tier->fail_count, 0);
+    tier->attached = RT_TRUE;
+
+    LOG_D("tier %s: region 0x%08x, size %d", _tier_name[tier_class], begin_addr, size);
+
+    return RT_EOK;
+}
+RTM_EXPORT(rt_memtier_attach);
+
+/**
+ * @brief   This function removes the region of a placement class.
+ *
+ * @param   tier_class is the placement class.
+ *
+ * @return  RT_EOK on success, -RT_EINVAL if nothing is attached.
+ */
+rt_err_t rt_memtier_detach(rt_uint8_t tier_class)
+{
+    struct rt_memtier *tier;
+
+    if (tier_class >= RT_MEMTIER_CLASS_MAX)
+        return -RT_EINVAL;
+
+    tier = &_tiers[tier_class];
+    if (!tier->attached)
+        return -RT_EINVAL;
+
+    tier->attached = RT_FALSE;
+    rt_memheap_detach(&tier->heap);
+
+    return RT_EOK;
+}
+RTM_EXPORT(rt_memtier_detach);
+
+/**
+ * @brief   Allocate a block of memory from the tier matching a placement class.
+ *
+ * @note    When the preferred tier is absent or exhausted the request falls
+ *          back along the placement order of the class. Fast requests larger
+ *          than RT_MEMTIER_FAST_MAX_SIZE skip the fast tier.
+ *
+ * @param   size is the minimum size of the requested block in bytes.
+ *
+ * @param   tier_class is the placement class, or RT_MEMTIER_AUTO to choose
+ *          it from the request size.
+ *
+ * @return  the pointer to allocated memory or NULL if no tier could satisfy it.
+ */
+void *rt_memtier_alloc(rt_size_t size, rt_uint8_t tier_class)
+{
+    int index;
+    void *ptr = RT_NULL;
+
+    if (tier_class == RT_MEMTIER_AUTO)
+        tier_class = _tier_select(size);
+    RT_ASSERT(tier_class < RT_MEMTIER_CLASS_MAX);
+
+    for (index = 0; index < RT_MEMTIER_CLASS_MAX; index++)
+    {
+        rt_uint8_t placed = _tier_order[tier_class][index];
+        struct rt_memtier *tier;
+
+        if (placed == RT_MEMTIER_CLASS_MAX)
+            break;
+        if (placed == RT_MEMTIER_FAST && size > RT_MEMTIER_FAST_MAX_SIZE)
+            continue;
+
+        tier = &_tiers[placed];
+        if (!tier->attached)
+            continue;
+
+        ptr = rt_memheap_alloc(&tier->heap, size);
+        if (ptr != RT_NULL)
+        {
+            rt_atomic_add(&tier->alloc_count, 1);
+            rt_atomic_add(&tier->live_count, 1);
+            if (placed != tier_class)
+                rt_atomic_add(&tier->spill_count, 1);
+            break;
+        }
+        rt_atomic_add(&tier->fail_count, 1);
+    }
+
+    return ptr;
+}
+RTM_EXPORT(rt_memtier_alloc);
+
+/**
+ * @brief   This function changes the size of a block allocated by rt_memtier_alloc.
+ *
+ * @note    The block is resized in place on its own tier when possible,
+ *          otherwise it moves to another tier of the same placement class.
+ *
+ * @param   ptr is the pointer to memory allocated by rt_memtier_alloc.
+ *
+ * @param   newsize is the required new size.
+ *
+ * @return  the changed memory block address.
+ */
+void *rt_memtier_realloc(void *ptr, rt_size_t newsize)
+{
+    struct rt_memtier *tier;
+    void *new_ptr;
+    rt_size_t oldsize;
+
+    if (ptr == RT_NULL)
+        return rt_memtier_alloc(newsize, RT_MEMTIER_AUTO);
+
+    if (newsize == 0)
+    {
+        rt_memtier_free(ptr);
+        return RT_NULL;
+    }
+
+    tier = _tier_find(ptr);
+    RT_ASSERT(tier != RT_NULL);
+
+    /* a fast block that outgrows the fast tier has to move */
+    if (tier != &_tiers[RT_MEMTIER_FAST] || newsize <= RT_MEMTIER_FAST_MAX_SIZE)
+    {
+        new_ptr = rt_memheap_realloc(&tier->heap, ptr, newsize);
+        if (new_ptr != RT_NULL)
+            return new_ptr;
+    }
+
+    new_ptr = rt_memtier_alloc(newsize, (rt_uint8_t)(tier - _tiers));
+    if (new_ptr != RT_NULL)
+    {
+        oldsize = MEMTIER_BLOCK_SIZE(ptr);
+        rt_memcpy(new_ptr, ptr, oldsize < newsize ? oldsize : newsize);
+        rt_memheap_free(ptr);
+        rt_atomic_sub(&tier->live_count, 1);
+    }
+
+    return new_ptr;
+}
+RTM_EXPORT(rt_memtier_realloc);
+
+/**
+ * @brief   This function releases a block allocated by rt_memtier_alloc.
+ *
+ * @param   ptr the address of memory which will be released.
+ */
+void rt_memtier_free(void *ptr)
+{
+    struct rt_memtier *tier;
+
+    if (ptr == RT_NULL)
+        return;
+
+    tier = _tier_find(ptr);
+    RT_ASSERT(tier != RT_NULL);
+    rt_memheap_free(ptr);
+    rt_atomic_sub(&tier->live_count, 1);
+}
+RTM_EXPORT(rt_memtier_free);
+
+/**
+ * @brief   This function returns the tier that a block lives on.
+ *
+ * @param   ptr is the pointer to memory allocated by rt_memtier_alloc.
+ *
+ * @return  the placement class of the tier, or RT_MEMTIER_CLASS_MAX if the
+ *          pointer is not inside any tier.
+ */
+rt_uint8_t rt_memtier_class_of(void *ptr)
+{
+    struct rt_memtier *tier = _tier_find(ptr);
+
+    if (tier == RT_NULL)
+        return RT_MEMTIER_CLASS_MAX;
+    return (rt_uint8_t)(tier - _tiers);
+}
+RTM_EXPORT(rt_memtier_class_of);
+
+/**
+ * @brief   This function reports the usage of a tier.
+ *
+ * @param   tier_class is the placement class.
+ *
+ * @param   info is the usage report to fill.
+ *
+ * @return  RT_EOK on success, -RT_EINVAL if nothing is attached.
+ */
+rt_err_t rt_memtier_get_info(rt_uint8_t tier_class, struct rt_memtier_info *info)
+{
+    struct rt_memtier *tier;
+
+    RT_ASSERT(info != RT_NULL);
+
+    if (tier_class >= RT_MEMTIER_CLASS_MAX || !_tiers[tier_class].attached)
+        return -RT_EINVAL;
+
+    tier = &_tiers[tier_class];
+    rt_memheap_info(&tier->heap, &info->total, &info->used, &info->max_used);
+    info->alloc_count = (rt_size_t)rt_atomic_load(&tier->alloc_count);
+    info->live_count  = (rt_size_t)rt_atomic_load(&tier->live_count);
+    info->spill_count = (rt_size_t)rt_atomic_load(&tier->spill_count);
+    info->fail_count  = (rt_size_t)rt_atomic_load(&tier->fail_count);
+
+    return RT_EOK;
+}
+RTM_EXPORT(rt_memtier_get_info);
+
+#ifdef RT_USING_FINSH
+static int memtier(int argc, char *argv[])
+{
+    struct rt_memtier_info info;
+    int index;
+
+    rt_kprintf("tier  heap     total      used       max used   alloc    live     spill    fail\n");
+    rt_kprintf("----- -------- ---------- ---------- ---------- -------- -------- -------- --------\n");
+    for (index = 0; index < RT_MEMTIER_CLASS_MAX; index++)
+    {
+        if (rt_memtier_get_info(index, &info) != RT_EOK)
+            continue;
+
+        rt_kprintf("%-5s %-*.*s %-10d %-10d %-10d %-8d %-8d %-8d %-8d\n",
+                   _tier_name[index], RT_NAME_MAX, RT_NAME_MAX,
+                   _tiers[index].heap.parent.name,
+                   info.total, info.used, info.max_used,
+                   info.alloc_count, info.live_count, info.spill_count, info.fail_count);
+    }
+    return 0;
+}
+MSH_CMD_EXPORT(memtier, dump usage of placement tiers);
+#endif /* RT_USING_FINSH */
+#endif /* RT_USING_MEMTIER */
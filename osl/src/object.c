@@ -16,6 +16,7 @@
  * 2022-01-07     Gabriel      Moving __on_rt_xxxxx_hook to object.c
  * 2023-09-15     xqyjlj       perf rt_hw_interrupt_disable/enable
  * 2023-11-17     xqyjlj       add process group and session support
+ * 2026-10-19     proyrb       add per class object caches
  */
 
 #include <rtthread.h>
@@ -55,6 +56,12 @@ enum rt_object_info_type
 #ifdef RT_USING_EVENT
     RT_Object_Info_Event,                              /**< The object is a event. */
 #endif
+#ifdef RT_USING_RWLOCK
+    RT_Object_Info_RWLock,                             /**< The object is a reader-writer lock. */
+#endif
+#ifdef RT_USING_SEQLOCK
+    RT_Object_Info_SeqLock,                            /**< The object is a sequence lock. */
+#endif
 #ifdef RT_USING_MAILBOX
     RT_Object_Info_MailBox,                            /**< The object is a mail box. */
 #endif
@@ -107,6 +114,14 @@ static struct rt_object_information _object_container[RT_Object_Info_Unknown] =
     /* initialize object container - event */
     {RT_Object_Class_Event, _OBJ_CONTAINER_LIST_INIT(RT_Object_Info_Event), sizeof(struct rt_event), RT_SPINLOCK_INIT},
 #endif
+#ifdef RT_USING_RWLOCK
+    /* initialize object container - reader-writer lock */
+    {RT_Object_Class_RWLock, _OBJ_CONTAINER_LIST_INIT(RT_Object_Info_RWLock), sizeof(struct rt_rwlock), RT_SPINLOCK_INIT},
+#endif
+#ifdef RT_USING_SEQLOCK
+    /* initialize object container - sequence lock */
+    {RT_Object_Class_SeqLock, _OBJ_CONTAINER_LIST_INIT(RT_Object_Info_SeqLock), sizeof(struct rt_seqlock), RT_SPINLOCK_INIT},
+#endif
 #ifdef RT_USING_MAILBOX
     /* initialize object container - mailbox */
     {RT_Object_Class_MailBox, _OBJ_CONTAINER_LIST_INIT(RT_Object_Info_MailBox), sizeof(struct rt_mailbox), RT_SPINLOCK_INIT},
@@ -459,6 +474,297 @@ void rt_object_detach(rt_object_t object)
 }
 
 #ifdef RT_USING_HEAP
+#ifdef RT_USING_OBJECT_CACHE
+/* objects in one slab of a class cache */
+#ifndef RT_OBJECT_CACHE_SLAB
+#define RT_OBJECT_CACHE_SLAB        4
+#endif
+/* free objects a class keeps by default instead of giving their slab back */
+#ifndef RT_OBJECT_CACHE_RESERVE
+#define RT_OBJECT_CACHE_RESERVE     RT_OBJECT_CACHE_SLAB
+#endif
+
+/*
+ * A slab is one heap block holding this header and a row of objects of a
+ * class. Each object is preceded by a tag pointing to its slab, or RT_NULL
+ * for an object taken from the heap one by one, so a deleted object finds
+ * its slab without searching. Free objects are chained through the list node of the object,
+ * which rt_object_allocate() rewrites anyway, so an object built by the
+ * constructor of the class stays built while it waits in the cache. The
+ * slabs and counters of a class are protected by the spinlock of its
+ * object information.
+ */
+struct _obj_slab
+{
+    struct _obj_slab *next;
+    rt_list_t *free;                            /* free objects, by their list node */
+    rt_uint16_t used;
+    rt_uint16_t total;
+};
+
+struct _obj_cache
+{
+    struct _obj_slab *slabs;                    /* oldest first */
+    rt_bool_t ready;                            /* defaults applied */
+    rt_uint16_t per_slab;                       /* 0: objects come from the heap one by one */
+    rt_uint16_t reserve;
+    void (*ctor)(rt_object_t object);
+    void (*dtor)(rt_object_t object);
+
+    rt_size_t slab_count;
+    rt_size_t free;
+    rt_size_t in_use;
+    rt_size_t peak;
+    rt_size_t alloc_count;
+    rt_size_t grow_count;
+    rt_size_t shrink_count;
+    rt_size_t fallback_count;
+    rt_size_t fail_count;
+};
+
+static struct _obj_cache _object_cache[RT_Object_Info_Unknown];
+
+#define _OBJ_SLAB_HEAD          RT_ALIGN(sizeof(struct _obj_slab), RT_ALIGN_SIZE)
+#define _OBJ_TAG_SIZE           RT_ALIGN(sizeof(struct _obj_slab *), RT_ALIGN_SIZE)
+#define _OBJ_STRIDE(info)       (_OBJ_TAG_SIZE + RT_ALIGN((info)->object_size, RT_ALIGN_SIZE))
+
+/* the cache of a class, with the class lock held */
+static struct _obj_cache *_obj_cache_of(struct rt_object_information *information)
+{
+    struct _obj_cache *cache = &_object_cache[information - _object_container];
+
+    if (!cache->ready)
+    {
+        cache->per_slab = RT_OBJECT_CACHE_SLAB;
+        cache->reserve = RT_OBJECT_CACHE_RESERVE;
+        cache->ready = RT_TRUE;
+    }
+
+    return cache;
+}
+
+rt_inline rt_object_t _obj_slab_object(struct _obj_slab *slab, rt_size_t stride, rt_uint16_t index)
+{
+    return (rt_object_t)((rt_uint8_t *)slab + _OBJ_SLAB_HEAD + index * stride + _OBJ_TAG_SIZE);
+}
+
+/* the tag in front of an object */
+rt_inline struct _obj_slab **_obj_tag(rt_object_t object)
+{
+    return (struct _obj_slab **)((rt_uint8_t *)object - _OBJ_TAG_SIZE);
+}
+
+static struct _obj_slab *_obj_slab_create(struct rt_object_information *information,
+                                          rt_uint16_t total, void (*ctor)(rt_object_t object))
+{
+    rt_size_t stride = _OBJ_STRIDE(information);
+    struct _obj_slab *slab;
+    rt_object_t object;
+    rt_uint16_t index;
+
+    slab = (struct _obj_slab *)RT_KERNEL_MALLOC(_OBJ_SLAB_HEAD + total * stride);
+    if (slab == RT_NULL)
+        return RT_NULL;
+
+    slab->next = RT_NULL;
+    slab->free = RT_NULL;
+    slab->used = 0;
+    slab->total = total;
+
+    /* chained from the back, objects are handed out in address order */
+    for (index = total; index > 0; index--)
+    {
+        object = _obj_slab_object(slab, stride, index - 1);
+        *_obj_tag(object) = slab;
+        if (ctor != RT_NULL)
+        {
+            rt_memset(object, 0x0, information->object_size);
+            ctor(object);
+        }
+        object->list.next = slab->free;
+        slab->free = &(object->list);
+    }
+
+    return slab;
+}
+
+static void _obj_slab_destroy(struct rt_object_information *information,
+                              struct _obj_slab *slab, void (*dtor)(rt_object_t object))
+{
+    rt_uint16_t index;
+
+    if (dtor != RT_NULL)
+    {
+        for (index = 0; index < slab->total; index++)
+            dtor(_obj_slab_object(slab, _OBJ_STRIDE(information), index));
+    }
+
+    RT_KERNEL_FREE(slab);
+}
+
+/* link a new slab in at the tail, with the class lock held */
+static void _obj_cache_add(struct _obj_cache *cache, struct _obj_slab *slab)
+{
+    struct _obj_slab **link;
+
+    for (link = &(cache->slabs); *link != RT_NULL; link = &((*link)->next));
+    *link = slab;
+
+    cache->slab_count++;
+    cache->free += slab->total;
+    cache->grow_count++;
+}
+
+/* unlink an empty slab going back to the heap, with the class lock held */
+static void _obj_cache_remove(struct _obj_cache *cache, struct _obj_slab *slab)
+{
+    struct _obj_slab **link;
+
+    for (link = &(cache->slabs); *link != slab; link = &((*link)->next));
+    *link = slab->next;
+
+    cache->slab_count--;
+    cache->free -= slab->total;
+    cache->shrink_count++;
+}
+
+/* take a free object, with the class lock held */
+static rt_object_t _obj_cache_pop(struct _obj_cache *cache)
+{
+    struct _obj_slab *slab;
+    rt_list_t *node;
+
+    for (slab = cache->slabs; slab != RT_NULL; slab = slab->next)
+    {
+        if (slab->free != RT_NULL)
+        {
+            node = slab->free;
+            slab->free = node->next;
+            slab->used++;
+
+            cache->free--;
+            cache->alloc_count++;
+            if (++cache->in_use > cache->peak)
+                cache->peak = cache->in_use;
+
+            return rt_list_entry(node, struct rt_object, list);
+        }
+    }
+
+    return RT_NULL;
+}
+
+/*
+ * Take an object of a class. It is built by the class constructor if there
+ * is one, which *built reports; otherwise it still has to be cleared.
+ */
+static rt_object_t _obj_cache_alloc(struct rt_object_information *information, rt_bool_t *built)
+{
+    void (*ctor)(rt_object_t object);
+    struct _obj_cache *cache;
+    struct _obj_slab *slab;
+    rt_object_t object;
+    rt_uint16_t per_slab;
+    rt_base_t level;
+
+    level = rt_spin_lock_irqsave(&(information->spinlock));
+    cache = _obj_cache_of(information);
+    ctor = cache->ctor;
+    per_slab = cache->per_slab;
+    object = _obj_cache_pop(cache);
+    rt_spin_unlock_irqrestore(&(information->spinlock), level);
+
+    *built = (ctor != RT_NULL);
+    if (object != RT_NULL)
+        return object;
+
+    if (per_slab > 0)
+    {
+        slab = _obj_slab_create(information, per_slab, ctor);
+        if (slab != RT_NULL)
+        {
+            level = rt_spin_lock_irqsave(&(information->spinlock));
+            _obj_cache_add(cache, slab);
+            object = _obj_cache_pop(cache);
+            rt_spin_unlock_irqrestore(&(information->spinlock), level);
+
+            return object;
+        }
+    }
+
+    /* no room for a slab, or the class is not cached */
+    object = RT_NULL;
+    slab = (struct _obj_slab *)RT_KERNEL_MALLOC(_OBJ_TAG_SIZE + information->object_size);
+    if (slab != RT_NULL)
+    {
+        object = (rt_object_t)((rt_uint8_t *)slab + _OBJ_TAG_SIZE);
+        *_obj_tag(object) = RT_NULL;
+    }
+
+    level = rt_spin_lock_irqsave(&(information->spinlock));
+    if (object != RT_NULL)
+    {
+        if (per_slab > 0)
+            cache->fallback_count++;
+        cache->alloc_count++;
+        if (++cache->in_use > cache->peak)
+            cache->peak = cache->in_use;
+    }
+    else
+    {
+        cache->fail_count++;
+    }
+    rt_spin_unlock_irqrestore(&(information->spinlock), level);
+
+    if (object != RT_NULL && ctor != RT_NULL)
+    {
+        rt_memset(object, 0x0, information->object_size);
+        ctor(object);
+    }
+
+    return object;
+}
+
+/*
+ * Give an object back. Called with the class lock held, which it releases.
+ * A slab left empty goes back to the heap unless the reserve needs it.
+ */
+static void _obj_cache_free(struct rt_object_information *information, rt_object_t object, rt_base_t level)
+{
+    struct _obj_cache *cache = _obj_cache_of(information);
+    void (*dtor)(rt_object_t object) = cache->dtor;
+    struct _obj_slab *slab = *_obj_tag(object);
+
+    cache->in_use--;
+
+    if (slab == RT_NULL)
+    {
+        rt_spin_unlock_irqrestore(&(information->spinlock), level);
+
+        if (dtor != RT_NULL)
+            dtor(object);
+        RT_KERNEL_FREE(_obj_tag(object));
+        return;
+    }
+
+    object->list.next = slab->free;
+    slab->free = &(object->list);
+    slab->used--;
+    cache->free++;
+
+    if (slab->used > 0 || cache->free - slab->total < cache->reserve)
+    {
+        rt_spin_unlock_irqrestore(&(information->spinlock), level);
+        return;
+    }
+
+    _obj_cache_remove(cache, slab);
+    rt_spin_unlock_irqrestore(&(information->spinlock), level);
+
+    _obj_slab_destroy(information, slab, dtor);
+}
+#endif /* RT_USING_OBJECT_CACHE */
+
 /**
  * @brief This function will allocate an object from object system.
  *
@@ -480,6 +786,7 @@ rt_object_t rt_object_allocate(enum rt_object_class_type type, const char *name)
     rt_base_t level;
     rt_size_t obj_name_len;
     struct rt_object_information *information;
+    rt_bool_t built = RT_FALSE;
 #ifdef RT_USING_MODULE
     struct rt_dlmodule *module = dlmodule_self();
 #endif /* RT_USING_MODULE */
@@ -490,7 +797,11 @@ rt_object_t rt_object_allocate(enum rt_object_class_type type, const char *name)
     information = rt_object_get_information(type);
     RT_ASSERT(information != RT_NULL);
 
+#ifdef RT_USING_OBJECT_CACHE
+    object = _obj_cache_alloc(information, &built);
+#else
     object = (struct rt_object *)RT_KERNEL_MALLOC(information->object_size);
+#endif /* RT_USING_OBJECT_CACHE */
     if (object == RT_NULL)
     {
         /* no memory can be allocated */
@@ -498,7 +809,8 @@ rt_object_t rt_object_allocate(enum rt_object_class_type type, const char *name)
     }
 
     /* clean memory data of object */
-    rt_memset(object, 0x0, information->object_size);
+    if (!built)
+        rt_memset(object, 0x0, information->object_size);
 
     /* initialize object's parameters */
 
@@ -574,6 +886,13 @@ void rt_object_delete(rt_object_t object)
     /* remove from old list */
     rt_list_remove(&(object->list));
 
+#ifdef RT_USING_OBJECT_CACHE
+    /* reset object type, before another thread can take the object again */
+    object->type = RT_Object_Class_Null;
+
+    /* back to the cache of its class */
+    _obj_cache_free(information, object, level);
+#else
     rt_spin_unlock_irqrestore(&(information->spinlock), level);
 
     /* reset object type */
@@ -581,7 +900,209 @@ void rt_object_delete(rt_object_t object)
 
     /* free the memory of object */
     RT_KERNEL_FREE(object);
+#endif /* RT_USING_OBJECT_CACHE */
+}
+
+#ifdef RT_USING_OBJECT_CACHE
+/**
+ * @brief This function will set up the object cache of a class.
+ *
+ * @note  Dynamic objects of a class are carved from slabs of per_slab objects, and a class keeps
+ *        reserve free objects instead of giving their slab back to the heap. The reserve is filled
+ *        right away. With a constructor, objects are built once when their slab is made and are not
+ *        cleared by rt_object_allocate(): the constructor has to leave them as the code creating
+ *        objects of the class expects them, and the objects have to be in that state again when
+ *        they are deleted. The destructor runs when a slab goes back to the heap.
+ *        The slab size and the hooks can only change while the class has no dynamic objects and
+ *        no slabs; call it before objects of the class are created.
+ *
+ * @param type is the type of object, which can be RT_Object_Class_Thread/Semaphore/Mutex... etc
+ *
+ * @param per_slab is the number of objects in a slab, 0 to take objects from the heap one by one.
+ *
+ * @param reserve is the number of free objects the class keeps.
+ *
+ * @param ctor is the constructor of the class objects, or RT_NULL.
+ *
+ * @param dtor is the destructor of the class objects, or RT_NULL.
+ *
+ * @return Return the operation status. RT_EOK on success, -RT_EINVAL for an unknown class,
+ *         -RT_EBUSY if the class is in use, -RT_ENOMEM if the reserve could not be filled.
+ */
+rt_err_t rt_object_cache_config(enum rt_object_class_type type,
+                                rt_uint16_t               per_slab,
+                                rt_uint16_t               reserve,
+                                void (*ctor)(rt_object_t object),
+                                void (*dtor)(rt_object_t object))
+{
+    struct rt_object_information *information;
+    struct _obj_cache *cache;
+    struct _obj_slab *slab;
+    rt_bool_t short_of;
+    rt_base_t level;
+
+    information = rt_object_get_information(type);
+    if (information == RT_NULL)
+        return -RT_EINVAL;
+
+    level = rt_spin_lock_irqsave(&(information->spinlock));
+    cache = _obj_cache_of(information);
+    if ((cache->slab_count > 0 || cache->in_use > 0) &&
+        (per_slab != cache->per_slab || ctor != cache->ctor || dtor != cache->dtor))
+    {
+        rt_spin_unlock_irqrestore(&(information->spinlock), level);
+        return -RT_EBUSY;
+    }
+    cache->per_slab = per_slab;
+    cache->reserve = per_slab > 0 ? reserve : 0;
+    cache->ctor = ctor;
+    cache->dtor = dtor;
+    rt_spin_unlock_irqrestore(&(information->spinlock), level);
+
+    for (;;)
+    {
+        level = rt_spin_lock_irqsave(&(information->spinlock));
+        short_of = cache->free < cache->reserve;
+        rt_spin_unlock_irqrestore(&(information->spinlock), level);
+        if (!short_of)
+            break;
+
+        slab = _obj_slab_create(information, per_slab, ctor);
+        if (slab == RT_NULL)
+            return -RT_ENOMEM;
+
+        level = rt_spin_lock_irqsave(&(information->spinlock));
+        _obj_cache_add(cache, slab);
+        rt_spin_unlock_irqrestore(&(information->spinlock), level);
+    }
+
+    return RT_EOK;
+}
+RTM_EXPORT(rt_object_cache_config);
+
+/**
+ * @brief This function will give the empty slabs of a class back to the heap, the reserve included.
+ *
+ * @param type is the type of object, which can be RT_Object_Class_Thread/Semaphore/Mutex... etc
+ *
+ * @return Return the number of slabs given back.
+ */
+rt_size_t rt_object_cache_shrink(enum rt_object_class_type type)
+{
+    struct rt_object_information *information;
+    void (*dtor)(rt_object_t object);
+    struct _obj_slab *slab;
+    struct _obj_cache *cache;
+    rt_size_t count = 0;
+    rt_base_t level;
+
+    information = rt_object_get_information(type);
+    if (information == RT_NULL)
+        return 0;
+
+    for (;;)
+    {
+        level = rt_spin_lock_irqsave(&(information->spinlock));
+        cache = _obj_cache_of(information);
+        for (slab = cache->slabs; slab != RT_NULL; slab = slab->next)
+        {
+            if (slab->used == 0)
+                break;
+        }
+
+        if (slab != RT_NULL)
+            _obj_cache_remove(cache, slab);
+        dtor = cache->dtor;
+        rt_spin_unlock_irqrestore(&(information->spinlock), level);
+
+        if (slab == RT_NULL)
+            break;
+
+        _obj_slab_destroy(information, slab, dtor);
+        count++;
+    }
+
+    return count;
+}
+RTM_EXPORT(rt_object_cache_shrink);
+
+/**
+ * @brief This function will report the object cache usage of a class.
+ *
+ * @param type is the type of object, which can be RT_Object_Class_Thread/Semaphore/Mutex... etc
+ *
+ * @param info is the report to fill.
+ *
+ * @return Return the operation status. RT_EOK on success, -RT_EINVAL for an unknown class.
+ */
+rt_err_t rt_object_cache_get_info(enum rt_object_class_type type, struct rt_object_cache_info *info)
+{
+    struct rt_object_information *information;
+    struct _obj_cache *cache;
+    rt_base_t level;
+
+    RT_ASSERT(info != RT_NULL);
+
+    information = rt_object_get_information(type);
+    if (information == RT_NULL)
+        return -RT_EINVAL;
+
+    level = rt_spin_lock_irqsave(&(information->spinlock));
+    cache = _obj_cache_of(information);
+    info->object_size    = information->object_size;
+    info->per_slab       = cache->per_slab;
+    info->reserve        = cache->reserve;
+    info->slabs          = cache->slab_count;
+    info->free           = cache->free;
+    info->in_use         = cache->in_use;
+    info->peak           = cache->peak;
+    info->alloc_count    = cache->alloc_count;
+    info->grow_count     = cache->grow_count;
+    info->shrink_count   = cache->shrink_count;
+    info->fallback_count = cache->fallback_count;
+    info->fail_count     = cache->fail_count;
+    rt_spin_unlock_irqrestore(&(information->spinlock), level);
+
+    return RT_EOK;
+}
+RTM_EXPORT(rt_object_cache_get_info);
+
+#ifdef RT_USING_FINSH
+static const char *const _obj_class_name[RT_Object_Class_Unknown] =
+{
+    "null", "thread", "semaphore", "mutex", "event", "mailbox", "msgqueue", "memheap",
+    "mempool", "device", "timer", "module", "memory", "channel", "pgroup", "session",
+    "custom", "rwlock", "seqlock",
+};
+
+static int objcache(int argc, char *argv[])
+{
+    struct rt_object_cache_info info;
+    enum rt_object_class_type type;
+    int index;
+
+    rt_kprintf("class      size slab rsv  slabs free  used  peak  alloc    grow   shrink heap   fail\n");
+    rt_kprintf("---------- ---- ---- ---- ----- ----- ----- ----- -------- ------ ------ ------ ----\n");
+    for (index = 0; index < RT_Object_Info_Unknown; index++)
+    {
+        type = _object_container[index].type;
+        if (rt_object_cache_get_info(type, &info) != RT_EOK)
+            continue;
+
+        rt_kprintf("%-10s %-4lu %-4u %-4u %-5lu %-5lu %-5lu %-5lu %-8lu %-6lu %-6lu %-6lu %-4lu\n",
+                   _obj_class_name[type], (unsigned long)info.object_size,
+                   (unsigned int)info.per_slab, (unsigned int)info.reserve,
+                   (unsigned long)info.slabs, (unsigned long)info.free,
+                   (unsigned long)info.in_use, (unsigned long)info.peak,
+                   (unsigned long)info.alloc_count, (unsigned long)info.grow_count,
+                   (unsigned long)info.shrink_count, (unsigned long)info.fallback_count,
+                   (unsigned long)info.fail_count);
+    }
+    return 0;
 }
+MSH_CMD_EXPORT(objcache, dump usage of the object caches);
+#endif /* RT_USING_FINSH */
+#endif /* RT_USING_OBJECT_CACHE */
 #endif /* RT_USING_HEAP */
 
 /**
@@ -9,6 +9,9 @@
  * Date           Author       Notes
  * 2024-01-18     Shell        Separate scheduling related codes from thread.c, scheduler_.*
  * 2025-09-01     Rbb666       Add thread stack overflow hook.
+ * 2026-10-19     proyrb       Charge deadline threads against their budget.
+ * 2026-10-19     proyrb       Run the periodic load balancing pass from the tick.
+ * 2026-10-19     proyrb       Leave suspend lists through rt_susp_list_remove().
  */
 
 #define DBG_TAG           "kernel.sched"
@@ -40,6 +43,10 @@ void rt_sched_thread_init_ctx(struct rt_thread *thread, rt_uint32_t tick, rt_uin
     /* not bind on any cpu */
     RT_SCHED_CTX(thread).bind_cpu = RT_CPUS_NR;
     RT_SCHED_CTX(thread).oncpu = RT_CPU_DETACHED;
+#ifdef RT_SCHED_USING_BALANCE
+    /* no last cpu yet, placed at the first wakeup */
+    RT_SCHED_CTX(thread).queue_cpu = RT_CPUS_NR;
+#endif /* RT_SCHED_USING_BALANCE */
 #endif /* RT_USING_SMP */
 
     rt_sched_thread_init_priv(thread, tick, priority);
@@ -179,6 +186,9 @@ rt_err_t rt_sched_thread_close(struct rt_thread *thread)
 {
     RT_SCHED_DEBUG_IS_LOCKED;
     RT_SCHED_CTX(thread).stat = RT_THREAD_CLOSE;
+#ifdef RT_USING_SCHED_DEADLINE
+    rt_sched_dl_close(thread);
+#endif /* RT_USING_SCHED_DEADLINE */
     return RT_EOK;
 }
 
@@ -256,7 +266,7 @@ rt_err_t rt_sched_thread_ready(struct rt_thread *thread)
         if (!error)
         {
             /* remove from suspend list */
-            rt_list_remove(&RT_THREAD_LIST_NODE(thread));
+            rt_susp_list_remove(thread);
 
         #ifdef RT_USING_SMART
             thread->wakeup_handle.func = RT_NULL;
@@ -295,8 +305,28 @@ rt_err_t rt_sched_tick_increase(rt_tick_t tick)
 
     thread = rt_thread_self();
 
+#if defined(RT_USING_SMP) && defined(RT_SCHED_USING_BALANCE)
+    rt_sched_balance_tick(tick);
+#endif /* defined(RT_USING_SMP) && defined(RT_SCHED_USING_BALANCE) */
+
     rt_sched_lock(&slvl);
 
+#ifdef RT_USING_SCHED_DEADLINE
+    /* deadline threads are charged against their budget, not a time slice */
+    if (RT_SCHED_PRIV(thread).dl_period != 0)
+    {
+        if (rt_sched_dl_tick(thread, tick))
+        {
+            rt_sched_unlock_n_resched(slvl);
+        }
+        else
+        {
+            rt_sched_unlock(slvl);
+        }
+        return RT_EOK;
+    }
+#endif /* RT_USING_SCHED_DEADLINE */
+
     if(RT_SCHED_PRIV(thread).remaining_tick > tick)
     {
         RT_SCHED_PRIV(thread).remaining_tick -= tick;
@@ -0,0 +1,304 @@
+/*
+ * Copyright (c) 2006-2026, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * (scheduler_dl.c) Earliest deadline first class on top of the priority scheduler.
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-19     proyrb       the first version
+ */
+
+#define DBG_TAG           "kernel.sched.dl"
+#define DBG_LVL           DBG_INFO
+#include <rtdbg.h>
+
+#include <rtthread.h>
+
+#ifdef RT_USING_SCHED_DEADLINE
+
+#ifdef RT_USING_SMP
+#error "RT_USING_SCHED_DEADLINE is only supported by the single core scheduler"
+#endif
+
+/*
+ * Upper bound of the summed density runtime / deadline of all deadline
+ * threads, in per mille. The rest is left to the fixed priority threads
+ * below the deadline band, the idle thread included.
+ */
+#ifndef RT_SCHED_DEADLINE_BW_MAX
+#define RT_SCHED_DEADLINE_BW_MAX    950
+#endif
+
+#define DL_BW_UNIT                  1000
+
+/* density already granted, protected by the scheduler lock */
+static rt_uint32_t _dl_bandwidth;
+
+rt_inline rt_uint32_t _dl_density(rt_tick_t runtime, rt_tick_t deadline)
+{
+    /* rounded up, so admission never grants more than it accounts */
+    return (rt_uint32_t)(((rt_uint64_t)runtime * DL_BW_UNIT + deadline - 1) / deadline);
+}
+
+rt_inline rt_uint32_t _dl_thread_density(struct rt_thread *thread)
+{
+    return _dl_density(RT_SCHED_PRIV(thread).dl_runtime, RT_SCHED_PRIV(thread).dl_deadline);
+}
+
+rt_inline void _dl_start_job(struct rt_thread *thread, rt_tick_t release)
+{
+    RT_SCHED_PRIV(thread).dl_release = release;
+    RT_SCHED_PRIV(thread).dl_abs_deadline = release + RT_SCHED_PRIV(thread).dl_deadline;
+    RT_SCHED_PRIV(thread).dl_budget = RT_SCHED_PRIV(thread).dl_runtime;
+}
+
+/**
+ * @brief Check whether a thread has to run before another one of the deadline band
+ *
+ * @param thread is a thread of the deadline band.
+ * @param other is the thread to compare with.
+ *
+ * @return RT_TRUE if the absolute deadline of thread is strictly earlier, or if
+ *         other is not in the deadline class at all.
+ */
+rt_bool_t rt_sched_dl_before(struct rt_thread *thread, struct rt_thread *other)
+{
+    RT_SCHED_DEBUG_IS_LOCKED;
+
+    if (!RT_SCHED_DL_ACTIVE(thread))
+        return RT_FALSE;
+    if (!RT_SCHED_DL_ACTIVE(other))
+        return RT_TRUE;
+
+    return (rt_int32_t)(RT_SCHED_PRIV(thread).dl_abs_deadline -
+                        RT_SCHED_PRIV(other).dl_abs_deadline) < 0;
+}
+
+/**
+ * @brief Insert a thread into the ready list of the deadline band
+ *
+ * @param ready_list is the ready list of RT_SCHED_DEADLINE_PRIORITY.
+ * @param thread is the thread to insert.
+ *
+ * @details The list is kept ordered by absolute deadline, threads with equal
+ *          deadlines stay in FIFO order. The head is the next one to run.
+ */
+void rt_sched_dl_insert(rt_list_t *ready_list, struct rt_thread *thread)
+{
+    rt_list_t *node;
+
+    for (node = ready_list->next; node != ready_list; node = node->next)
+    {
+        if (rt_sched_dl_before(thread, RT_THREAD_LIST_NODE_ENTRY(node)))
+            break;
+    }
+    rt_list_insert_before(node, &RT_THREAD_LIST_NODE(thread));
+}
+
+/**
+ * @brief Charge the running deadline thread for elapsed ticks
+ *
+ * @param thread is the running thread.
+ * @param tick is the number of ticks elapsed.
+ *
+ * @return RT_TRUE if the thread exhausted its budget and a reschedule is needed.
+ *
+ * @details A job that exhausts its budget is not stopped. As in a constant
+ *          bandwidth server its deadline is postponed by one period and the
+ *          budget refilled, so an overrunning thread can not take more than
+ *          its admitted share from the other deadline threads.
+ */
+rt_bool_t rt_sched_dl_tick(struct rt_thread *thread, rt_tick_t tick)
+{
+    RT_SCHED_DEBUG_IS_LOCKED;
+
+    if (RT_SCHED_PRIV(thread).dl_budget > tick)
+    {
+        RT_SCHED_PRIV(thread).dl_budget -= tick;
+        return RT_FALSE;
+    }
+
+    RT_SCHED_PRIV(thread).dl_overruns++;
+    RT_SCHED_PRIV(thread).dl_abs_deadline += RT_SCHED_PRIV(thread).dl_period;
+    RT_SCHED_PRIV(thread).dl_budget = RT_SCHED_PRIV(thread).dl_runtime;
+
+    return RT_TRUE;
+}
+
+/**
+ * @brief Give back the bandwidth of a closing thread
+ *
+ * @param thread is the thread being closed.
+ */
+void rt_sched_dl_close(struct rt_thread *thread)
+{
+    RT_SCHED_DEBUG_IS_LOCKED;
+
+    if (RT_SCHED_PRIV(thread).dl_period != 0)
+    {
+        _dl_bandwidth -= _dl_thread_density(thread);
+        RT_SCHED_PRIV(thread).dl_period = 0;
+    }
+}
+
+/**
+ * @brief Move a thread into or out of the deadline scheduling class
+ *
+ * @param thread is the thread to configure.
+ * @param attr is the period, runtime and relative deadline in ticks, or
+ *        RT_NULL to return the thread to its former fixed priority.
+ *
+ * @return Return the operation status. -RT_EINVAL for parameters that violate
+ *         runtime <= deadline <= period, -RT_EFULL if the thread does not fit
+ *         into the remaining deadline bandwidth.
+ *
+ * @details Deadline threads share the priority RT_SCHED_DEADLINE_PRIORITY, among
+ *          them the one with the earliest absolute deadline runs. Threads of a
+ *          higher fixed priority still preempt them. The first job is released
+ *          at once; a thread ends each job with rt_thread_wait_period().
+ */
+rt_err_t rt_thread_set_deadline(rt_thread_t thread, const struct rt_sched_deadline_attr *attr)
+{
+    rt_sched_lock_level_t slvl;
+    rt_tick_t deadline = 0;
+    rt_uint32_t density = 0, granted = 0;
+
+    RT_ASSERT(thread != RT_NULL);
+    RT_ASSERT(rt_object_get_type((rt_object_t)thread) == RT_Object_Class_Thread);
+
+    if (attr != RT_NULL)
+    {
+        deadline = attr->deadline ? attr->deadline : attr->period;
+        if (attr->runtime == 0 || attr->runtime > deadline || deadline > attr->period)
+            return -RT_EINVAL;
+        density = _dl_density(attr->runtime, deadline);
+    }
+
+    rt_sched_lock(&slvl);
+
+    if (RT_SCHED_PRIV(thread).dl_period != 0)
+        granted = _dl_thread_density(thread);
+
+    if (attr == RT_NULL)
+    {
+        if (RT_SCHED_PRIV(thread).dl_period != 0)
+        {
+            _dl_bandwidth -= granted;
+            RT_SCHED_PRIV(thread).dl_period = 0;
+            rt_sched_thread_reset_priority(thread, RT_SCHED_PRIV(thread).dl_saved_priority);
+        }
+        rt_sched_unlock_n_resched(slvl);
+        return RT_EOK;
+    }
+
+    if (_dl_bandwidth - granted + density > RT_SCHED_DEADLINE_BW_MAX)
+    {
+        rt_sched_unlock(slvl);
+        LOG_D("thread %.*s rejected, %d of %d per mille in use",
+              RT_NAME_MAX, thread->parent.name, _dl_bandwidth, RT_SCHED_DEADLINE_BW_MAX);
+        return -RT_EFULL;
+    }
+    _dl_bandwidth = _dl_bandwidth - granted + density;
+
+    if (RT_SCHED_PRIV(thread).dl_period == 0)
+        RT_SCHED_PRIV(thread).dl_saved_priority = RT_SCHED_PRIV(thread).init_priority;
+
+    RT_SCHED_PRIV(thread).dl_period = attr->period;
+    RT_SCHED_PRIV(thread).dl_runtime = attr->runtime;
+    RT_SCHED_PRIV(thread).dl_deadline = deadline;
+    RT_SCHED_PRIV(thread).dl_jobs = 0;
+    RT_SCHED_PRIV(thread).dl_misses = 0;
+    RT_SCHED_PRIV(thread).dl_overruns = 0;
+    _dl_start_job(thread, rt_tick_get());
+
+    /* moving into the band, or re-sorting a ready thread within it */
+    rt_sched_thread_reset_priority(thread, RT_SCHED_DEADLINE_PRIORITY);
+
+    rt_sched_unlock_n_resched(slvl);
+
+    return RT_EOK;
+}
+RTM_EXPORT(rt_thread_set_deadline);
+
+/**
+ * @brief Finish the current job and sleep until the next release
+ *
+ * @return Return the operation status. -RT_EINVAL if the calling thread is not
+ *         in the deadline class.
+ *
+ * @details A job finishing after its absolute deadline counts as a miss. The
+ *          next job is released one period after the previous release; if that
+ *          moment has already passed the job is released at once and the
+ *          period restarts from now.
+ */
+rt_err_t rt_thread_wait_period(void)
+{
+    struct rt_thread *thread = rt_thread_self();
+    rt_sched_lock_level_t slvl;
+    rt_tick_t now, release;
+
+    RT_DEBUG_SCHEDULER_AVAILABLE(RT_TRUE);
+
+    rt_sched_lock(&slvl);
+    if (RT_SCHED_PRIV(thread).dl_period == 0)
+    {
+        rt_sched_unlock(slvl);
+        return -RT_EINVAL;
+    }
+
+    now = rt_tick_get();
+    RT_SCHED_PRIV(thread).dl_jobs++;
+    if ((rt_int32_t)(now - RT_SCHED_PRIV(thread).dl_abs_deadline) > 0)
+        RT_SCHED_PRIV(thread).dl_misses++;
+
+    release = RT_SCHED_PRIV(thread).dl_release + RT_SCHED_PRIV(thread).dl_period;
+    if ((rt_int32_t)(release - now) < 0)
+        release = now;
+    _dl_start_job(thread, release);
+    rt_sched_unlock(slvl);
+
+    if (release != now)
+        return rt_thread_delay(release - now);
+
+    return RT_EOK;
+}
+RTM_EXPORT(rt_thread_wait_period);
+
+/**
+ * @brief Read the job accounting of a deadline thread
+ *
+ * @param thread is the thread to query.
+ * @param stat receives the counters.
+ *
+ * @return Return the operation status. -RT_EINVAL if the thread is not in the
+ *         deadline class.
+ */
+rt_err_t rt_thread_get_deadline_stat(rt_thread_t thread, struct rt_sched_deadline_stat *stat)
+{
+    rt_sched_lock_level_t slvl;
+    rt_err_t error = RT_EOK;
+
+    RT_ASSERT(thread != RT_NULL);
+    RT_ASSERT(stat != RT_NULL);
+
+    rt_sched_lock(&slvl);
+    if (RT_SCHED_PRIV(thread).dl_period != 0)
+    {
+        stat->jobs = RT_SCHED_PRIV(thread).dl_jobs;
+        stat->misses = RT_SCHED_PRIV(thread).dl_misses;
+        stat->overruns = RT_SCHED_PRIV(thread).dl_overruns;
+        stat->abs_deadline = RT_SCHED_PRIV(thread).dl_abs_deadline;
+    }
+    else
+    {
+        error = -RT_EINVAL;
+    }
+    rt_sched_unlock(slvl);
+
+    return error;
+}
+RTM_EXPORT(rt_thread_get_deadline_stat);
+
+#endif /* RT_USING_SCHED_DEADLINE */
@@ -34,6 +34,7 @@
  * 2024-01-05     Shell        Fixup of data racing in rt_critical_level
  * 2024-01-18     Shell        support rt_sched_thread of scheduling status for better mt protection
  * 2024-01-18     Shell        support rt_hw_thread_self to improve overall performance
+ * 2026-10-19     proyrb       queue unbound threads per cpu and balance them, RT_SCHED_USING_BALANCE
  */
 
 #include <rtthread.h>
@@ -118,6 +119,30 @@ static rt_uint32_t rt_thread_ready_priority_group;
 static rt_uint8_t rt_thread_ready_table[32];
 #endif /* RT_THREAD_PRIORITY_MAX > 32 */
 
+#ifdef RT_SCHED_USING_BALANCE
+/* ticks between two periodic balancing passes of a cpu */
+#ifndef RT_SCHED_BALANCE_INTERVAL
+#define RT_SCHED_BALANCE_INTERVAL   10
+#endif
+
+#define IDLE_PRIORITY               (RT_THREAD_PRIORITY_MAX - 1)
+
+/* balancing state of a cpu, protected by the scheduler lock */
+struct _balance_cpu
+{
+    rt_tick_t                       elapsed;    /* ticks since the last periodic pass */
+    struct rt_sched_balance_stat    stat;
+};
+static struct _balance_cpu _balance[RT_CPUS_NR];
+
+/* unbound threads wait on the ready queue of a cpu as well */
+#define SCHED_QUEUE_CPU(thread)     (RT_SCHED_CTX(thread).queue_cpu)
+
+#else /* !RT_SCHED_USING_BALANCE */
+#define SCHED_QUEUE_CPU(thread)     (RT_SCHED_CTX(thread).bind_cpu)
+
+#endif /* RT_SCHED_USING_BALANCE */
+
 /**
  * Used only on scheduler for optimization of control flows, where the critical
  * region is already guaranteed.
@@ -273,36 +298,17 @@ static struct rt_thread* _scheduler_get_highest_priority_thread(rt_ubase_t *high
 }
 
 /**
- * @brief   set READY and insert thread to ready queue
+ * @brief   put a READY thread on the ready queue of a cpu, RT_CPUS_NR for
+ *          the global one
  *
  * @note    caller must holding the `_mp_scheduler_lock` lock
  */
-static void _sched_insert_thread_locked(struct rt_thread *thread)
+static void _sched_enqueue_locked(struct rt_thread *thread, int bind_cpu)
 {
     int cpu_id;
-    int bind_cpu;
     rt_uint32_t cpu_mask;
 
-    if ((RT_SCHED_CTX(thread).stat & RT_THREAD_STAT_MASK) == RT_THREAD_READY)
-    {
-        /* already in ready queue */
-        return ;
-    }
-    else if (RT_SCHED_CTX(thread).oncpu != RT_CPU_DETACHED)
-    {
-        /**
-         * only YIELD -> READY, SUSPEND -> READY is allowed by this API. However,
-         * this is a RUNNING thread. So here we reset it's status and let it go.
-         */
-        RT_SCHED_CTX(thread).stat = RT_THREAD_RUNNING | (RT_SCHED_CTX(thread).stat & ~RT_THREAD_STAT_MASK);
-        return ;
-    }
-
-    /* READY thread, insert to ready queue */
-    RT_SCHED_CTX(thread).stat = RT_THREAD_READY | (RT_SCHED_CTX(thread).stat & ~RT_THREAD_STAT_MASK);
-
-    cpu_id   = rt_hw_cpu_id();
-    bind_cpu = RT_SCHED_CTX(thread).bind_cpu;
+    cpu_id = rt_hw_cpu_id();
 
     /* insert thread to ready list */
     if (bind_cpu == RT_CPUS_NR)
@@ -355,8 +361,123 @@ static void _sched_insert_thread_locked(struct rt_thread *thread)
             cpu_mask = 1 << bind_cpu;
             rt_hw_ipi_send(RT_SCHEDULE_IPI, cpu_mask);
         }
+
+#ifdef RT_SCHED_USING_BALANCE
+        if (RT_SCHED_CTX(thread).bind_cpu == RT_CPUS_NR)
+        {
+            _balance[bind_cpu].stat.nr_queued++;
+        }
+#endif /* RT_SCHED_USING_BALANCE */
+    }
+
+#ifdef RT_SCHED_USING_BALANCE
+    RT_SCHED_CTX(thread).queue_cpu = bind_cpu;
+#endif /* RT_SCHED_USING_BALANCE */
+}
+
+#ifdef RT_SCHED_USING_BALANCE
+rt_inline rt_bool_t _balance_cpu_is_idle(int cpu)
+{
+    return rt_cpu_index(cpu)->current_priority == IDLE_PRIORITY &&
+           _balance[cpu].stat.nr_queued == 0;
+}
+
+/**
+ * @brief   choose the ready queue of an unbound thread at wakeup
+ *
+ * @details The thread stays on the cpu it last ran on while that one would run
+ *          it at once, since its cache is still warm there. Otherwise an idle
+ *          cpu is taken, then the cpu running the least important thread the
+ *          woken one preempts. If every cpu is busy with more important work
+ *          the thread waits on its last cpu for the balancing passes.
+ *
+ * @note    caller must holding the `_mp_scheduler_lock` lock
+ */
+static int _balance_select_cpu_locked(struct rt_thread *thread)
+{
+    rt_uint8_t priority = RT_SCHED_PRIV(thread).current_priority;
+    rt_uint8_t lowest = priority;
+    int home = RT_SCHED_CTX(thread).queue_cpu;
+    int target = RT_CPUS_NR;
+    int cpu;
+
+    if (home < RT_CPUS_NR &&
+        (_balance_cpu_is_idle(home) || priority < rt_cpu_index(home)->current_priority))
+    {
+        return home;
+    }
+
+    for (cpu = 0; cpu < RT_CPUS_NR; cpu++)
+    {
+        if (cpu == home)
+            continue;
+
+        if (_balance_cpu_is_idle(cpu))
+        {
+            target = cpu;
+            break;
+        }
+
+        if (rt_cpu_index(cpu)->current_priority > lowest)
+        {
+            lowest = rt_cpu_index(cpu)->current_priority;
+            target = cpu;
+        }
     }
 
+    if (target == RT_CPUS_NR)
+    {
+        return home < RT_CPUS_NR ? home : rt_hw_cpu_id();
+    }
+
+    if (home < RT_CPUS_NR)
+    {
+        _balance[target].stat.wake_migrations++;
+    }
+
+    return target;
+}
+#endif /* RT_SCHED_USING_BALANCE */
+
+/**
+ * @brief   set READY and insert thread to ready queue
+ *
+ * @note    caller must holding the `_mp_scheduler_lock` lock
+ */
+static void _sched_insert_thread_locked(struct rt_thread *thread)
+{
+    int bind_cpu;
+
+    if ((RT_SCHED_CTX(thread).stat & RT_THREAD_STAT_MASK) == RT_THREAD_READY)
+    {
+        /* already in ready queue */
+        return ;
+    }
+    else if (RT_SCHED_CTX(thread).oncpu != RT_CPU_DETACHED)
+    {
+        /**
+         * only YIELD -> READY, SUSPEND -> READY is allowed by this API. However,
+         * this is a RUNNING thread. So here we reset it's status and let it go.
+         */
+        RT_SCHED_CTX(thread).stat = RT_THREAD_RUNNING | (RT_SCHED_CTX(thread).stat & ~RT_THREAD_STAT_MASK);
+        return ;
+    }
+
+    /* READY thread, insert to ready queue */
+    RT_SCHED_CTX(thread).stat = RT_THREAD_READY | (RT_SCHED_CTX(thread).stat & ~RT_THREAD_STAT_MASK);
+
+    bind_cpu = RT_SCHED_CTX(thread).bind_cpu;
+
+#ifdef RT_SCHED_USING_BALANCE
+    /* unbound threads are queued on a cpu too, chosen at wakeup */
+    if (bind_cpu == RT_CPUS_NR)
+    {
+        bind_cpu = _balance_select_cpu_locked(thread);
+    }
+#endif /* RT_SCHED_USING_BALANCE */
+
+    _sched_enqueue_locked(thread, bind_cpu);
+
     LOG_D("insert thread[%.*s], the priority: %d",
           RT_NAME_MAX, thread->parent.name, RT_SCHED_PRIV(thread).current_priority);
 }
@@ -371,7 +492,7 @@ static void _sched_remove_thread_locked(struct rt_thread *thread)
     /* remove thread from ready list */
     rt_list_remove(&RT_THREAD_LIST_NODE(thread));
 
-    if (RT_SCHED_CTX(thread).bind_cpu == RT_CPUS_NR)
+    if (SCHED_QUEUE_CPU(thread) == RT_CPUS_NR)
     {
         if (rt_list_isempty(&(rt_thread_priority_table[RT_SCHED_PRIV(thread).current_priority])))
         {
@@ -388,7 +509,14 @@ static void _sched_remove_thread_locked(struct rt_thread *thread)
     }
     else
     {
-        struct rt_cpu *pcpu = rt_cpu_index(RT_SCHED_CTX(thread).bind_cpu);
+        struct rt_cpu *pcpu = rt_cpu_index(SCHED_QUEUE_CPU(thread));
+
+#ifdef RT_SCHED_USING_BALANCE
+        if (RT_SCHED_CTX(thread).bind_cpu == RT_CPUS_NR)
+        {
+            _balance[SCHED_QUEUE_CPU(thread)].stat.nr_queued--;
+        }
+#endif /* RT_SCHED_USING_BALANCE */
 
         if (rt_list_isempty(&(pcpu->priority_table[RT_SCHED_PRIV(thread).current_priority])))
         {
@@ -405,6 +533,200 @@ static void _sched_remove_thread_locked(struct rt_thread *thread)
     }
 }
 
+#ifdef RT_SCHED_USING_BALANCE
+rt_inline rt_bool_t _balance_prio_ready(struct rt_cpu *pcpu, rt_ubase_t priority)
+{
+#if RT_THREAD_PRIORITY_MAX > 32
+    return (pcpu->ready_table[priority >> 3] & (1U << (priority & 0x07))) != 0;
+#else
+    return (pcpu->priority_group & (1UL << priority)) != 0;
+#endif /* RT_THREAD_PRIORITY_MAX > 32 */
+}
+
+/*
+ * the best priority this cpu would run next, the current thread included
+ * while it may stay here
+ */
+static rt_ubase_t _balance_best_prio(int cpu_id, struct rt_cpu *pcpu, struct rt_thread *current_thread)
+{
+    rt_ubase_t best = (rt_ubase_t)_get_local_highest_ready_prio(pcpu);
+    rt_ubase_t global = (rt_ubase_t)_get_global_highest_ready_prio();
+
+    if (global < best)
+        best = global;
+
+    if (current_thread &&
+        (RT_SCHED_CTX(current_thread).stat & RT_THREAD_STAT_MASK) == RT_THREAD_RUNNING &&
+        (RT_SCHED_CTX(current_thread).bind_cpu == RT_CPUS_NR ||
+         RT_SCHED_CTX(current_thread).bind_cpu == cpu_id) &&
+        RT_SCHED_PRIV(current_thread).current_priority < best)
+    {
+        best = RT_SCHED_PRIV(current_thread).current_priority;
+    }
+
+    return best;
+}
+
+/**
+ * @brief   find an unbound thread to pull from the ready queue of another cpu
+ *
+ * @param   cpu_id is the pulling cpu.
+ * @param   limit only threads of a better priority than this are taken.
+ * @param   min_queued only cpus with at least so many unbound threads queued
+ *          are looked at.
+ *
+ * @return  the best such thread, RT_NULL if none
+ *
+ * @details Threads ranking above the one running on their cpu are skipped,
+ *          that cpu is about to switch to them anyway.
+ *
+ * @note    caller must holding the `_mp_scheduler_lock` lock
+ */
+static struct rt_thread *_balance_find_locked(int cpu_id, rt_ubase_t limit, rt_uint32_t min_queued)
+{
+    struct rt_thread *found = RT_NULL;
+    struct rt_thread *thread;
+    struct rt_cpu *pcpu;
+    rt_ubase_t priority;
+    rt_list_t *node;
+    int cpu;
+
+    for (cpu = 0; cpu < RT_CPUS_NR; cpu++)
+    {
+        pcpu = rt_cpu_index(cpu);
+        if (cpu == cpu_id || _balance[cpu].stat.nr_queued < min_queued)
+            continue;
+
+        for (priority = pcpu->current_priority; priority < limit; priority++)
+        {
+            if (!_balance_prio_ready(pcpu, priority))
+                continue;
+
+            rt_list_for_each(node, &(pcpu->priority_table[priority]))
+            {
+                thread = RT_THREAD_LIST_NODE_ENTRY(node);
+                if (RT_SCHED_CTX(thread).bind_cpu == RT_CPUS_NR)
+                {
+                    /* other cpus have to offer a better one from now on */
+                    found = thread;
+                    limit = priority;
+                    break;
+                }
+            }
+        }
+    }
+
+    return found;
+}
+
+/* move a READY unbound thread to the ready queue of the calling cpu */
+static void _balance_pull_locked(struct rt_thread *thread, int cpu_id)
+{
+    _sched_remove_thread_locked(thread);
+    _sched_enqueue_locked(thread, cpu_id);
+
+    LOG_D("[cpu#%d] pull thread[%.*s]", cpu_id, RT_NAME_MAX, thread->parent.name);
+}
+
+/**
+ * @brief   on idle entry, pull a thread waiting behind others on a busier cpu
+ *
+ * @note    caller must holding the `_mp_scheduler_lock` lock
+ */
+static void _balance_idle_locked(int cpu_id, struct rt_cpu *pcpu, struct rt_thread *current_thread)
+{
+    struct rt_thread *thread;
+
+    if (_balance_best_prio(cpu_id, pcpu, current_thread) < IDLE_PRIORITY)
+        return;
+
+    thread = _balance_find_locked(cpu_id, IDLE_PRIORITY, 1);
+    if (thread)
+    {
+        _balance_pull_locked(thread, cpu_id);
+        _balance[cpu_id].stat.idle_pulls++;
+    }
+}
+
+/**
+ * @brief Periodic balancing pass of the calling cpu, run from its tick
+ *
+ * @param tick is the number of ticks elapsed.
+ *
+ * @details Every RT_SCHED_BALANCE_INTERVAL ticks the cpu pulls one unbound
+ *          thread that waits elsewhere while it would run it now. Failing that
+ *          it pulls one from a cpu queueing at least two unbound threads more
+ *          than itself, which evens out the queues of equal priority threads.
+ */
+void rt_sched_balance_tick(rt_tick_t tick)
+{
+    rt_sched_lock_level_t slvl;
+    struct rt_thread *thread;
+    struct rt_cpu *pcpu;
+    int cpu_id;
+
+    rt_sched_lock(&slvl);
+
+    cpu_id = rt_hw_cpu_id();
+    pcpu = rt_cpu_index(cpu_id);
+
+    _balance[cpu_id].elapsed += tick;
+    if (_balance[cpu_id].elapsed < RT_SCHED_BALANCE_INTERVAL)
+    {
+        rt_sched_unlock(slvl);
+        return;
+    }
+    _balance[cpu_id].elapsed = 0;
+
+    thread = _balance_find_locked(cpu_id, _balance_best_prio(cpu_id, pcpu, pcpu->current_thread), 1);
+    if (thread == RT_NULL)
+    {
+        thread = _balance_find_locked(cpu_id, RT_THREAD_PRIORITY_MAX,
+                                      _balance[cpu_id].stat.nr_queued + 2);
+    }
+
+    if (thread)
+    {
+        _balance_pull_locked(thread, cpu_id);
+        _balance[cpu_id].stat.tick_pulls++;
+
+        /* request a rescheduling even though we are probably in an ISR */
+        rt_sched_unlock_n_resched(slvl);
+    }
+    else
+    {
+        rt_sched_unlock(slvl);
+    }
+}
+
+/**
+ * @brief Get the thread migration counters of a cpu
+ *
+ * @param cpu is the index of the cpu.
+ * @param stat receives the counters.
+ *
+ * @return rt_err_t
+ *   - RT_EOK: Success
+ *   - -RT_EINVAL: no such cpu
+ *
+ * @note This function only has MP version.
+ */
+rt_err_t rt_scheduler_get_balance_stat(int cpu, struct rt_sched_balance_stat *stat)
+{
+    rt_base_t level;
+
+    if (cpu < 0 || cpu >= RT_CPUS_NR || stat == RT_NULL)
+        return -RT_EINVAL;
+
+    SCHEDULER_LOCK(level);
+    *stat = _balance[cpu].stat;
+    SCHEDULER_UNLOCK(level);
+
+    return RT_EOK;
+}
+RTM_EXPORT(rt_scheduler_get_balance_stat);
+#endif /* RT_SCHED_USING_BALANCE */
+
 /**
  * @brief Initialize the system scheduler.
  *
@@ -465,6 +787,10 @@ void rt_system_scheduler_init(void)
     /* initialize ready priority group */
     rt_thread_ready_priority_group = 0;
 
+#ifdef RT_SCHED_USING_BALANCE
+    rt_memset(_balance, 0, sizeof(_balance));
+#endif /* RT_SCHED_USING_BALANCE */
+
 #if RT_THREAD_PRIORITY_MAX > 32
     /* initialize ready table */
     rt_memset(rt_thread_ready_table, 0, sizeof(rt_thread_ready_table));
@@ -518,6 +844,9 @@ void rt_system_scheduler_start(void)
 
     /* to_thread is picked to running on current core, so remove it from ready queue */
     _sched_remove_thread_locked(to_thread);
+#ifdef RT_SCHED_USING_BALANCE
+    RT_SCHED_CTX(to_thread).queue_cpu = rt_hw_cpu_id();
+#endif /* RT_SCHED_USING_BALANCE */
 
     /* dedigate current core to `to_thread` */
     RT_SCHED_CTX(to_thread).oncpu = rt_hw_cpu_id();
@@ -629,6 +958,11 @@ static rt_thread_t _prepare_context_switch_locked(int cpu_id,
     rt_thread_t to_thread = RT_NULL;
     rt_ubase_t highest_ready_priority;
 
+#ifdef RT_SCHED_USING_BALANCE
+    /* about to idle, fetch a thread waiting on a busier cpu first */
+    _balance_idle_locked(cpu_id, pcpu, current_thread);
+#endif /* RT_SCHED_USING_BALANCE */
+
     /* quickly check if any other ready threads queuing */
     if (rt_thread_ready_priority_group != 0 || pcpu->priority_group != 0)
     {
@@ -691,6 +1025,9 @@ static rt_thread_t _prepare_context_switch_locked(int cpu_id,
 
             /* remove to_thread from ready queue and update its status to RUNNING */
             _sched_remove_thread_locked(to_thread);
+#ifdef RT_SCHED_USING_BALANCE
+            RT_SCHED_CTX(to_thread).queue_cpu = cpu_id;
+#endif /* RT_SCHED_USING_BALANCE */
             RT_SCHED_CTX(to_thread).stat = RT_THREAD_RUNNING | (RT_SCHED_CTX(to_thread).stat & ~RT_THREAD_STAT_MASK);
 
             RT_SCHEDULER_STACK_CHECK(to_thread);
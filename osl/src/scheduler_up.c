@@ -33,6 +33,7 @@
  * 2025-08-04     Pillar       Add rt_scheduler_critical_switch_flag
  * 2025-08-20     RyanCW       rt_scheduler_lock_nest use atomic operations
  * 2025-09-20     wdfk_prog    fix scheduling exception caused by interrupt preemption in rt_schedule
+ * 2026-10-19     proyrb       order the deadline band by absolute deadline
  */
 
 #define __RT_IPC_SOURCE__
@@ -310,6 +311,21 @@ void rt_schedule(void)
                 {
                     to_thread = curr_thread;
                 }
+#ifdef RT_USING_SCHED_DEADLINE
+                else if (highest_ready_priority == RT_SCHED_DEADLINE_PRIORITY
+                         && RT_SCHED_DL_ACTIVE(curr_thread))
+                {
+                    /* within the deadline band only an earlier deadline preempts */
+                    if (rt_sched_dl_before(to_thread, curr_thread))
+                    {
+                        need_insert_from_thread = 1;
+                    }
+                    else
+                    {
+                        to_thread = curr_thread;
+                    }
+                }
+#endif /* RT_USING_SCHED_DEADLINE */
                 else if (RT_SCHED_PRIV(curr_thread).current_priority == highest_ready_priority
                          && (RT_SCHED_CTX(curr_thread).stat & RT_THREAD_STAT_YIELD_MASK) == 0)
                 {
@@ -477,6 +493,11 @@ void rt_sched_thread_init_priv(struct rt_thread *thread, rt_uint32_t tick, rt_ui
     /* tick init */
     RT_SCHED_PRIV(thread).init_tick = tick;
     RT_SCHED_PRIV(thread).remaining_tick = tick;
+
+#ifdef RT_USING_SCHED_DEADLINE
+    /* fixed priority until rt_thread_set_deadline */
+    RT_SCHED_PRIV(thread).dl_period = 0;
+#endif /* RT_USING_SCHED_DEADLINE */
 }
 
 /**
@@ -505,6 +526,14 @@ void rt_sched_insert_thread(struct rt_thread *thread)
 
     /* READY thread, insert to ready queue */
     RT_SCHED_CTX(thread).stat = RT_THREAD_READY | (RT_SCHED_CTX(thread).stat & ~RT_THREAD_STAT_MASK);
+#ifdef RT_USING_SCHED_DEADLINE
+    /* the deadline band is ordered by absolute deadline instead */
+    if (RT_SCHED_PRIV(thread).current_priority == RT_SCHED_DEADLINE_PRIORITY)
+    {
+        rt_sched_dl_insert(&(rt_thread_priority_table[RT_SCHED_DEADLINE_PRIORITY]), thread);
+    }
+    else
+#endif /* RT_USING_SCHED_DEADLINE */
     /* there is no time slices left(YIELD), inserting thread before ready list*/
     if((RT_SCHED_CTX(thread).stat & RT_THREAD_STAT_YIELD_MASK) != 0)
     {
@@ -166,7 +166,7 @@ static void _thread_timeout(void *parameter)
     thread->error = -RT_ETIMEOUT;
 
     /* remove from suspend list */
-    rt_list_remove(&RT_THREAD_LIST_NODE(thread));
+    rt_susp_list_remove(thread);
     /* insert to schedule ready list */
     rt_sched_insert_thread(thread);
     /* do schedule and release the scheduler lock */
@@ -226,6 +226,12 @@ static rt_err_t _thread_init(struct rt_thread *thread,
     thread->event_info = 0;
 #endif /* RT_USING_EVENT */
 
+#ifdef RT_USING_IPC_PRIO_INDEX
+    thread->susp_list = RT_NULL;
+    rt_list_init(&(thread->susp_run));
+    thread->susp_run_head = RT_FALSE;
+#endif /* RT_USING_IPC_PRIO_INDEX */
+
     /* error and flags */
     thread->error = RT_EOK;
 
@@ -238,6 +244,10 @@ static rt_err_t _thread_init(struct rt_thread *thread,
     thread->cleanup   = 0;
     thread->user_data = 0;
 
+#ifdef RT_USING_HEAPPROF
+    thread->heapprof_tag = RT_NULL;
+#endif /* RT_USING_HEAPPROF */
+
     /* initialize thread timer */
     rt_timer_init(&(thread->thread_timer),
                   thread->parent.name,
@@ -451,7 +461,9 @@ rt_err_t rt_thread_close(rt_thread_t thread)
     {
         if (thread_status != RT_THREAD_INIT)
         {
-            /* remove from schedule */
+            /* leave the suspend list if suspended, then the schedule */
+            if (rt_sched_thread_is_suspended(thread))
+                rt_susp_list_remove(thread);
             rt_sched_remove_thread(thread);
         }
 
@@ -22,6 +22,7 @@
  * 2023-09-15     xqyjlj       perf rt_hw_interrupt_disable/enable
  * 2024-01-25     Shell        add RT_TIMER_FLAG_THREAD_TIMER for timer to sync with sched
  * 2024-05-01     wdfk-prog    The rt_timer_check and _soft_timer_check functions are merged
+ * 2026-10-19     proyrb       add timer slack to coalesce timeouts
  */
 
 #include <rtthread.h>
@@ -151,6 +152,9 @@ static void _timer_init(rt_timer_t timer,
 
     timer->timeout_tick = 0;
     timer->init_tick    = time;
+#ifdef RT_USING_TIMER_SLACK
+    timer->slack        = 0;
+#endif /* RT_USING_TIMER_SLACK */
 
     /* initialize timer list */
     for (i = 0; i < RT_TIMER_SKIP_LIST_LEVEL; i++)
@@ -399,14 +403,118 @@ rt_err_t rt_timer_delete(rt_timer_t timer)
 RTM_EXPORT(rt_timer_delete);
 #endif /* RT_USING_HEAP */
 
+#ifdef RT_USING_TIMER_SLACK
+/* the most a timer may be put off, and how far ahead expiring timers look for others */
+#ifndef RT_TIMER_SLACK_MAX
+#define RT_TIMER_SLACK_MAX      (RT_TICK_PER_SECOND / 2)
+#endif
+
+/**
+ * @brief [internal] Pick the timeout tick of a timer with slack
+ *
+ *        The timer may fire at any tick from timeout_tick to timeout_tick + slack.
+ *        If a timer in the list already expires in that window, the timer joins
+ *        it, so both are handled in one pass. Otherwise it takes the roundest tick
+ *        of the window, the one with the most low zero bits, where timers with
+ *        overlapping windows meet as well.
+ *
+ * @param timer_list is the array of time list
+ *
+ * @param timeout_tick is the earliest tick the timer may fire
+ *
+ * @param slack is the number of ticks the timer may be late
+ *
+ * @return the tick to fire at
+ */
+static rt_tick_t _timer_slack_tick(rt_list_t timer_list[], rt_tick_t timeout_tick, rt_tick_t slack)
+{
+    rt_list_t *head = &timer_list[RT_TIMER_SKIP_LIST_LEVEL - 1];
+    rt_tick_t limit = timeout_tick + slack;
+    rt_tick_t bits, delta;
+    rt_list_t *node;
+    struct rt_timer *t;
+
+    rt_list_for_each(node, head)
+    {
+        t = rt_list_entry(node, struct rt_timer, row[RT_TIMER_SKIP_LIST_LEVEL - 1]);
+
+        delta = t->timeout_tick - timeout_tick;
+        if (delta >= RT_TICK_MAX / 2)
+            continue;   /* before the window */
+        if (delta <= slack)
+            return t->timeout_tick;
+        break;          /* the list is sorted, nothing in the window */
+    }
+
+    /* the window wraps around, keep it simple */
+    if (limit < timeout_tick)
+        return timeout_tick;
+
+    /* keep the highest bit the window ends differ in, clear the ones below */
+    bits = timeout_tick ^ limit;
+    while (bits & (bits - 1))
+        bits &= bits - 1;
+
+    return bits ? (limit & ~(bits - 1)) : timeout_tick;
+}
+
+/**
+ * @brief [internal] Find a timer that may fire along with the current pass
+ *
+ *        When a pass expires timers anyway, timers with slack whose window is
+ *        open already are taken along, instead of waking up again later. Only
+ *        timers expiring within RT_TIMER_SLACK_MAX are looked at.
+ *
+ * @param timer_list is the array of time list
+ *
+ * @param current_tick is the current tick
+ *
+ * @param fired tells if the pass expired a timer already
+ *
+ * @return the timer to fire, or RT_NULL
+ */
+static struct rt_timer *_timer_slack_take(rt_list_t timer_list[], rt_tick_t current_tick, rt_bool_t fired)
+{
+    rt_list_t *head = &timer_list[RT_TIMER_SKIP_LIST_LEVEL - 1];
+    rt_list_t *node;
+    struct rt_timer *t;
+
+    if (!fired)
+        return RT_NULL;
+
+    rt_list_for_each(node, head)
+    {
+        t = rt_list_entry(node, struct rt_timer, row[RT_TIMER_SKIP_LIST_LEVEL - 1]);
+
+        if (t->timeout_tick - current_tick > RT_TIMER_SLACK_MAX)
+            break;
+        if (t->slack > 0 && (current_tick - t->due_tick) < RT_TICK_MAX / 2)
+            return t;
+    }
+
+    return RT_NULL;
+}
+#else
+rt_inline struct rt_timer *_timer_slack_take(rt_list_t timer_list[], rt_tick_t current_tick, rt_bool_t fired)
+{
+    RT_UNUSED(timer_list);
+    RT_UNUSED(current_tick);
+    RT_UNUSED(fired);
+
+    return RT_NULL;
+}
+#endif /* RT_USING_TIMER_SLACK */
+
 /**
  * @brief This function will start the timer
  *
  * @param timer the timer to be started
  *
+ * @param start_tick is the tick the timeout is counted from
+ *
  * @return the operation status, RT_EOK on OK, -RT_ERROR on error
  */
-static rt_err_t _timer_start(rt_list_t *timer_list, rt_timer_t timer)
+static rt_err_t _timer_start_at(rt_list_t *timer_list, rt_timer_t timer, rt_tick_t start_tick)
 {
     unsigned int row_lvl;
     rt_list_t *row_head[RT_TIMER_SKIP_LIST_LEVEL];
@@ -420,7 +528,14 @@ static rt_err_t _timer_start(rt_list_t *timer_list, rt_timer_t timer)
 
     RT_OBJECT_HOOK_CALL(rt_object_take_hook, (&(timer->parent)));
 
-    timer->timeout_tick = rt_tick_get() + timer->init_tick;
+    timer->timeout_tick = start_tick + timer->init_tick;
+#ifdef RT_USING_TIMER_SLACK
+    if (timer->slack > 0)
+    {
+        timer->due_tick = timer->timeout_tick;
+        timer->timeout_tick = _timer_slack_tick(timer_list, timer->timeout_tick, timer->slack);
+    }
+#endif /* RT_USING_TIMER_SLACK */
 
     row_head[0]  = &timer_list[0];
     for (row_lvl = 0; row_lvl < RT_TIMER_SKIP_LIST_LEVEL; row_lvl++)
@@ -478,6 +593,18 @@ static rt_err_t _timer_start(rt_list_t *timer_list, rt_timer_t timer)
     return RT_EOK;
 }
 
+/**
+ * @brief This function will start the timer
+ *
+ * @param timer the timer to be started
+ *
+ * @return the operation status, RT_EOK on OK, -RT_ERROR on error
+ */
+rt_inline rt_err_t _timer_start(rt_list_t *timer_list, rt_timer_t timer)
+{
+    return _timer_start_at(timer_list, timer, rt_tick_get());
+}
+
 /**
  * @brief This function will check timer list, if a timeout event happens,
  *        the corresponding timeout function will be invoked.
@@ -489,6 +616,7 @@ static void _timer_check(rt_list_t *timer_list, struct rt_spinlock *lock)
 {
     struct rt_timer *t;
     rt_tick_t current_tick;
+    rt_bool_t fired = RT_FALSE;
     rt_base_t level;
     rt_list_t list;
 
@@ -510,8 +638,10 @@ static void _timer_check(rt_list_t *timer_list, struct rt_spinlock *lock)
          * It supposes that the new tick shall less than the half duration of
          * tick max.
          */
-        if ((current_tick - t->timeout_tick) < RT_TICK_MAX / 2)
+        if ((current_tick - t->timeout_tick) < RT_TICK_MAX / 2 ||
+            (t = _timer_slack_take(timer_list, current_tick, fired)) != RT_NULL)
         {
+            fired = RT_TRUE;
             RT_OBJECT_HOOK_CALL(rt_timer_enter_hook, (t));
 
             /* remove timer from timer list firstly */
@@ -544,6 +674,12 @@ static void _timer_check(rt_list_t *timer_list, struct rt_spinlock *lock)
             {
                 /* start it */
                 t->parent.flag &= ~RT_TIMER_FLAG_ACTIVATED;
+#ifdef RT_USING_TIMER_SLACK
+                /* the period runs from when the timer was due, not from how late it fired */
+                if (t->slack > 0 && (rt_tick_get() - t->due_tick) < t->init_tick)
+                    _timer_start_at(timer_list, t, t->due_tick);
+                else
+#endif /* RT_USING_TIMER_SLACK */
                 _timer_start(timer_list, t);
             }
         }
@@ -730,6 +866,19 @@ rt_err_t rt_timer_control(rt_timer_t timer, int cmd, void *arg)
         timer->parameter = arg;
         break;
 
+#ifdef RT_USING_TIMER_SLACK
+    case RT_TIMER_CTRL_SET_SLACK:
+        /* applies from the next start of the timer */
+        timer->slack = *(rt_tick_t *)arg;
+        if (timer->slack > RT_TIMER_SLACK_MAX)
+            timer->slack = RT_TIMER_SLACK_MAX;
+        break;
+
+    case RT_TIMER_CTRL_GET_SLACK:
+        *(rt_tick_t *)arg = timer->slack;
+        break;
+#endif /* RT_USING_TIMER_SLACK */
+
     default:
         break;
     }
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2006-2026, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-19     proyrb       the first version for dma buffer utest
+ */
+#include <rthw.h>
+#include <rtthread.h>
+#include "utest.h"
+
+#define LINE                RT_CPU_CACHE_LINE_SZ
+#define BATCH_BUFS          (RT_DMA_SYNC_BATCH_MAX + 2)
+#define POOL_SIZE           (4 * 1024)
+
+#ifdef RT_USING_MEMHEAP
+/* stands in for a region the board maps non-cacheable */
+rt_align(LINE) static rt_uint8_t pool[POOL_SIZE];
+static rt_bool_t pool_attached;
+#endif /* RT_USING_MEMHEAP */
+
+static void test_dma_buf_alloc(void)
+{
+    static const rt_size_t sizes[] = {1, LINE - 1, LINE, LINE + 1, 1000};
+    struct rt_dma_buf buf;
+    rt_size_t i;
+
+    for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+    {
+        uassert_int_equal(rt_dma_buf_alloc(&buf, sizes[i], RT_DMA_BUF_CACHED), RT_EOK);
+        uassert_int_equal((rt_ubase_t)buf.addr % LINE, 0);
+        uassert_int_equal(buf.size % LINE, 0);
+        uassert_true(buf.size >= sizes[i] && buf.size < sizes[i] + LINE);
+        uassert_int_equal(buf.flags, RT_DMA_BUF_CACHED);
+        uassert_int_equal(buf.owner, RT_DMA_BUF_OWNER_CPU);
+        rt_memset(buf.addr, 0x5a, buf.size);
+        rt_dma_buf_free(&buf);
+    }
+
+    uassert_int_equal(rt_dma_buf_alloc(&buf, 0, RT_DMA_BUF_CACHED), -RT_EINVAL);
+}
+
+static void test_dma_buf_ownership(void)
+{
+    struct rt_dma_buf buf;
+
+    uassert_int_equal(rt_dma_buf_alloc(&buf, 4 * LINE, RT_DMA_BUF_CACHED), RT_EOK);
+
+    uassert_int_equal(rt_dma_buf_to_cpu(&buf, RT_NULL), -RT_ERROR);
+    uassert_int_equal(rt_dma_buf_to_device(&buf, RT_DMA_TO_DEVICE, buf.size, 0, RT_NULL), -RT_EINVAL);
+    uassert_int_equal(rt_dma_buf_to_device(&buf, RT_DMA_TO_DEVICE, LINE, buf.size, RT_NULL), -RT_EINVAL);
+
+    uassert_int_equal(rt_dma_buf_to_device(&buf, RT_DMA_BIDIRECTIONAL, 0, 0, RT_NULL), RT_EOK);
+    uassert_int_equal(buf.owner, RT_DMA_BUF_OWNER_DEVICE);
+    uassert_int_equal(buf.length, buf.size);
+    uassert_int_equal(rt_dma_buf_to_device(&buf, RT_DMA_TO_DEVICE, 0, 0, RT_NULL), -RT_EBUSY);
+
+    uassert_int_equal(rt_dma_buf_to_cpu(&buf, RT_NULL), RT_EOK);
+    uassert_int_equal(buf.owner, RT_DMA_BUF_OWNER_CPU);
+    uassert_int_equal(rt_dma_buf_to_cpu(&buf, RT_NULL), -RT_ERROR);
+
+    rt_dma_buf_free(&buf);
+}
+
+#ifdef RT_USING_CACHE
+static void test_dma_buf_maintenance(void)
+{
+    struct rt_dma_buf buf;
+    struct rt_dma_buf_stat before, after;
+
+    uassert_int_equal(rt_dma_buf_alloc(&buf, 8 * LINE, RT_DMA_BUF_CACHED), RT_EOK);
+
+    /* the device reads: one clean, nothing when it comes back */
+    rt_dma_buf_get_stat(&before);
+    rt_dma_buf_to_device(&buf, RT_DMA_TO_DEVICE, 0, 0, RT_NULL);
+    rt_dma_buf_to_cpu(&buf, RT_NULL);
+    rt_dma_buf_get_stat(&after);
+    uassert_int_equal(after.maint_calls - before.maint_calls, 1);
+    uassert_int_equal(after.clean_lines - before.clean_lines, 8);
+    uassert_int_equal(after.invalidate_lines - before.invalidate_lines, 0);
+    uassert_int_equal(after.transfers - before.transfers, 2);
+
+    /*
+     * The device writes lines 0 to 3, partly covering 0 and 3: those are
+     * cleaned and invalidated, 1 and 2 only invalidated. Lines 0 to 3 are
+     * invalidated again when the buffer comes back.
+     */
+    rt_dma_buf_get_stat(&before);
+    rt_dma_buf_to_device(&buf, RT_DMA_FROM_DEVICE, 4, 3 * LINE, RT_NULL);
+    rt_dma_buf_get_stat(&after);
+    uassert_int_equal(after.maint_calls - before.maint_calls, 3);
+    uassert_int_equal(after.clean_lines - before.clean_lines, 2);
+    uassert_int_equal(after.invalidate_lines - before.invalidate_lines, 4);
+
+    rt_dma_buf_get_stat(&before);
+    rt_dma_buf_to_cpu(&buf, RT_NULL);
+    rt_dma_buf_get_stat(&after);
+    uassert_int_equal(after.maint_calls - before.maint_calls, 1);
+    uassert_int_equal(after.clean_lines - before.clean_lines, 0);
+    uassert_int_equal(after.invalidate_lines - before.invalidate_lines, 4);
+
+    rt_dma_buf_free(&buf);
+}
+
+static void test_dma_buf_batch(void)
+{
+    struct rt_dma_buf bufs[BATCH_BUFS];
+    struct rt_dma_sync_batch batch;
+    struct rt_dma_buf_stat before, after;
+    int i;
+
+    for (i = 0; i < BATCH_BUFS; i++)
+        uassert_int_equal(rt_dma_buf_alloc(&bufs[i], 2 * LINE, RT_DMA_BUF_CACHED), RT_EOK);
+
+    /* more buffers than the batch holds, it commits itself when full */
+    rt_dma_sync_batch_init(&batch);
+    rt_dma_buf_get_stat(&before);
+    for (i = 0; i < BATCH_BUFS; i++)
+        rt_dma_buf_to_device(&bufs[i], RT_DMA_TO_DEVICE, 0, 0, &batch);
+    rt_dma_sync_batch_commit(&batch);
+    rt_dma_buf_get_stat(&after);
+
+    /* every line once, neighbouring buffers share a call */
+    uassert_int_equal(after.clean_lines - before.clean_lines, 2 * BATCH_BUFS);
+    uassert_int_equal(after.invalidate_lines - before.invalidate_lines, 0);
+    uassert_true(after.maint_calls - before.maint_calls <= BATCH_BUFS);
+    uassert_int_equal((after.maint_calls - before.maint_calls) +
+                      (after.merged_ranges - before.merged_ranges), BATCH_BUFS);
+    uassert_int_equal(batch.count, 0);
+
+    /* nothing to do when the device only read */
+    rt_dma_buf_get_stat(&before);
+    for (i = 0; i < BATCH_BUFS; i++)
+        rt_dma_buf_to_cpu(&bufs[i], &batch);
+    uassert_int_equal(batch.count, 0);
+    rt_dma_sync_batch_commit(&batch);
+    rt_dma_buf_get_stat(&after);
+    uassert_int_equal(after.maint_calls - before.maint_calls, 0);
+
+    for (i = 0; i < BATCH_BUFS; i++)
+        rt_dma_buf_free(&bufs[i]);
+}
+#endif /* RT_USING_CACHE */
+
+#ifdef RT_USING_MEMHEAP
+static void test_dma_buf_uncached(void)
+{
+    struct rt_dma_buf buf, big;
+    struct rt_dma_buf_stat before, after;
+
+    uassert_int_equal(rt_dma_buf_alloc(&buf, 100, RT_DMA_BUF_UNCACHED), RT_EOK);
+    uassert_int_equal(buf.flags, RT_DMA_BUF_UNCACHED);
+    uassert_int_equal((rt_ubase_t)buf.addr % LINE, 0);
+
+    /* no maintenance at all, in any direction */
+    rt_dma_buf_get_stat(&before);
+    rt_dma_buf_to_device(&buf, RT_DMA_BIDIRECTIONAL, 0, 0, RT_NULL);
+    rt_dma_buf_to_cpu(&buf, RT_NULL);
+    rt_dma_buf_to_device(&buf, RT_DMA_FROM_DEVICE, 1, 10, RT_NULL);
+    rt_dma_buf_to_cpu(&buf, RT_NULL);
+    rt_dma_buf_get_stat(&after);
+    uassert_int_equal(after.maint_calls - before.maint_calls, 0);
+    uassert_int_equal(after.transfers - before.transfers, 4);
+
+    /* an exhausted pool falls back to a cacheable buffer */
+    if (pool_attached)
+    {
+        uassert_int_equal(rt_dma_buf_alloc(&big, 2 * POOL_SIZE, RT_DMA_BUF_UNCACHED), RT_EOK);
+        uassert_int_equal(big.flags, RT_DMA_BUF_CACHED);
+        rt_dma_buf_free(&big);
+    }
+
+    rt_dma_buf_free(&buf);
+}
+#endif /* RT_USING_MEMHEAP */
+
+static rt_err_t utest_tc_init(void)
+{
+#ifdef RT_USING_MEMHEAP
+    /* the board may own the pool already */
+    pool_attached = (rt_dma_buf_pool_attach(pool, sizeof(pool)) == RT_EOK);
+#endif /* RT_USING_MEMHEAP */
+
+    return RT_EOK;
+}
+
+static rt_err_t utest_tc_cleanup(void)
+{
+#ifdef RT_USING_MEMHEAP
+    if (pool_attached)
+        rt_dma_buf_pool_detach();
+#endif /* RT_USING_MEMHEAP */
+
+    return RT_EOK;
+}
+
+static void testcase(void)
+{
+    UTEST_UNIT_RUN(test_dma_buf_alloc);
+    UTEST_UNIT_RUN(test_dma_buf_ownership);
+#ifdef RT_USING_CACHE
+    UTEST_UNIT_RUN(test_dma_buf_maintenance);
+    UTEST_UNIT_RUN(test_dma_buf_batch);
+#endif /* RT_USING_CACHE */
+#ifdef RT_USING_MEMHEAP
+    UTEST_UNIT_RUN(test_dma_buf_uncached);
+#endif /* RT_USING_MEMHEAP */
+}
+UTEST_TC_EXPORT(testcase, "core.dma_buf", utest_tc_init, utest_tc_cleanup, 10);
@@ -7,6 +7,7 @@
  * Date           Author       Notes
  * 2021-08-15     liukang     the first version
  * 2023-09-15     xqyjlj       change stack size in cpu64
+ * 2026-10-19     proyrb       add mixed AND/OR waiters test
  */
 
 #include <rtthread.h>
@@ -316,6 +317,81 @@ static void test_dynamic_event_send_recv(void)
 }
 #endif
 
+#define EVENT_FLAG1 (1 << 1)
+#define EVENT_FLAG2 (1 << 2)
+#define EVENT_FLAG4 (1 << 4)
+#define EVENT_FLAG6 (1 << 6)
+
+static struct rt_event mixed_event;
+static char mixed_stack[3][UTEST_THR_STACK_SIZE];
+static struct rt_thread mixed_thread[3];
+static volatile rt_uint32_t mixed_recv[3];
+
+static const rt_uint32_t mixed_set[3] =
+{
+    EVENT_FLAG1 | EVENT_FLAG2 | EVENT_FLAG4,    /* AND, woken last */
+    EVENT_FLAG2,                                /* OR on one bit */
+    EVENT_FLAG4 | EVENT_FLAG6,                  /* OR on several bits */
+};
+static const rt_uint8_t mixed_option[3] =
+{
+    RT_EVENT_FLAG_AND | RT_EVENT_FLAG_CLEAR,
+    RT_EVENT_FLAG_OR,
+    RT_EVENT_FLAG_OR,
+};
+
+static void mixed_recv_entry(void *param)
+{
+    int index = (int)(rt_ubase_t)param;
+    rt_uint32_t e;
+
+    if (rt_event_recv(&mixed_event, mixed_set[index], mixed_option[index],
+                      RT_WAITING_FOREVER, &e) == RT_EOK)
+    {
+        mixed_recv[index] = e;
+    }
+}
+
+static void test_event_mixed_waiters(void)
+{
+    char name[RT_NAME_MAX];
+    int i;
+
+    uassert_int_equal(rt_event_init(&mixed_event, "mixed", RT_IPC_FLAG_PRIO), RT_EOK);
+
+    for (i = 0; i < 3; i++)
+    {
+        mixed_recv[i] = 0;
+        rt_snprintf(name, sizeof(name), "mixed%d", i);
+        rt_thread_init(&mixed_thread[i], name, mixed_recv_entry, (void *)(rt_ubase_t)i,
+                       &mixed_stack[i][0], sizeof(mixed_stack[i]),
+                       THREAD_PRIORITY - 1, THREAD_TIMESLICE);
+        rt_thread_startup(&mixed_thread[i]);
+    }
+    rt_thread_mdelay(10);
+
+    /* satisfies nobody */
+    rt_event_send(&mixed_event, EVENT_FLAG1);
+    rt_thread_mdelay(10);
+    uassert_int_equal(mixed_recv[0] | mixed_recv[1] | mixed_recv[2], 0);
+
+    /* the single bit OR waiter only, the AND waiter still misses EVENT_FLAG4 */
+    rt_event_send(&mixed_event, EVENT_FLAG2);
+    rt_thread_mdelay(10);
+    uassert_int_equal(mixed_recv[0], 0);
+    uassert_int_equal(mixed_recv[1], EVENT_FLAG2);
+    uassert_int_equal(mixed_recv[2], 0);
+
+    /* both, the clear of the AND waiter applies after the whole send */
+    rt_event_send(&mixed_event, EVENT_FLAG4);
+    rt_thread_mdelay(10);
+    uassert_int_equal(mixed_recv[0], EVENT_FLAG1 | EVENT_FLAG2 | EVENT_FLAG4);
+    uassert_int_equal(mixed_recv[2], EVENT_FLAG4);
+    uassert_int_equal(mixed_event.set, 0);
+
+    uassert_int_equal(rt_event_detach(&mixed_event), RT_EOK);
+}
+
 static rt_err_t utest_tc_init(void)
 {
     static_event_recv_thread_finish = 0;
@@ -342,5 +418,6 @@ static void testcase(void)
     UTEST_UNIT_RUN(test_event_delete);
     UTEST_UNIT_RUN(test_dynamic_event_send_recv);
 #endif
+    UTEST_UNIT_RUN(test_event_mixed_waiters);
 }
 UTEST_TC_EXPORT(testcase, "core.ipc_event", utest_tc_init, utest_tc_cleanup, 60);
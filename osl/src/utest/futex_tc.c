@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2006-2026, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-19     proyrb       the first version for wait-on-address utest
+ */
+#include <rtthread.h>
+#include "utest.h"
+
+#ifdef ARCH_CPU_64BIT
+#define THREAD_STACKSIZE    8192
+#else
+#define THREAD_STACKSIZE    4096
+#endif
+
+#define WAITER_NUM          3
+#define STRESS_THREADS      4
+#define STRESS_LOOPS        1000
+
+static rt_atomic_t _word;
+static rt_atomic_t _other;
+static struct rt_semaphore _done;
+static volatile rt_uint8_t _order[WAITER_NUM];
+static volatile int _woken;
+
+static rt_uint8_t _prio_self(void)
+{
+    return RT_SCHED_PRIV(rt_thread_self()).current_priority;
+}
+
+static void _spawn(const char *name, void (*entry)(void *), void *parameter, rt_uint8_t priority)
+{
+    rt_thread_t thread;
+
+    thread = rt_thread_create(name, entry, parameter, THREAD_STACKSIZE, priority, 10);
+    uassert_not_null(thread);
+    if (thread != RT_NULL)
+        rt_thread_startup(thread);
+}
+
+static void test_futex_no_wait(void)
+{
+    rt_atomic_store(&_word, 1);
+
+    /* the word changed already, or no time to wait */
+    uassert_int_equal(rt_futex_wait(&_word, 0, RT_WAITING_FOREVER), -RT_EBUSY);
+    uassert_int_equal(rt_futex_wait(&_word, 1, RT_WAITING_NO), -RT_ETIMEOUT);
+    uassert_int_equal(rt_futex_wait(&_word, 1, 2), -RT_ETIMEOUT);
+
+    /* a timed out waiter is gone */
+    uassert_int_equal(rt_futex_wake(&_word, RT_FUTEX_WAKE_ALL), 0);
+}
+
+static void _waiter_entry(void *parameter)
+{
+    rt_atomic_t *word = (rt_atomic_t *)parameter;
+
+    while (rt_atomic_load(word) == 0)
+    {
+        if (rt_futex_wait(word, 0, RT_WAITING_FOREVER) == RT_EOK)
+            break;
+    }
+    _order[_woken++] = _prio_self();
+
+    rt_sem_release(&_done);
+}
+
+static void test_futex_wake(void)
+{
+    rt_uint8_t priority = _prio_self();
+    int i;
+
+    rt_sem_init(&_done, "fx_done", 0, RT_IPC_FLAG_PRIO);
+    rt_atomic_store(&_word, 0);
+    rt_atomic_store(&_other, 0);
+    _woken = 0;
+
+    /* started low to high, woken high to low */
+    _spawn("fx_w", _waiter_entry, (void *)&_word, priority - 1);
+    _spawn("fx_w", _waiter_entry, (void *)&_word, priority - 3);
+    _spawn("fx_w", _waiter_entry, (void *)&_word, priority - 2);
+    _spawn("fx_o", _waiter_entry, (void *)&_other, priority - 1);
+    rt_thread_mdelay(5);
+
+    /* one at a time, highest priority first */
+    for (i = 0; i < WAITER_NUM; i++)
+    {
+        uassert_int_equal(rt_futex_wake(&_word, 1), 1);
+        uassert_int_equal(rt_sem_take(&_done, RT_TICK_PER_SECOND), RT_EOK);
+    }
+    uassert_int_equal(rt_futex_wake(&_word, RT_FUTEX_WAKE_ALL), 0);
+
+    uassert_int_equal(_woken, WAITER_NUM);
+    uassert_int_equal(_order[0], priority - 3);
+    uassert_int_equal(_order[1], priority - 2);
+    uassert_int_equal(_order[2], priority - 1);
+
+    /* the waiter on the other word slept through all of it */
+    rt_atomic_store(&_other, 1);
+    uassert_int_equal(rt_futex_wake(&_other, RT_FUTEX_WAKE_ALL), 1);
+    uassert_int_equal(rt_sem_take(&_done, RT_TICK_PER_SECOND), RT_EOK);
+
+    rt_sem_detach(&_done);
+}
+
+/*
+ * A lock built on the futex: 0 free, 1 taken, 2 taken with waiters. The
+ * kernel is only entered when the lock is contended.
+ */
+static rt_atomic_t _lock;
+static volatile rt_uint32_t _counter;
+
+static void _lock_take(rt_atomic_t *lock)
+{
+    rt_atomic_t state = 0;
+
+    if (rt_atomic_compare_exchange_strong(lock, &state, 1))
+        return;
+
+    if (state != 2)
+        state = rt_atomic_exchange(lock, 2);
+    while (state != 0)
+    {
+        rt_futex_wait(lock, 2, RT_WAITING_FOREVER);
+        state = rt_atomic_exchange(lock, 2);
+    }
+}
+
+static void _lock_release(rt_atomic_t *lock)
+{
+    if (rt_atomic_exchange(lock, 0) == 2)
+        rt_futex_wake(lock, 1);
+}
+
+static void _stress_entry(void *parameter)
+{
+    for (int i = 0; i < STRESS_LOOPS; i++)
+    {
+        _lock_take(&_lock);
+        _counter++;
+        if ((i & 15) == 0)
+            rt_thread_yield();
+        _lock_release(&_lock);
+    }
+
+    rt_sem_release(&_done);
+}
+
+static void test_futex_lock(void)
+{
+    int i;
+
+    rt_sem_init(&_done, "fx_done", 0, RT_IPC_FLAG_PRIO);
+    rt_atomic_store(&_lock, 0);
+    _counter = 0;
+
+    for (i = 0; i < STRESS_THREADS; i++)
+        _spawn("fx_s", _stress_entry, RT_NULL, _prio_self() + 1);
+    for (i = 0; i < STRESS_THREADS; i++)
+        uassert_int_equal(rt_sem_take(&_done, 10 * RT_TICK_PER_SECOND), RT_EOK);
+
+    uassert_int_equal(_counter, STRESS_THREADS * STRESS_LOOPS);
+    uassert_int_equal(rt_atomic_load(&_lock), 0);
+    uassert_int_equal(rt_futex_wake(&_lock, RT_FUTEX_WAKE_ALL), 0);
+
+    rt_sem_detach(&_done);
+}
+
+static rt_err_t utest_tc_init(void)
+{
+    return RT_EOK;
+}
+
+static rt_err_t utest_tc_cleanup(void)
+{
+    return RT_EOK;
+}
+
+static void testcase(void)
+{
+    UTEST_UNIT_RUN(test_futex_no_wait);
+    UTEST_UNIT_RUN(test_futex_wake);
+    UTEST_UNIT_RUN(test_futex_lock);
+}
+UTEST_TC_EXPORT(testcase, "core.futex", utest_tc_init, utest_tc_cleanup, 30);
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2006-2026, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-19     proyrb       the first version for heapprof utest
+ */
+#include <rtthread.h>
+#include "utest.h"
+
+#define SITE_COUNT          16
+
+static struct rt_heapprof_site sites[SITE_COUNT];
+
+static const char tag_a[] = "tc_a";
+static const char tag_b[] = "tc_b";
+static const char tag_big[] = "tc_big";
+static const char tag_small[] = "tc_small";
+
+static struct rt_heapprof_site *find_tag(const char *tag, rt_size_t *pos)
+{
+    rt_size_t count, index;
+
+    count = rt_heapprof_snapshot(sites, SITE_COUNT, RT_NULL);
+    for (index = 0; index < count; index++)
+    {
+        if (sites[index].tag == tag)
+        {
+            if (pos)
+                *pos = index;
+            return &sites[index];
+        }
+    }
+    return RT_NULL;
+}
+
+static void test_heapprof_tag(void)
+{
+    struct rt_heapprof_site *site;
+    const char *old;
+    void *p1, *p2;
+
+    old = rt_heapprof_tag_set(tag_a);
+    p1 = rt_malloc(100);
+    p2 = rt_malloc(200);
+    uassert_ptr_equal(rt_heapprof_tag_set(old), tag_a);
+    uassert_not_null(p1);
+    uassert_not_null(p2);
+
+    site = find_tag(tag_a, RT_NULL);
+    uassert_not_null(site);
+    uassert_int_equal(site->live_bytes, 300);
+    uassert_int_equal(site->live_count, 2);
+    uassert_int_equal(site->alloc_count, 2);
+
+    /* release is attributed to the allocating site whatever the tag now is */
+    rt_free(p1);
+    site = find_tag(tag_a, RT_NULL);
+    uassert_int_equal(site->live_bytes, 200);
+    uassert_int_equal(site->peak_bytes, 300);
+
+    rt_free(p2);
+    site = find_tag(tag_a, RT_NULL);
+    uassert_int_equal(site->live_bytes, 0);
+    uassert_int_equal(site->alloc_bytes, 300);
+}
+
+static void test_heapprof_realloc(void)
+{
+    struct rt_heapprof_site *site;
+    const char *old;
+    void *ptr;
+
+    old = rt_heapprof_tag_set(tag_b);
+    ptr = rt_malloc(64);
+    ptr = rt_realloc(ptr, 512);
+    rt_heapprof_tag_set(old);
+    uassert_not_null(ptr);
+
+    site = find_tag(tag_b, RT_NULL);
+    uassert_not_null(site);
+    uassert_int_equal(site->live_bytes, 512);
+    uassert_int_equal(site->live_count, 1);
+    uassert_int_equal(site->alloc_count, 2);
+
+    rt_free(ptr);
+    site = find_tag(tag_b, RT_NULL);
+    uassert_int_equal(site->live_bytes, 0);
+    uassert_int_equal(site->live_count, 0);
+}
+
+static void test_heapprof_order(void)
+{
+    rt_size_t pos_big = SITE_COUNT, pos_small = SITE_COUNT;
+    const char *old;
+    void *big, *small;
+
+    old = rt_heapprof_tag_set(tag_small);
+    small = rt_malloc(16);
+    rt_heapprof_tag_set(tag_big);
+    big = rt_malloc(2048);
+    rt_heapprof_tag_set(old);
+
+    uassert_not_null(find_tag(tag_big, &pos_big));
+    uassert_not_null(find_tag(tag_small, &pos_small));
+    uassert_true(pos_big < pos_small);
+
+    /* a short buffer keeps the heaviest sites only */
+    uassert_int_equal(rt_heapprof_snapshot(sites, 1, RT_NULL), 1);
+    uassert_true(sites[0].live_bytes >= 2048);
+
+    rt_free(big);
+    rt_free(small);
+}
+
+static void test_heapprof_thread(void)
+{
+    rt_size_t count, index;
+    void *ptr;
+
+    /* untagged allocations fall back to the thread, or to the caller with an unwinder */
+    ptr = rt_malloc(32);
+    uassert_not_null(ptr);
+
+    count = rt_heapprof_snapshot(sites, SITE_COUNT, RT_NULL);
+    for (index = 0; index < count; index++)
+    {
+        if (sites[index].tag == RT_NULL && sites[index].live_bytes >= 32)
+            break;
+    }
+    uassert_true(index < count);
+    rt_free(ptr);
+}
+
+static rt_err_t utest_tc_init(void)
+{
+    return rt_heapprof_start();
+}
+
+static rt_err_t utest_tc_cleanup(void)
+{
+    rt_heapprof_stop();
+    return RT_EOK;
+}
+
+static void testcase(void)
+{
+    UTEST_UNIT_RUN(test_heapprof_tag);
+    UTEST_UNIT_RUN(test_heapprof_realloc);
+    UTEST_UNIT_RUN(test_heapprof_order);
+    UTEST_UNIT_RUN(test_heapprof_thread);
+}
+UTEST_TC_EXPORT(testcase, "core.heapprof", utest_tc_init, utest_tc_cleanup, 10);
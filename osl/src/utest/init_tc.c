@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2006-2026, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-19     proyrb       the first version for parallel init tasks utest
+ */
+#include <rthw.h>
+#include <rtthread.h>
+#include "utest.h"
+
+#if defined(RT_USING_COMPONENTS_INIT) && defined(RT_USING_INIT_PARALLEL)
+
+#define TASK_NUM            5
+#define TASK_MS             50
+
+static volatile rt_tick_t _start[TASK_NUM];
+static volatile rt_tick_t _end[TASK_NUM];
+static volatile int _ran[TASK_NUM];
+
+static int _task_run(int index)
+{
+    _start[index] = rt_tick_get();
+    rt_thread_mdelay(TASK_MS);
+    _end[index] = rt_tick_get();
+    _ran[index]++;
+
+    return index;
+}
+
+static int _task_a(void) { return _task_run(0); }
+static int _task_b(void) { return _task_run(1); }
+static int _task_c(void) { return _task_run(2); }
+static int _task_d(void) { return _task_run(3); }
+static int _task_e(void) { return _task_run(4); }
+static int _task_outside(void) { return 0; }
+
+/* a, then b and c, then d; e on its own; a function out of the table ran before */
+static const init_fn_t _deps_b[] = {_task_a};
+static const init_fn_t _deps_c[] = {_task_a, _task_outside};
+static const init_fn_t _deps_d[] = {_task_c, _task_b};
+static const init_fn_t _deps_cycle[] = {_task_b};
+
+static const struct rt_init_task _tasks[] =
+{
+    {"task_d", _task_d, _deps_d, 2},
+    {"task_a", _task_a, RT_NULL, 0},
+    {"task_b", _task_b, _deps_b, 1},
+    {"task_c", _task_c, _deps_c, 2},
+    {"task_e", _task_e, RT_NULL, 0},
+};
+
+/* b waits for itself */
+static const struct rt_init_task _cycle[] =
+{
+    {"task_a", _task_a, RT_NULL, 0},
+    {"task_b", _task_b, _deps_cycle, 1},
+};
+
+static void _reset(void)
+{
+    for (int i = 0; i < TASK_NUM; i++)
+        _ran[i] = 0;
+}
+
+static void _check_order(void)
+{
+    for (int i = 0; i < TASK_NUM; i++)
+        uassert_int_equal(_ran[i], 1);
+
+    uassert_true(_start[1] >= _end[0]);
+    uassert_true(_start[2] >= _end[0]);
+    uassert_true(_start[3] >= _end[1]);
+    uassert_true(_start[3] >= _end[2]);
+}
+
+static void test_init_tasks_sequential(void)
+{
+    rt_tick_t start;
+
+    _reset();
+    start = rt_tick_get();
+    uassert_int_equal(rt_components_tasks_run(_tasks, TASK_NUM, 0), RT_EOK);
+    uassert_true(rt_tick_get_delta(start) >= rt_tick_from_millisecond(TASK_NUM * TASK_MS));
+    _check_order();
+}
+
+static void test_init_tasks_parallel(void)
+{
+    rt_tick_t start, elapsed;
+
+    _reset();
+    start = rt_tick_get();
+    uassert_int_equal(rt_components_tasks_run(_tasks, TASK_NUM, 2), RT_EOK);
+    elapsed = rt_tick_get_delta(start);
+    _check_order();
+
+    /* a, b and d in a row is the critical path */
+    uassert_true(elapsed >= rt_tick_from_millisecond(3 * TASK_MS));
+    uassert_true(elapsed < rt_tick_from_millisecond(4 * TASK_MS));
+    rt_kprintf("init tasks: %d ms with 2 workers, %d ms in a row\n",
+               elapsed * 1000 / RT_TICK_PER_SECOND, TASK_NUM * TASK_MS);
+}
+
+static void test_init_tasks_cycle(void)
+{
+    _reset();
+    uassert_int_equal(rt_components_tasks_run(_cycle, 2, 2), -RT_ERROR);
+    uassert_int_equal(_ran[0], 1);
+    uassert_int_equal(_ran[1], 1);
+}
+
+#ifdef RT_USING_INIT_TIMELINE
+static void test_init_timeline(void)
+{
+    const struct rt_init_record *records;
+    rt_size_t before, after, i;
+    rt_uint64_t start;
+
+    before = rt_components_timeline(&records);
+    start = rt_hw_timestamp_us();
+    rt_thread_mdelay(10);
+    rt_components_timeline_record("utest_step", start, 7);
+    after = rt_components_timeline(&records);
+
+    /* a full table drops the record, raise RT_INIT_TIMELINE_MAX */
+    uassert_true(after > before);
+    if (after == before)
+        return;
+
+    for (i = before; i < after; i++)
+    {
+        if (records[i].name && rt_strcmp(records[i].name, "utest_step") == 0)
+            break;
+    }
+    uassert_true(i < after);
+    uassert_int_equal(records[i].result, 7);
+    uassert_true(records[i].cost >= 5000);
+}
+#endif /* RT_USING_INIT_TIMELINE */
+
+static rt_err_t utest_tc_init(void)
+{
+    return RT_EOK;
+}
+
+static rt_err_t utest_tc_cleanup(void)
+{
+    return RT_EOK;
+}
+
+static void testcase(void)
+{
+    UTEST_UNIT_RUN(test_init_tasks_sequential);
+    UTEST_UNIT_RUN(test_init_tasks_parallel);
+    UTEST_UNIT_RUN(test_init_tasks_cycle);
+#ifdef RT_USING_INIT_TIMELINE
+    UTEST_UNIT_RUN(test_init_timeline);
+#endif /* RT_USING_INIT_TIMELINE */
+}
+UTEST_TC_EXPORT(testcase, "core.init", utest_tc_init, utest_tc_cleanup, 10);
+
+#endif /* defined(RT_USING_COMPONENTS_INIT) && defined(RT_USING_INIT_PARALLEL) */
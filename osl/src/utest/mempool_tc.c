@@ -6,6 +6,7 @@
  * Change Logs:
  * Date           Author       Notes
  * 2025-09-03     Rbb666       the first version for mempool utest
+ * 2026-10-19     proyrb       add concurrent stress test with an interrupt side user
  */
 #include <rtthread.h>
 #include <stdlib.h>
@@ -15,6 +16,12 @@
 #define MEMPOOL_BLOCK_COUNT 32
 #define MEMPOOL_SIZE        (MEMPOOL_BLOCK_SIZE + sizeof(rt_uint8_t *)) * MEMPOOL_BLOCK_COUNT
 
+/* fewer blocks than the stress users hold at once, so some of them have to wait */
+#define STRESS_BLOCK_COUNT  6
+#define STRESS_THREADS      3
+#define STRESS_HOLD         2
+#define STRESS_ROUNDS       2000
+
 static rt_uint8_t        mempool_static[MEMPOOL_SIZE];
 static struct rt_mempool mp_static;
 static rt_mp_t           mp_dynamic;
@@ -165,6 +172,132 @@ static void test_mp_stress_alloc_free(void)
     }
 }
 
+static rt_mp_t             stress_mp;
+static struct rt_semaphore stress_done;
+static struct rt_timer     stress_timer;
+static void               *stress_isr_block;
+static volatile rt_uint32_t stress_errors;
+static volatile rt_uint32_t stress_isr_allocs;
+
+/* stamp a block with its owner, a block handed out twice loses the stamp */
+static void stress_stamp(void *block, rt_uint8_t owner)
+{
+    rt_memset(block, owner, MEMPOOL_BLOCK_SIZE);
+}
+
+static rt_bool_t stress_check(void *block, rt_uint8_t owner)
+{
+    rt_uint8_t *ptr = (rt_uint8_t *)block;
+    int i;
+
+    for (i = 0; i < MEMPOOL_BLOCK_SIZE; i++)
+    {
+        if (ptr[i] != owner)
+            return RT_FALSE;
+    }
+    return RT_TRUE;
+}
+
+/* hard timer, runs in the tick interrupt like a DMA complete handler would */
+static void stress_timer_entry(void *parameter)
+{
+    if (stress_isr_block != RT_NULL)
+    {
+        if (!stress_check(stress_isr_block, 0xff))
+            stress_errors++;
+        rt_mp_free(stress_isr_block);
+    }
+
+    stress_isr_block = rt_mp_alloc(stress_mp, 0);
+    if (stress_isr_block != RT_NULL)
+    {
+        stress_stamp(stress_isr_block, 0xff);
+        stress_isr_allocs++;
+    }
+}
+
+static void stress_thread_entry(void *parameter)
+{
+    rt_uint8_t owner = (rt_uint8_t)(rt_ubase_t)parameter;
+    void *blocks[STRESS_HOLD];
+    int round, i;
+
+    for (round = 0; round < STRESS_ROUNDS; round++)
+    {
+        for (i = 0; i < STRESS_HOLD; i++)
+        {
+            blocks[i] = rt_mp_alloc(stress_mp, RT_WAITING_FOREVER);
+            if (blocks[i] == RT_NULL)
+            {
+                stress_errors++;
+                break;
+            }
+            stress_stamp(blocks[i], owner);
+        }
+
+        rt_thread_yield();
+
+        while (i-- > 0)
+        {
+            if (!stress_check(blocks[i], owner))
+                stress_errors++;
+            rt_mp_free(blocks[i]);
+        }
+    }
+
+    rt_sem_release(&stress_done);
+}
+
+/* Concurrent test: threads that wait on an exhausted pool plus an interrupt side user */
+static void test_mp_concurrent_alloc_free(void)
+{
+    rt_thread_t tid;
+    int i;
+
+    stress_mp = rt_mp_create("mp_stress", STRESS_BLOCK_COUNT, MEMPOOL_BLOCK_SIZE);
+    uassert_not_null(stress_mp);
+    if (stress_mp == RT_NULL)
+        return;
+
+    stress_errors = 0;
+    stress_isr_allocs = 0;
+    stress_isr_block = RT_NULL;
+    rt_sem_init(&stress_done, "mp_done", 0, RT_IPC_FLAG_PRIO);
+    rt_timer_init(&stress_timer, "mp_isr", stress_timer_entry, RT_NULL, 1,
+                  RT_TIMER_FLAG_PERIODIC | RT_TIMER_FLAG_HARD_TIMER);
+    rt_timer_start(&stress_timer);
+
+    for (i = 0; i < STRESS_THREADS; i++)
+    {
+        tid = rt_thread_create("mp_stress", stress_thread_entry, (void *)(rt_ubase_t)(i + 1),
+                               UTEST_THR_STACK_SIZE, UTEST_THR_PRIORITY, 5);
+        uassert_not_null(tid);
+        if (tid != RT_NULL)
+            rt_thread_startup(tid);
+        else
+            rt_sem_release(&stress_done);
+    }
+
+    for (i = 0; i < STRESS_THREADS; i++)
+        rt_sem_take(&stress_done, RT_WAITING_FOREVER);
+
+    rt_timer_stop(&stress_timer);
+    rt_timer_detach(&stress_timer);
+    if (stress_isr_block != RT_NULL)
+    {
+        rt_mp_free(stress_isr_block);
+        stress_isr_block = RT_NULL;
+    }
+
+    uassert_int_equal(stress_errors, 0);
+    uassert_true(stress_mp->block_free_count == STRESS_BLOCK_COUNT);
+    LOG_I("stress: %d interrupt side allocations", stress_isr_allocs);
+
+    rt_sem_detach(&stress_done);
+    rt_mp_delete(stress_mp);
+    stress_mp = RT_NULL;
+}
+
 static rt_err_t utest_tc_init(void)
 {
     return RT_EOK;
@@ -193,6 +326,7 @@ static void testcase(void)
     UTEST_UNIT_RUN(test_mp_boundary_alloc_exceed);
     UTEST_UNIT_RUN(test_mp_boundary_free_invalid);
     UTEST_UNIT_RUN(test_mp_stress_alloc_free);
+    UTEST_UNIT_RUN(test_mp_concurrent_alloc_free);
 }
 
-UTEST_TC_EXPORT(testcase, "core.mempool", utest_tc_init, utest_tc_cleanup, 10);
+UTEST_TC_EXPORT(testcase, "core.mempool", utest_tc_init, utest_tc_cleanup, 30);
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2006-2026, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-19     proyrb       the first version for memtier utest
+ */
+#include <rtthread.h>
+#include "utest.h"
+
+#define TIER_FAST_SIZE      (4 * 1024)
+#define TIER_DMA_SIZE       (32 * 1024)
+#define TIER_BULK_SIZE      (64 * 1024)
+#define DRAIN_MAX           32
+
+/* plain buffers stand in for DTCM, AXI SRAM and SDRAM */
+rt_align(RT_ALIGN_SIZE) static rt_uint8_t tier_fast[TIER_FAST_SIZE];
+rt_align(RT_ALIGN_SIZE) static rt_uint8_t tier_dma[TIER_DMA_SIZE];
+rt_align(RT_ALIGN_SIZE) static rt_uint8_t tier_bulk[TIER_BULK_SIZE];
+
+/* tiers attached by this test case, the ones of the board are left alone */
+static rt_bool_t tier_attached[RT_MEMTIER_CLASS_MAX];
+
+static void test_memtier_placement(void)
+{
+    void *fast, *dma, *bulk;
+
+    fast = rt_memtier_alloc(32, RT_MEMTIER_FAST);
+    dma  = rt_memtier_alloc(1024, RT_MEMTIER_DMA);
+    bulk = rt_memtier_alloc(1024, RT_MEMTIER_BULK);
+    uassert_not_null(fast);
+    uassert_not_null(dma);
+    uassert_not_null(bulk);
+
+    uassert_int_equal(rt_memtier_class_of(fast), RT_MEMTIER_FAST);
+    uassert_int_equal(rt_memtier_class_of(dma), RT_MEMTIER_DMA);
+    uassert_int_equal(rt_memtier_class_of(bulk), RT_MEMTIER_BULK);
+    uassert_int_equal(rt_memtier_class_of(&fast), RT_MEMTIER_CLASS_MAX);
+
+    rt_memtier_free(fast);
+    rt_memtier_free(dma);
+    rt_memtier_free(bulk);
+}
+
+static void test_memtier_auto(void)
+{
+    void *small, *medium, *large;
+
+    small  = rt_memtier_alloc(16, RT_MEMTIER_AUTO);
+    medium = rt_memtier_alloc(2048, RT_MEMTIER_AUTO);
+    large  = rt_memtier_alloc(20 * 1024, RT_MEMTIER_AUTO);
+
+    uassert_int_equal(rt_memtier_class_of(small), RT_MEMTIER_FAST);
+    uassert_int_equal(rt_memtier_class_of(medium), RT_MEMTIER_DMA);
+    uassert_int_equal(rt_memtier_class_of(large), RT_MEMTIER_BULK);
+
+    /* a large fast request must not be placed in the fast tier */
+    rt_memtier_free(small);
+    small = rt_memtier_alloc(1024, RT_MEMTIER_FAST);
+    uassert_int_equal(rt_memtier_class_of(small), RT_MEMTIER_DMA);
+
+    rt_memtier_free(small);
+    rt_memtier_free(medium);
+    rt_memtier_free(large);
+}
+
+static void test_memtier_fallback(void)
+{
+    struct rt_memtier_info info;
+    void *hog, *spill;
+    void *drain[DRAIN_MAX];
+    rt_size_t spill_count;
+    int count;
+
+    rt_memtier_get_info(RT_MEMTIER_DMA, &info);
+    spill_count = info.spill_count;
+
+    /* exhaust the dma tier so the next dma request spills into bulk */
+    hog = rt_memtier_alloc(TIER_DMA_SIZE - 512, RT_MEMTIER_DMA);
+    uassert_int_equal(rt_memtier_class_of(hog), RT_MEMTIER_DMA);
+    spill = rt_memtier_alloc(2048, RT_MEMTIER_DMA);
+    uassert_int_equal(rt_memtier_class_of(spill), RT_MEMTIER_BULK);
+
+    rt_memtier_get_info(RT_MEMTIER_BULK, &info);
+    uassert_true(info.spill_count >= 1);
+    rt_memtier_free(spill);
+
+    /* the dma class never falls back into the fast tier */
+    rt_memtier_free(hog);
+    hog = rt_memtier_alloc(TIER_BULK_SIZE - 512, RT_MEMTIER_BULK);
+    uassert_int_equal(rt_memtier_class_of(hog), RT_MEMTIER_BULK);
+    spill = rt_memtier_alloc(TIER_DMA_SIZE - 512, RT_MEMTIER_DMA);
+    uassert_int_equal(rt_memtier_class_of(spill), RT_MEMTIER_DMA);
+    for (count = 0; count < DRAIN_MAX; count++)
+    {
+        drain[count] = rt_memtier_alloc(64, RT_MEMTIER_DMA);
+        if (drain[count] == RT_NULL)
+            break;
+        uassert_int_not_equal(rt_memtier_class_of(drain[count]), RT_MEMTIER_FAST);
+    }
+    uassert_true(count < DRAIN_MAX);
+
+    rt_memtier_get_info(RT_MEMTIER_DMA, &info);
+    uassert_int_equal(info.spill_count, spill_count);
+    uassert_true(info.fail_count >= 1);
+
+    while (count > 0)
+        rt_memtier_free(drain[--count]);
+    rt_memtier_free(spill);
+    rt_memtier_free(hog);
+}
+
+static void test_memtier_realloc(void)
+{
+    rt_uint8_t *ptr;
+    int i;
+
+    ptr = rt_memtier_alloc(64, RT_MEMTIER_FAST);
+    uassert_int_equal(rt_memtier_class_of(ptr), RT_MEMTIER_FAST);
+    for (i = 0; i < 64; i++)
+        ptr[i] = (rt_uint8_t)i;
+
+    /* outgrowing the fast tier moves the block and keeps its content */
+    ptr = rt_memtier_realloc(ptr, 4096);
+    uassert_not_null(ptr);
+    uassert_int_equal(rt_memtier_class_of(ptr), RT_MEMTIER_DMA);
+    for (i = 0; i < 64; i++)
+    {
+        if (ptr[i] != (rt_uint8_t)i)
+            break;
+    }
+    uassert_int_equal(i, 64);
+
+    ptr = rt_memtier_realloc(ptr, 0);
+    uassert_null(ptr);
+}
+
+static void test_memtier_info(void)
+{
+    struct rt_memtier_info before, after;
+    void *ptr;
+
+    uassert_int_equal(rt_memtier_get_info(RT_MEMTIER_BULK, &before), RT_EOK);
+    uassert_true(before.total <= TIER_BULK_SIZE);
+
+    ptr = rt_memtier_alloc(8192, RT_MEMTIER_BULK);
+    rt_memtier_get_info(RT_MEMTIER_BULK, &after);
+    uassert_true(after.used >= before.used + 8192);
+    uassert_true(after.max_used >= after.used);
+    uassert_int_equal(after.alloc_count, before.alloc_count + 1);
+    uassert_int_equal(after.live_count, before.live_count + 1);
+
+    rt_memtier_free(ptr);
+    rt_memtier_get_info(RT_MEMTIER_BULK, &after);
+    uassert_int_equal(after.used, before.used);
+    uassert_int_equal(after.live_count, before.live_count);
+}
+
+static rt_err_t utest_tc_cleanup(void);
+
+static rt_err_t utest_tc_init(void)
+{
+    tier_attached[RT_MEMTIER_FAST] = rt_memtier_attach(RT_MEMTIER_FAST, "t_fast", tier_fast, sizeof(tier_fast)) == RT_EOK;
+    tier_attached[RT_MEMTIER_DMA]  = rt_memtier_attach(RT_MEMTIER_DMA, "t_dma", tier_dma, sizeof(tier_dma)) == RT_EOK;
+    tier_attached[RT_MEMTIER_BULK] = rt_memtier_attach(RT_MEMTIER_BULK, "t_bulk", tier_bulk, sizeof(tier_bulk)) == RT_EOK;
+
+    /* the board may already own some tiers, the test needs all of them */
+    if (!tier_attached[RT_MEMTIER_FAST] || !tier_attached[RT_MEMTIER_DMA] || !tier_attached[RT_MEMTIER_BULK])
+    {
+        utest_tc_cleanup();
+        return -RT_EBUSY;
+    }
+
+    return RT_EOK;
+}
+
+static rt_err_t utest_tc_cleanup(void)
+{
+    int index;
+
+    for (index = 0; index < RT_MEMTIER_CLASS_MAX; index++)
+    {
+        if (tier_attached[index])
+            rt_memtier_detach(index);
+        tier_attached[index] = RT_FALSE;
+    }
+
+    return RT_EOK;
+}
+
+static void testcase(void)
+{
+    UTEST_UNIT_RUN(test_memtier_placement);
+    UTEST_UNIT_RUN(test_memtier_auto);
+    UTEST_UNIT_RUN(test_memtier_fallback);
+    UTEST_UNIT_RUN(test_memtier_realloc);
+    UTEST_UNIT_RUN(test_memtier_info);
+}
+UTEST_TC_EXPORT(testcase, "core.memtier", utest_tc_init, utest_tc_cleanup, 10);
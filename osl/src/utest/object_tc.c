@@ -293,6 +293,94 @@ static void test_object_type_handling(void)
     rt_object_detach(&obj);
 }
 
+#ifdef RT_USING_OBJECT_CACHE
+/* a custom object is larger than its header, the byte behind it is ours */
+#define CACHE_MARK(obj) (((rt_uint8_t *)(obj))[sizeof(struct rt_object)])
+
+static int cache_ctor_count = 0;
+static int cache_dtor_count = 0;
+
+static void cache_ctor(rt_object_t object)
+{
+    cache_ctor_count++;
+    CACHE_MARK(object) = 0x5a;
+}
+
+static void cache_dtor(rt_object_t object)
+{
+    cache_dtor_count++;
+}
+
+static void test_object_cache(void)
+{
+    struct rt_object_cache_info before, info;
+    rt_object_t objs[3];
+    char name[TEST_RT_NAME_MAX];
+
+    /* Test 1: Deleted objects are reused without going back to the heap */
+    uassert_int_equal(rt_object_cache_get_info(RT_Object_Class_Thread, &before), RT_EOK);
+    uassert_true(generate_unique_name(name, TEST_RT_NAME_MAX, "oc") == RT_EOK);
+    for (int i = 0; i < 10; i++)
+    {
+        objs[0] = rt_object_allocate(RT_Object_Class_Thread, name);
+        uassert_not_null(objs[0]);
+        uassert_int_equal(rt_object_get_type(objs[0]), RT_Object_Class_Thread);
+        rt_object_delete(objs[0]);
+    }
+    uassert_int_equal(rt_object_cache_get_info(RT_Object_Class_Thread, &info), RT_EOK);
+    uassert_true(info.alloc_count >= before.alloc_count + 10);
+    if (info.per_slab > 0)
+        uassert_true(info.slabs > 0);
+
+    /* Test 2: Unknown class */
+    uassert_int_equal(rt_object_cache_get_info(RT_Object_Class_Unknown, &info), -RT_EINVAL);
+
+    /* Test 3: Constructor, destructor and reserve, on a class nobody else uses */
+    uassert_int_equal(rt_object_cache_get_info(RT_Object_Class_Custom, &before), RT_EOK);
+    if (before.in_use > 0)
+    {
+        rt_kprintf("object cache: %d custom objects in use, constructor, destructor and reserve not tested\n",
+                   (int)before.in_use);
+        return;
+    }
+
+    rt_object_cache_shrink(RT_Object_Class_Custom);
+    cache_ctor_count = cache_dtor_count = 0;
+    uassert_int_equal(rt_object_cache_config(RT_Object_Class_Custom, 2, 2, cache_ctor, cache_dtor), RT_EOK);
+    uassert_int_equal(cache_ctor_count, 2);
+
+    for (int i = 0; i < 3; i++)
+    {
+        objs[i] = rt_object_allocate(RT_Object_Class_Custom, RT_NULL);
+        uassert_not_null(objs[i]);
+        /* built once by the constructor, not cleared again */
+        uassert_int_equal(CACHE_MARK(objs[i]), 0x5a);
+    }
+    uassert_int_equal(cache_ctor_count, 4);
+    uassert_int_equal(rt_object_cache_config(RT_Object_Class_Custom, 2, 2, RT_NULL, RT_NULL), -RT_EBUSY);
+
+    rt_object_cache_get_info(RT_Object_Class_Custom, &info);
+    uassert_int_equal(info.in_use, 3);
+    uassert_int_equal(info.slabs, 2);
+    uassert_int_equal(info.free, 1);
+
+    /* the first slab goes back, the second one holds the reserve */
+    for (int i = 2; i >= 0; i--)
+        rt_object_delete(objs[i]);
+    rt_object_cache_get_info(RT_Object_Class_Custom, &info);
+    uassert_int_equal(info.in_use, 0);
+    uassert_int_equal(info.slabs, 1);
+    uassert_int_equal(info.free, 2);
+    uassert_int_equal(cache_dtor_count, 2);
+
+    uassert_int_equal(rt_object_cache_shrink(RT_Object_Class_Custom), 1);
+    uassert_int_equal(cache_dtor_count, 4);
+
+    uassert_int_equal(rt_object_cache_config(RT_Object_Class_Custom, before.per_slab, before.reserve,
+                                             RT_NULL, RT_NULL), RT_EOK);
+}
+#endif /* RT_USING_OBJECT_CACHE */
+
 static rt_err_t testcase_init(void)
 {
     if (!rt_scheduler_is_available())
@@ -318,5 +406,8 @@ static void test_object_suite(void)
     UTEST_UNIT_RUN(test_object_find_operations);
     UTEST_UNIT_RUN(test_object_info_enumeration);
     UTEST_UNIT_RUN(test_object_type_handling);
+#ifdef RT_USING_OBJECT_CACHE
+    UTEST_UNIT_RUN(test_object_cache);
+#endif /* RT_USING_OBJECT_CACHE */
 }
 UTEST_TC_EXPORT(test_object_suite, "core.object", testcase_init, testcase_cleanup, 20);
\ No newline at end of file
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2006-2026, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-19     proyrb       test case for event send with many waiters
+ */
+
+#include <rtthread.h>
+#include <rthw.h>
+#include <rtdevice.h>
+#include <utest.h>
+#include <utest_assert.h>
+#include <perf_tc.h>
+
+/* the hwtimer counts microseconds, so each sample is a batch of sends */
+#define EVENT_SEND_BATCH        100
+#define EVENT_WAITER_MAX        64
+#define EVENT_WAITER_STACK_SIZE 1024
+/* nobody waits on this bit, a send only pays for finding that out */
+#define EVENT_SEND_FLAG         (1 << 0)
+
+static const rt_uint32_t waiter_counts[] = {1, 4, 16, EVENT_WAITER_MAX};
+
+static void event_waiter_entry(void *parameter)
+{
+    rt_event_t event = (rt_event_t)parameter;
+    rt_uint32_t bit = (rt_uint32_t)rt_thread_self()->user_data;
+
+    /* returns with an error once the event is deleted */
+    rt_event_recv(event, 1ul << bit, RT_EVENT_FLAG_OR, RT_WAITING_FOREVER, RT_NULL);
+}
+
+static rt_err_t event_send_run(rt_perf_t *perf, rt_uint32_t waiters)
+{
+    rt_event_t event;
+    rt_thread_t thread;
+    rt_uint32_t i, n;
+
+    event = rt_event_create("perf_ev", RT_IPC_FLAG_PRIO);
+    if (event == RT_NULL)
+    {
+        LOG_E("create event failed.");
+        return -RT_ENOMEM;
+    }
+
+    /* one waiter per channel on bits 1..31, wrapping around beyond 31 */
+    for (i = 0; i < waiters; i++)
+    {
+        thread = rt_thread_create("perf_ew", event_waiter_entry, event,
+                                  EVENT_WAITER_STACK_SIZE, THREAD_PRIORITY, THREAD_TIMESLICE);
+        if (thread == RT_NULL)
+        {
+            LOG_E("create waiter %d failed.", i);
+            rt_event_delete(event);
+            return -RT_ENOMEM;
+        }
+        thread->user_data = 1 + i % 31;
+        rt_thread_startup(thread);
+    }
+    /* let all of them block on the event */
+    rt_thread_mdelay(20);
+
+    perf->count = 0;
+    perf->tot_time = 0;
+    perf->max_time = 0;
+    perf->min_time = RT_UINT32_MAX;
+    rt_snprintf(perf->name, sizeof(perf->name), "event_send_w%u", waiters);
+
+    for (n = 0; n < RT_UTEST_SYS_PERF_TC_COUNT; n++)
+    {
+        rt_perf_start(perf);
+        for (i = 0; i < EVENT_SEND_BATCH; i++)
+            rt_event_send(event, EVENT_SEND_FLAG);
+        rt_perf_stop(perf);
+    }
+    rt_perf_dump(perf);
+
+    rt_event_delete(event);
+    /* let the waiters exit before their stacks are reclaimed */
+    rt_thread_mdelay(20);
+
+    return RT_EOK;
+}
+
+rt_err_t rt_perf_event_waiters(rt_perf_t *perf)
+{
+    rt_err_t ret = RT_EOK;
+    rt_size_t i;
+
+    for (i = 0; i < sizeof(waiter_counts) / sizeof(waiter_counts[0]) && ret == RT_EOK; i++)
+        ret = event_send_run(perf, waiter_counts[i]);
+
+    return ret;
+}
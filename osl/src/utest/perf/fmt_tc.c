@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2006-2026, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-19     proyrb       test case for numeric formatting
+ */
+
+#include <rtthread.h>
+#include <rthw.h>
+#include <rtdevice.h>
+#include <utest.h>
+#include <utest_assert.h>
+#include <perf_tc.h>
+
+/* the hwtimer counts microseconds, so each sample is a batch of conversions */
+#define FMT_BATCH       100
+
+enum
+{
+    FMT_SNPRINTF_INT,
+    FMT_DIRECT_INT,
+    FMT_SNPRINTF_FIXED,
+    FMT_DIRECT_FIXED,
+    FMT_KIND_NR
+};
+
+static const char *const fmt_names[FMT_KIND_NR] =
+{
+    "fmt_snprintf_d_x100",
+    "fmt_i32_x100",
+    "fmt_snprintf_2f_x100",
+    "fmt_fixed_2_x100",
+};
+
+static volatile int fmt_sink;
+
+static void fmt_run(rt_perf_t *perf, int kind)
+{
+    char buf[RT_FMT_FIXED_SIZE];
+    rt_uint32_t i, n;
+
+    perf->count = 0;
+    perf->tot_time = 0;
+    perf->max_time = 0;
+    perf->min_time = RT_UINT32_MAX;
+    rt_strcpy(perf->name, fmt_names[kind]);
+
+    for (n = 0; n < RT_UTEST_SYS_PERF_TC_COUNT; n++)
+    {
+        rt_perf_start(perf);
+        for (i = 0; i < FMT_BATCH; i++)
+        {
+            /* values like the sensor readings of the UI */
+            rt_int32_t value = (rt_int32_t)(n * FMT_BATCH + i) * 7919 - 1000000;
+
+            switch (kind)
+            {
+            case FMT_SNPRINTF_INT:
+                fmt_sink += rt_snprintf(buf, sizeof(buf), "%d", value);
+                break;
+            case FMT_DIRECT_INT:
+                fmt_sink += rt_fmt_i32(buf, value);
+                break;
+            case FMT_SNPRINTF_FIXED:
+                fmt_sink += rt_snprintf(buf, sizeof(buf), "%.2f", value / 1024.0);
+                break;
+            default:
+                fmt_sink += rt_fmt_fixed(buf, value / 1024.0, 2);
+                break;
+            }
+        }
+        rt_perf_stop(perf);
+    }
+    rt_perf_dump(perf);
+}
+
+rt_err_t rt_perf_fmt(rt_perf_t *perf)
+{
+    int kind;
+
+    for (kind = 0; kind < FMT_KIND_NR; kind++)
+        fmt_run(perf, kind);
+
+    return RT_EOK;
+}
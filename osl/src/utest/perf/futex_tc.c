@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2006-2026, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-19     proyrb       test case for futex based locking and wake-up
+ */
+
+#include <rtthread.h>
+#include <rthw.h>
+#include <rtdevice.h>
+#include <utest.h>
+#include <utest_assert.h>
+#include <perf_tc.h>
+
+#ifdef RT_USING_FUTEX
+
+#define FUTEX_LOCK_LOOPS    100
+
+static rt_atomic_t perf_lock;
+static rt_atomic_t perf_word;
+static struct rt_mutex perf_mutex;
+static struct rt_semaphore perf_ready;
+
+/* 0 free, 1 taken, 2 taken with waiters */
+static void perf_futex_lock(rt_atomic_t *lock)
+{
+    rt_atomic_t state = 0;
+
+    if (rt_atomic_compare_exchange_strong(lock, &state, 1))
+        return;
+
+    if (state != 2)
+        state = rt_atomic_exchange(lock, 2);
+    while (state != 0)
+    {
+        rt_futex_wait(lock, 2, RT_WAITING_FOREVER);
+        state = rt_atomic_exchange(lock, 2);
+    }
+}
+
+static void perf_futex_unlock(rt_atomic_t *lock)
+{
+    if (rt_atomic_exchange(lock, 0) == 2)
+        rt_futex_wake(lock, 1);
+}
+
+static void perf_futex_reset(rt_perf_t *perf, const char *name)
+{
+    rt_snprintf(perf->name, sizeof(perf->name), "%s", name);
+    perf->tot_time = 0;
+    perf->max_time = 0;
+    perf->min_time = RT_UINT32_MAX;
+    perf->count = 0;
+}
+
+/* uncontended take and release, the futex lock never enters the kernel */
+static void perf_futex_uncontended(rt_perf_t *perf)
+{
+    rt_uint32_t n;
+    int i;
+
+    perf_futex_reset(perf, "futex_lock_x100");
+    for (n = 0; n < RT_UTEST_SYS_PERF_TC_COUNT; n++)
+    {
+        rt_perf_start(perf);
+        for (i = 0; i < FUTEX_LOCK_LOOPS; i++)
+        {
+            perf_futex_lock(&perf_lock);
+            perf_futex_unlock(&perf_lock);
+        }
+        rt_perf_stop(perf);
+    }
+    rt_perf_dump(perf);
+
+    perf_futex_reset(perf, "mutex_lock_x100");
+    for (n = 0; n < RT_UTEST_SYS_PERF_TC_COUNT; n++)
+    {
+        rt_perf_start(perf);
+        for (i = 0; i < FUTEX_LOCK_LOOPS; i++)
+        {
+            rt_mutex_take(&perf_mutex, RT_WAITING_FOREVER);
+            rt_mutex_release(&perf_mutex);
+        }
+        rt_perf_stop(perf);
+    }
+    rt_perf_dump(perf);
+}
+
+static void perf_futex_waiter(void *parameter)
+{
+    rt_perf_t *perf = (rt_perf_t *)parameter;
+
+    while (perf->count < RT_UTEST_SYS_PERF_TC_COUNT)
+    {
+        while (rt_atomic_load(&perf_word) == 0)
+            rt_futex_wait(&perf_word, 0, RT_WAITING_FOREVER);
+        rt_perf_stop(perf);
+
+        rt_atomic_store(&perf_word, 0);
+        rt_sem_release(&perf_ready);
+    }
+}
+
+/* from rt_futex_wake() until the waiter runs */
+static rt_err_t perf_futex_wakeup(rt_perf_t *perf)
+{
+    rt_thread_t thread;
+    rt_uint32_t n;
+
+    perf_futex_reset(perf, "futex_wake");
+    rt_atomic_store(&perf_word, 0);
+
+    thread = rt_thread_create("perf_fx", perf_futex_waiter, perf,
+                              THREAD_STACK_SIZE, THREAD_PRIORITY, THREAD_TIMESLICE);
+    if (thread == RT_NULL)
+    {
+        LOG_E("perf_fx create failed.");
+        return -RT_ERROR;
+    }
+    rt_thread_startup(thread);
+
+    for (n = 0; n < RT_UTEST_SYS_PERF_TC_COUNT; n++)
+    {
+        rt_perf_start(perf);
+        rt_atomic_store(&perf_word, 1);
+        rt_futex_wake(&perf_word, 1);
+        rt_sem_take(&perf_ready, RT_WAITING_FOREVER);
+    }
+    rt_perf_dump(perf);
+
+    return RT_EOK;
+}
+
+rt_err_t rt_perf_futex(rt_perf_t *perf)
+{
+    rt_err_t ret;
+
+    rt_atomic_store(&perf_lock, 0);
+    rt_mutex_init(&perf_mutex, "perf_mtx", RT_IPC_FLAG_PRIO);
+    rt_sem_init(&perf_ready, "perf_rdy", 0, RT_IPC_FLAG_PRIO);
+
+    perf_futex_uncontended(perf);
+    ret = perf_futex_wakeup(perf);
+
+    rt_sem_detach(&perf_ready);
+    rt_mutex_detach(&perf_mutex);
+
+    return ret;
+}
+
+#endif /* RT_USING_FUTEX */
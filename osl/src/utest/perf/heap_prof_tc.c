@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2006-2026, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-19     proyrb       test case for heap profiler overhead
+ */
+
+#include <rtthread.h>
+#include <rthw.h>
+#include <rtdevice.h>
+#include <utest.h>
+#include <utest_assert.h>
+#include <perf_tc.h>
+
+/* the hwtimer counts microseconds, so each sample is a batch of pairs */
+#define HEAP_PROF_BATCH     100
+#define HEAP_PROF_SIZE      64
+
+static void *heap_prof_ptrs[HEAP_PROF_BATCH];
+
+static void perf_heap_batch(rt_perf_t *perf)
+{
+    rt_uint32_t i;
+
+    for (rt_uint32_t n = 0; n < RT_UTEST_SYS_PERF_TC_COUNT; n++)
+    {
+        rt_perf_start(perf);
+        for (i = 0; i < HEAP_PROF_BATCH; i++)
+            heap_prof_ptrs[i] = rt_malloc(HEAP_PROF_SIZE);
+        for (i = 0; i < HEAP_PROF_BATCH; i++)
+            rt_free(heap_prof_ptrs[i]);
+        rt_perf_stop(perf);
+    }
+}
+
+static void perf_heap_clear(rt_perf_t *perf)
+{
+    perf->tot_time = 0;
+    perf->max_time = 0;
+    perf->min_time = RT_UINT32_MAX;
+    perf->count = 0;
+}
+
+rt_err_t rt_perf_heap_prof(rt_perf_t *perf)
+{
+    /* baseline, plain malloc and free of a batch */
+    rt_strcpy(perf->name, "heap_pair_x100");
+    perf_heap_batch(perf);
+    rt_perf_dump(perf);
+
+#ifdef RT_USING_HEAPPROF
+    /* the same batch with every block attributed to a call site */
+    perf_heap_clear(perf);
+    if (rt_heapprof_start() != RT_EOK)
+    {
+        LOG_E("heap profiler is busy.");
+        return -RT_EBUSY;
+    }
+    rt_strcpy(perf->name, "heapprof_pair_x100");
+    perf_heap_batch(perf);
+    rt_heapprof_stop();
+    rt_perf_dump(perf);
+#else
+    RT_UNUSED(perf_heap_clear);
+#endif /* RT_USING_HEAPPROF */
+
+    return RT_EOK;
+}
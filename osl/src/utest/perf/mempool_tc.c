@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2006-2026, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-19     proyrb       test case for mempool alloc/free latency
+ */
+
+#include <rtthread.h>
+#include <rthw.h>
+#include <rtdevice.h>
+#include <utest.h>
+#include <utest_assert.h>
+#include <perf_tc.h>
+
+/* the hwtimer counts microseconds, so each sample is a batch of pairs */
+#define MEMPOOL_BATCH       100
+#define MEMPOOL_BLOCK_SIZE  64
+
+static void *mempool_ptrs[MEMPOOL_BATCH];
+
+rt_err_t rt_perf_mempool(rt_perf_t *perf)
+{
+    rt_mp_t mp;
+    rt_uint32_t i;
+
+    mp = rt_mp_create("perf_mp", MEMPOOL_BATCH, MEMPOOL_BLOCK_SIZE);
+    if (mp == RT_NULL)
+    {
+        LOG_E("create mempool failed.");
+        return -RT_ENOMEM;
+    }
+
+    /* run once with and once without the option to compare both paths */
+#ifdef RT_MEMPOOL_USING_LOCKFREE
+    rt_strcpy(perf->name, "mp_lockfree_pair_x100");
+#else
+    rt_strcpy(perf->name, "mp_locked_pair_x100");
+#endif /* RT_MEMPOOL_USING_LOCKFREE */
+
+    for (rt_uint32_t n = 0; n < RT_UTEST_SYS_PERF_TC_COUNT; n++)
+    {
+        rt_perf_start(perf);
+        for (i = 0; i < MEMPOOL_BATCH; i++)
+            mempool_ptrs[i] = rt_mp_alloc(mp, 0);
+        for (i = 0; i < MEMPOOL_BATCH; i++)
+            rt_mp_free(mempool_ptrs[i]);
+        rt_perf_stop(perf);
+    }
+    rt_perf_dump(perf);
+
+    rt_mp_delete(mp);
+
+    return RT_EOK;
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2006-2026, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-19     proyrb       test case for dynamic object create/delete throughput
+ */
+
+#include <rtthread.h>
+#include <rthw.h>
+#include <rtdevice.h>
+#include <utest.h>
+#include <utest_assert.h>
+#include <perf_tc.h>
+
+/* the hwtimer counts microseconds, so each sample is a batch of pairs */
+#define OBJECT_BATCH        16
+
+/* run once with and once without the option to compare both paths */
+#ifdef RT_USING_OBJECT_CACHE
+#define OBJECT_PATH         "cache"
+#else
+#define OBJECT_PATH         "heap"
+#endif /* RT_USING_OBJECT_CACHE */
+
+enum object_kind
+{
+    OBJECT_KIND_SEM,
+    OBJECT_KIND_MUTEX,
+    OBJECT_KIND_TIMER,
+    OBJECT_KIND_NR,
+};
+
+static const char *const object_kind_name[] = {"sem", "mutex", "timer"};
+static void *object_ptrs[OBJECT_BATCH];
+
+static void object_timeout(void *parameter)
+{
+}
+
+static rt_bool_t object_create(enum object_kind kind, int index)
+{
+    switch (kind)
+    {
+    case OBJECT_KIND_SEM:
+        object_ptrs[index] = rt_sem_create("perf_sem", 0, RT_IPC_FLAG_PRIO);
+        break;
+    case OBJECT_KIND_MUTEX:
+        object_ptrs[index] = rt_mutex_create("perf_mtx", RT_IPC_FLAG_PRIO);
+        break;
+    case OBJECT_KIND_TIMER:
+        object_ptrs[index] = rt_timer_create("perf_tmr", object_timeout, RT_NULL, 10, RT_TIMER_FLAG_ONE_SHOT);
+        break;
+    default:
+        object_ptrs[index] = RT_NULL;
+        break;
+    }
+
+    return object_ptrs[index] != RT_NULL;
+}
+
+static void object_delete(enum object_kind kind, int index)
+{
+    switch (kind)
+    {
+    case OBJECT_KIND_SEM:
+        rt_sem_delete((rt_sem_t)object_ptrs[index]);
+        break;
+    case OBJECT_KIND_MUTEX:
+        rt_mutex_delete((rt_mutex_t)object_ptrs[index]);
+        break;
+    case OBJECT_KIND_TIMER:
+        rt_timer_delete((rt_timer_t)object_ptrs[index]);
+        break;
+    default:
+        break;
+    }
+}
+
+rt_err_t rt_perf_object_cache(rt_perf_t *perf)
+{
+    enum object_kind kind;
+    int i, created;
+
+    for (kind = 0; kind < OBJECT_KIND_NR; kind++)
+    {
+        rt_snprintf(perf->name, sizeof(perf->name), "%s_%s_pair_x%d",
+                    object_kind_name[kind], OBJECT_PATH, OBJECT_BATCH);
+        perf->tot_time = 0;
+        perf->max_time = 0;
+        perf->min_time = RT_UINT32_MAX;
+        perf->count = 0;
+
+        for (rt_uint32_t n = 0; n < RT_UTEST_SYS_PERF_TC_COUNT; n++)
+        {
+            rt_perf_start(perf);
+            for (created = 0; created < OBJECT_BATCH; created++)
+            {
+                if (!object_create(kind, created))
+                    break;
+            }
+            for (i = 0; i < created; i++)
+                object_delete(kind, i);
+            rt_perf_stop(perf);
+
+            if (created < OBJECT_BATCH)
+            {
+                LOG_E("create %s failed.", object_kind_name[kind]);
+                return -RT_ENOMEM;
+            }
+        }
+        rt_perf_dump(perf);
+    }
+
+    return RT_EOK;
+}
@@ -30,8 +30,23 @@ testcase_function test_func_ptrs[] =
     context_switch_test,
     rt_perf_thread_sem,
     rt_perf_thread_event,
+    rt_perf_event_waiters,
+    rt_perf_susp_list,
     rt_perf_thread_mq,
     rt_perf_thread_mbox,
+    rt_perf_heap_prof,
+    rt_perf_mempool,
+    rt_perf_object_cache,
+    rt_perf_fmt,
+#ifdef RT_USING_WORKPOOL
+    rt_perf_workpool,
+#endif /* RT_USING_WORKPOOL */
+#if defined(RT_USING_RWLOCK) || defined(RT_USING_SEQLOCK)
+    rt_perf_rwlock,
+#endif /* defined(RT_USING_RWLOCK) || defined(RT_USING_SEQLOCK) */
+#ifdef RT_USING_FUTEX
+    rt_perf_futex,
+#endif /* RT_USING_FUTEX */
     rt_perf_irq_latency,    /* Timer Interrupt Source */
     RT_NULL
 };
@@ -48,8 +48,23 @@ rt_err_t context_switch_test(rt_perf_t *perf);
 rt_err_t rt_perf_irq_latency(rt_perf_t *perf);
 rt_err_t rt_perf_thread_sem(rt_perf_t *perf);
 rt_err_t rt_perf_thread_event(rt_perf_t *perf);
+rt_err_t rt_perf_event_waiters(rt_perf_t *perf);
+rt_err_t rt_perf_susp_list(rt_perf_t *perf);
 rt_err_t rt_perf_thread_mq(rt_perf_t *perf);
 rt_err_t rt_perf_thread_mbox(rt_perf_t *perf);
+rt_err_t rt_perf_heap_prof(rt_perf_t *perf);
+rt_err_t rt_perf_mempool(rt_perf_t *perf);
+rt_err_t rt_perf_object_cache(rt_perf_t *perf);
+rt_err_t rt_perf_fmt(rt_perf_t *perf);
+#ifdef RT_USING_WORKPOOL
+rt_err_t rt_perf_workpool(rt_perf_t *perf);
+#endif /* RT_USING_WORKPOOL */
+#if defined(RT_USING_RWLOCK) || defined(RT_USING_SEQLOCK)
+rt_err_t rt_perf_rwlock(rt_perf_t *perf);
+#endif /* defined(RT_USING_RWLOCK) || defined(RT_USING_SEQLOCK) */
+#ifdef RT_USING_FUTEX
+rt_err_t rt_perf_futex(rt_perf_t *perf);
+#endif /* RT_USING_FUTEX */
 
 #endif /* PERF_TC_H__ */
 
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2006-2026, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-19     proyrb       test case for reader scaling of rwlock and seqlock
+ */
+
+#include <rtthread.h>
+#include <rthw.h>
+#include <rtdevice.h>
+#include <utest.h>
+#include <utest_assert.h>
+#include <perf_tc.h>
+
+#if defined(RT_USING_RWLOCK) || defined(RT_USING_SEQLOCK)
+
+/* readers are measured with 1 up to this many threads */
+#ifndef RT_UTEST_RWLOCK_READERS
+#define RT_UTEST_RWLOCK_READERS     RT_CPUS_NR
+#endif
+
+#define RW_READ_LOOPS       256
+
+enum rw_kind
+{
+    RW_KIND_MUTEX,
+#ifdef RT_USING_RWLOCK
+    RW_KIND_RWLOCK,
+#endif /* RT_USING_RWLOCK */
+#ifdef RT_USING_SEQLOCK
+    RW_KIND_SEQLOCK,
+#endif /* RT_USING_SEQLOCK */
+    RW_KIND_NR,
+};
+
+static const char *const rw_kind_name[] =
+{
+    "mutex",
+#ifdef RT_USING_RWLOCK
+    "rwlock",
+#endif /* RT_USING_RWLOCK */
+#ifdef RT_USING_SEQLOCK
+    "seqlock",
+#endif /* RT_USING_SEQLOCK */
+};
+
+static struct rt_mutex rw_mutex;
+#ifdef RT_USING_RWLOCK
+static struct rt_rwlock rw_rwlock;
+#endif /* RT_USING_RWLOCK */
+#ifdef RT_USING_SEQLOCK
+static struct rt_seqlock rw_seqlock;
+#endif /* RT_USING_SEQLOCK */
+
+static rt_uint32_t rw_shared[8];
+static struct rt_semaphore rw_go[RT_UTEST_RWLOCK_READERS];
+static struct rt_semaphore rw_done;
+static volatile enum rw_kind rw_kind;
+static volatile rt_bool_t rw_quit;
+
+/* a small critical section: copy the shared snapshot */
+static void rw_read_once(void)
+{
+    rt_uint32_t copy[8];
+
+    switch (rw_kind)
+    {
+    case RW_KIND_MUTEX:
+        rt_mutex_take(&rw_mutex, RT_WAITING_FOREVER);
+        rt_memcpy(copy, rw_shared, sizeof(copy));
+        rt_mutex_release(&rw_mutex);
+        break;
+#ifdef RT_USING_RWLOCK
+    case RW_KIND_RWLOCK:
+        rt_rwlock_take_read(&rw_rwlock, RT_WAITING_FOREVER);
+        rt_memcpy(copy, rw_shared, sizeof(copy));
+        rt_rwlock_release(&rw_rwlock);
+        break;
+#endif /* RT_USING_RWLOCK */
+#ifdef RT_USING_SEQLOCK
+    case RW_KIND_SEQLOCK:
+        rt_seqlock_read(&rw_seqlock, copy, rw_shared, sizeof(copy), RT_WAITING_FOREVER);
+        break;
+#endif /* RT_USING_SEQLOCK */
+    default:
+        break;
+    }
+}
+
+static void rw_reader_entry(void *parameter)
+{
+    rt_sem_t go = (rt_sem_t)parameter;
+
+    for (;;)
+    {
+        rt_sem_take(go, RT_WAITING_FOREVER);
+        if (rw_quit)
+            break;
+
+        for (int i = 0; i < RW_READ_LOOPS; i++)
+            rw_read_once();
+
+        rt_sem_release(&rw_done);
+    }
+
+    rt_sem_release(&rw_done);
+}
+
+static void perf_rwlock_stop(rt_uint8_t readers)
+{
+    rt_uint8_t i;
+
+    rw_quit = RT_TRUE;
+    for (i = 0; i < readers; i++)
+        rt_sem_release(&rw_go[i]);
+    for (i = 0; i < readers; i++)
+        rt_sem_take(&rw_done, RT_WAITING_FOREVER);
+}
+
+static rt_err_t perf_rwlock_run(rt_perf_t *perf, rt_uint8_t readers)
+{
+    rt_thread_t thread;
+    rt_uint8_t i;
+
+    rw_quit = RT_FALSE;
+    for (i = 0; i < readers; i++)
+    {
+        thread = rt_thread_create("perf_rd", rw_reader_entry, &rw_go[i],
+                                  THREAD_STACK_SIZE, THREAD_PRIORITY, THREAD_TIMESLICE);
+        if (thread == RT_NULL)
+        {
+            LOG_E("perf_rd create failed.");
+            perf_rwlock_stop(i);
+            return -RT_ERROR;
+        }
+        rt_thread_startup(thread);
+    }
+
+    for (rw_kind = 0; rw_kind < RW_KIND_NR; rw_kind++)
+    {
+        rt_snprintf(perf->name, sizeof(perf->name), "%s_read_r%d", rw_kind_name[rw_kind], readers);
+        perf->tot_time = 0;
+        perf->max_time = 0;
+        perf->min_time = RT_UINT32_MAX;
+        perf->count = 0;
+
+        for (rt_uint32_t n = 0; n < RT_UTEST_SYS_PERF_TC_COUNT; n++)
+        {
+            rt_perf_start(perf);
+            for (i = 0; i < readers; i++)
+                rt_sem_release(&rw_go[i]);
+            for (i = 0; i < readers; i++)
+                rt_sem_take(&rw_done, RT_WAITING_FOREVER);
+            rt_perf_stop(perf);
+        }
+
+        rt_perf_dump(perf);
+    }
+
+    perf_rwlock_stop(readers);
+
+    return RT_EOK;
+}
+
+rt_err_t rt_perf_rwlock(rt_perf_t *perf)
+{
+    rt_err_t ret = RT_EOK;
+    rt_uint8_t readers;
+
+    rt_mutex_init(&rw_mutex, "perf_mtx", RT_IPC_FLAG_PRIO);
+#ifdef RT_USING_RWLOCK
+    rt_rwlock_init(&rw_rwlock, "perf_rw");
+#endif /* RT_USING_RWLOCK */
+#ifdef RT_USING_SEQLOCK
+    rt_seqlock_init(&rw_seqlock, "perf_sq");
+#endif /* RT_USING_SEQLOCK */
+    for (readers = 0; readers < RT_UTEST_RWLOCK_READERS; readers++)
+        rt_sem_init(&rw_go[readers], "perf_go", 0, RT_IPC_FLAG_PRIO);
+    rt_sem_init(&rw_done, "perf_done", 0, RT_IPC_FLAG_PRIO);
+
+    /* every reader does the same reads, the time stays flat while readers scale */
+    for (readers = 1; readers <= RT_UTEST_RWLOCK_READERS && ret == RT_EOK; readers++)
+        ret = perf_rwlock_run(perf, readers);
+
+    rt_sem_detach(&rw_done);
+    for (readers = 0; readers < RT_UTEST_RWLOCK_READERS; readers++)
+        rt_sem_detach(&rw_go[readers]);
+#ifdef RT_USING_SEQLOCK
+    rt_seqlock_detach(&rw_seqlock);
+#endif /* RT_USING_SEQLOCK */
+#ifdef RT_USING_RWLOCK
+    rt_rwlock_detach(&rw_rwlock);
+#endif /* RT_USING_RWLOCK */
+    rt_mutex_detach(&rw_mutex);
+
+    return ret;
+}
+
+#endif /* defined(RT_USING_RWLOCK) || defined(RT_USING_SEQLOCK) */
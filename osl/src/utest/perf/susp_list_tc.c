@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2006-2026, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-19     proyrb       test case for blocking behind many waiters
+ */
+
+#include <rtthread.h>
+#include <rthw.h>
+#include <rtdevice.h>
+#include <utest.h>
+#include <utest_assert.h>
+#include <perf_tc.h>
+
+/* the hwtimer counts microseconds, so each sample is a batch of blocks */
+#define SUSP_TAKE_BATCH         20
+#define SUSP_WAITER_MAX         64
+#define SUSP_WAITER_STACK_SIZE  1024
+/* waiters spread over the priorities above the taker */
+#define SUSP_WAITER_PRIOS       4
+/* every waiter at its own priority, the taker and the resumer stay above idle */
+#if RT_THREAD_PRIORITY_MAX - 4 < SUSP_WAITER_MAX
+#define SUSP_DISTINCT_PRIOS     (RT_THREAD_PRIORITY_MAX - 4)
+#else
+#define SUSP_DISTINCT_PRIOS     SUSP_WAITER_MAX
+#endif
+
+struct susp_case
+{
+    rt_uint32_t waiters;
+    rt_uint32_t prios;
+};
+
+/* the few priorities are the best case of the index, the distinct ones its worst */
+static const struct susp_case susp_cases[] =
+{
+    {0, SUSP_WAITER_PRIOS},
+    {16, SUSP_WAITER_PRIOS},
+    {SUSP_WAITER_MAX, SUSP_WAITER_PRIOS},
+    {16, SUSP_DISTINCT_PRIOS},
+    {SUSP_WAITER_MAX, SUSP_DISTINCT_PRIOS},
+};
+
+static struct rt_semaphore perf_sem;
+static struct rt_semaphore perf_done;
+static rt_atomic_t perf_running;
+
+static void susp_waiter_entry(void *parameter)
+{
+    /* returns with an error once the semaphore is detached */
+    rt_sem_take(&perf_sem, RT_WAITING_FOREVER);
+}
+
+/* queued behind every waiter, so a sorted insert walks all of them */
+static void susp_taker_entry(void *parameter)
+{
+    rt_perf_t *perf = (rt_perf_t *)parameter;
+    rt_uint32_t i, n;
+
+    for (n = 0; n < RT_UTEST_SYS_PERF_TC_COUNT; n++)
+    {
+        rt_perf_start(perf);
+        for (i = 0; i < SUSP_TAKE_BATCH; i++)
+            rt_sem_take(&perf_sem, RT_WAITING_FOREVER);
+        rt_perf_stop(perf);
+    }
+
+    rt_atomic_store(&perf_running, 0);
+}
+
+/* runs whenever the taker blocks and puts it straight back */
+static void susp_resumer_entry(void *parameter)
+{
+    rt_thread_t taker = (rt_thread_t)parameter;
+
+    while (rt_atomic_load(&perf_running))
+        rt_thread_resume(taker);
+
+    rt_sem_release(&perf_done);
+}
+
+static rt_err_t susp_take_run(rt_perf_t *perf, rt_uint32_t waiters, rt_uint32_t prios)
+{
+    rt_thread_t thread, taker;
+    rt_uint8_t taker_prio;
+    rt_uint32_t i;
+
+    taker_prio = prios < THREAD_PRIORITY ? THREAD_PRIORITY + 1 : prios + 1;
+
+    rt_sem_init(&perf_sem, "perf_sp", 0, RT_IPC_FLAG_PRIO);
+    rt_sem_init(&perf_done, "perf_dn", 0, RT_IPC_FLAG_PRIO);
+
+    for (i = 0; i < waiters; i++)
+    {
+        thread = rt_thread_create("perf_sw", susp_waiter_entry, RT_NULL, SUSP_WAITER_STACK_SIZE,
+                                  taker_prio - 1 - i % prios, THREAD_TIMESLICE);
+        if (thread == RT_NULL)
+        {
+            LOG_E("create waiter %d failed.", i);
+            rt_sem_detach(&perf_sem);
+            rt_sem_detach(&perf_done);
+            return -RT_ENOMEM;
+        }
+        rt_thread_startup(thread);
+    }
+    /* let all of them block on the semaphore */
+    rt_thread_mdelay(20);
+
+    perf->count = 0;
+    perf->tot_time = 0;
+    perf->max_time = 0;
+    perf->min_time = RT_UINT32_MAX;
+    rt_snprintf(perf->name, sizeof(perf->name), "sem_block_w%u_p%u", waiters, prios);
+
+    taker = rt_thread_create("perf_st", susp_taker_entry, perf, THREAD_STACK_SIZE,
+                             taker_prio, THREAD_TIMESLICE);
+    thread = taker ? rt_thread_create("perf_sr", susp_resumer_entry, taker, THREAD_STACK_SIZE,
+                                      taker_prio + 1, THREAD_TIMESLICE) : RT_NULL;
+    if (taker == RT_NULL || thread == RT_NULL)
+    {
+        LOG_E("create taker failed.");
+        if (taker)
+            rt_thread_delete(taker);
+        rt_sem_detach(&perf_sem);
+        rt_sem_detach(&perf_done);
+        return -RT_ENOMEM;
+    }
+
+    rt_atomic_store(&perf_running, 1);
+    rt_thread_startup(thread);
+    rt_thread_startup(taker);
+    rt_sem_take(&perf_done, RT_WAITING_FOREVER);
+    rt_perf_dump(perf);
+
+    rt_sem_detach(&perf_sem);
+    rt_sem_detach(&perf_done);
+    /* let the waiters exit before their stacks are reclaimed */
+    rt_thread_mdelay(20);
+
+    return RT_EOK;
+}
+
+rt_err_t rt_perf_susp_list(rt_perf_t *perf)
+{
+    rt_err_t ret = RT_EOK;
+    rt_size_t i;
+
+    for (i = 0; i < sizeof(susp_cases) / sizeof(susp_cases[0]) && ret == RT_EOK; i++)
+        ret = susp_take_run(perf, susp_cases[i].waiters, susp_cases[i].prios);
+
+    return ret;
+}
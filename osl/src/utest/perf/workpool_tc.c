@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2006-2026, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-19     proyrb       test case for workpool fork/join
+ */
+
+#include <rtthread.h>
+#include <rthw.h>
+#include <rtdevice.h>
+#include <utest.h>
+#include <utest_assert.h>
+#include <perf_tc.h>
+
+#ifdef RT_USING_WORKPOOL
+
+/* the pool is measured with 1 up to this many workers */
+#ifndef RT_UTEST_WORKPOOL_WORKERS
+#define RT_UTEST_WORKPOOL_WORKERS   RT_CPUS_NR
+#endif
+
+#define FJ_DATA_COUNT       4096
+#define FJ_GRAIN            128
+
+struct fj_range
+{
+    rt_workpool_t pool;
+    const rt_uint32_t *data;
+    rt_size_t count;
+    rt_uint32_t sum;
+};
+
+static rt_uint32_t fj_data[FJ_DATA_COUNT];
+
+/* splits the range in halves down to the grain and joins the sums */
+static void fj_sum(void *parameter)
+{
+    struct fj_range *range = (struct fj_range *)parameter;
+    struct fj_range left, right;
+    struct rt_workpool_task task;
+    struct rt_workpool_group group;
+    rt_size_t i;
+
+    if (range->count <= FJ_GRAIN)
+    {
+        range->sum = 0;
+        for (i = 0; i < range->count; i++)
+            range->sum += range->data[i] * range->data[i];
+        return;
+    }
+
+    left.pool = right.pool = range->pool;
+    left.data = range->data;
+    left.count = range->count / 2;
+    right.data = range->data + left.count;
+    right.count = range->count - left.count;
+
+    rt_workpool_group_init(&group, "fj");
+    rt_workpool_submit(range->pool, &group, &task, fj_sum, &left);
+    fj_sum(&right);
+    rt_workpool_group_wait(range->pool, &group, RT_WAITING_FOREVER);
+    rt_workpool_group_detach(&group);
+
+    range->sum = left.sum + right.sum;
+}
+
+static rt_err_t perf_workpool_run(rt_perf_t *perf, rt_uint8_t workers)
+{
+    struct fj_range root;
+    struct rt_workpool_task task;
+    struct rt_workpool_group group;
+    rt_workpool_t pool;
+
+    pool = rt_workpool_create("perf_wp", workers, THREAD_STACK_SIZE, THREAD_PRIORITY, 0);
+    if (pool == RT_NULL)
+    {
+        LOG_E("perf_wp create failed.");
+        return -RT_ERROR;
+    }
+
+    rt_snprintf(perf->name, sizeof(perf->name), "workpool_fj_w%d", workers);
+    perf->tot_time = 0;
+    perf->max_time = 0;
+    perf->min_time = RT_UINT32_MAX;
+    perf->count = 0;
+
+    rt_workpool_group_init(&group, "perf_fj");
+    for (rt_uint32_t n = 0; n < RT_UTEST_SYS_PERF_TC_COUNT; n++)
+    {
+        root.pool = pool;
+        root.data = fj_data;
+        root.count = FJ_DATA_COUNT;
+
+        rt_perf_start(perf);
+        rt_workpool_submit(pool, &group, &task, fj_sum, &root);
+        rt_workpool_group_wait(pool, &group, RT_WAITING_FOREVER);
+        rt_perf_stop(perf);
+    }
+    rt_workpool_group_detach(&group);
+    rt_workpool_delete(pool);
+
+    rt_perf_dump(perf);
+    return RT_EOK;
+}
+
+rt_err_t rt_perf_workpool(rt_perf_t *perf)
+{
+    rt_uint8_t workers;
+
+    for (rt_size_t i = 0; i < FJ_DATA_COUNT; i++)
+        fj_data[i] = (rt_uint32_t)i;
+
+    for (workers = 1; workers <= RT_UTEST_WORKPOOL_WORKERS; workers++)
+    {
+        if (perf_workpool_run(perf, workers) != RT_EOK)
+            return -RT_ERROR;
+    }
+
+    return RT_EOK;
+}
+
+#endif /* RT_USING_WORKPOOL */
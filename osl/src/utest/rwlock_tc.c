@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2006-2026, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-19     proyrb       the first version for reader-writer lock utest
+ */
+#define __RT_IPC_SOURCE__
+
+#include <rtthread.h>
+#include "utest.h"
+
+#ifdef ARCH_CPU_64BIT
+#define THREAD_STACKSIZE    8192
+#else
+#define THREAD_STACKSIZE    4096
+#endif
+
+#define STRESS_READERS      3
+#define STRESS_LOOPS        2000
+
+static struct rt_rwlock _rwlock;
+static struct rt_semaphore _done;
+static volatile rt_err_t _result;
+static volatile int _step;
+
+static rt_uint8_t _prio_self(void)
+{
+    return RT_SCHED_PRIV(rt_thread_self()).current_priority;
+}
+
+static rt_thread_t _spawn(const char *name, void (*entry)(void *), void *parameter, rt_uint8_t priority)
+{
+    rt_thread_t thread;
+
+    thread = rt_thread_create(name, entry, parameter, THREAD_STACKSIZE, priority, 10);
+    if (thread != RT_NULL)
+        rt_thread_startup(thread);
+
+    return thread;
+}
+
+static void test_rwlock_create(void)
+{
+#ifdef RT_USING_HEAP
+    rt_rwlock_t rwlock;
+
+    rwlock = rt_rwlock_create("rw_dyn");
+    uassert_not_null(rwlock);
+    uassert_int_equal(rt_object_get_type(&rwlock->parent), RT_Object_Class_RWLock);
+    uassert_int_equal(rt_rwlock_take_read(rwlock, RT_WAITING_NO), RT_EOK);
+    uassert_int_equal(rt_rwlock_release(rwlock), RT_EOK);
+    uassert_int_equal(rt_rwlock_delete(rwlock), RT_EOK);
+#endif /* RT_USING_HEAP */
+
+    uassert_int_equal(rt_rwlock_init(&_rwlock, "rw_st"), RT_EOK);
+    uassert_true(rt_object_is_systemobject(&_rwlock.parent));
+    uassert_int_equal(rt_rwlock_detach(&_rwlock), RT_EOK);
+}
+
+static void test_rwlock_single_thread(void)
+{
+    rt_rwlock_init(&_rwlock, "rw_st");
+
+    /* readers share the lock, also with themselves */
+    uassert_int_equal(rt_rwlock_take_read(&_rwlock, RT_WAITING_NO), RT_EOK);
+    uassert_int_equal(rt_rwlock_take_read(&_rwlock, RT_WAITING_NO), RT_EOK);
+    uassert_int_equal(rt_rwlock_get_readers(&_rwlock), 2);
+
+    /* a writer waits for the readers, and undoes everything on timeout */
+    uassert_int_equal(rt_rwlock_take_write(&_rwlock, RT_WAITING_NO), -RT_ETIMEOUT);
+    uassert_int_equal(rt_rwlock_take_write(&_rwlock, 2), -RT_ETIMEOUT);
+    uassert_int_equal(rt_atomic_load(&_rwlock.state), 2);
+    uassert_null(rt_rwlock_get_writer(&_rwlock));
+
+    uassert_int_equal(rt_rwlock_release(&_rwlock), RT_EOK);
+    uassert_int_equal(rt_rwlock_release(&_rwlock), RT_EOK);
+    uassert_int_equal(rt_rwlock_release(&_rwlock), -RT_ERROR);
+
+    uassert_int_equal(rt_rwlock_take_write(&_rwlock, RT_WAITING_NO), RT_EOK);
+    uassert_true(rt_rwlock_get_writer(&_rwlock) == rt_thread_self());
+    uassert_int_equal(rt_rwlock_take_write(&_rwlock, RT_WAITING_NO), -RT_EBUSY);
+    uassert_int_equal(rt_rwlock_take_read(&_rwlock, RT_WAITING_NO), -RT_EBUSY);
+    uassert_int_equal(rt_rwlock_release(&_rwlock), RT_EOK);
+    uassert_int_equal(rt_atomic_load(&_rwlock.state), 0);
+
+    rt_rwlock_detach(&_rwlock);
+}
+
+static void _writer_entry(void *parameter)
+{
+    _step = 1;
+    _result = rt_rwlock_take_write(&_rwlock, RT_WAITING_FOREVER);
+    _step = 2;
+    rt_thread_mdelay(20);
+    rt_rwlock_release(&_rwlock);
+
+    rt_sem_release(&_done);
+}
+
+static void _reader_entry(void *parameter)
+{
+    rt_int32_t timeout = (rt_int32_t)(rt_ubase_t)parameter;
+
+    _result = rt_rwlock_take_read(&_rwlock, timeout);
+    if (_result == RT_EOK)
+        rt_rwlock_release(&_rwlock);
+
+    rt_sem_release(&_done);
+}
+
+static void test_rwlock_writer_preferred(void)
+{
+    rt_rwlock_init(&_rwlock, "rw_pref");
+    rt_sem_init(&_done, "rw_done", 0, RT_IPC_FLAG_PRIO);
+    _step = 0;
+
+    uassert_int_equal(rt_rwlock_take_read(&_rwlock, RT_WAITING_NO), RT_EOK);
+
+    /* a waiting writer keeps new readers out */
+    uassert_not_null(_spawn("rw_w", _writer_entry, RT_NULL, _prio_self() - 1));
+    while (_step == 0)
+        rt_thread_mdelay(1);
+    rt_thread_mdelay(5);
+    uassert_int_equal(_step, 1);
+
+    uassert_not_null(_spawn("rw_r", _reader_entry, (void *)(rt_ubase_t)10, _prio_self() - 1));
+    uassert_int_equal(rt_sem_take(&_done, RT_TICK_PER_SECOND), RT_EOK);
+    uassert_int_equal(_result, -RT_ETIMEOUT);
+    uassert_int_equal(_step, 1);
+
+    /* the last reader lets the writer in */
+    rt_rwlock_release(&_rwlock);
+    rt_thread_mdelay(5);
+    uassert_int_equal(_step, 2);
+    uassert_int_equal(rt_rwlock_take_read(&_rwlock, RT_WAITING_FOREVER), RT_EOK);
+    rt_rwlock_release(&_rwlock);
+    uassert_int_equal(rt_sem_take(&_done, RT_TICK_PER_SECOND), RT_EOK);
+    uassert_int_equal(_result, RT_EOK);
+
+    rt_sem_detach(&_done);
+    rt_rwlock_detach(&_rwlock);
+}
+
+static void test_rwlock_priority_inherit(void)
+{
+    rt_uint8_t priority = _prio_self();
+
+    rt_rwlock_init(&_rwlock, "rw_pi");
+    rt_sem_init(&_done, "rw_done", 0, RT_IPC_FLAG_PRIO);
+
+    uassert_int_equal(rt_rwlock_take_write(&_rwlock, RT_WAITING_NO), RT_EOK);
+
+    /* a blocked reader lends its priority to the writer */
+    uassert_not_null(_spawn("rw_r", _reader_entry, (void *)RT_WAITING_FOREVER, priority - 2));
+    rt_thread_mdelay(5);
+    uassert_int_equal(_prio_self(), priority - 2);
+
+    rt_rwlock_release(&_rwlock);
+    uassert_int_equal(_prio_self(), priority);
+    uassert_int_equal(rt_sem_take(&_done, RT_TICK_PER_SECOND), RT_EOK);
+    uassert_int_equal(_result, RT_EOK);
+
+    rt_sem_detach(&_done);
+    rt_rwlock_detach(&_rwlock);
+}
+
+static volatile rt_uint32_t _data[2];
+static rt_atomic_t _inside;
+static volatile rt_bool_t _torn;
+
+static void _stress_reader_entry(void *parameter)
+{
+    for (int i = 0; i < STRESS_LOOPS; i++)
+    {
+        rt_rwlock_take_read(&_rwlock, RT_WAITING_FOREVER);
+        if (_data[0] != _data[1] || rt_atomic_load(&_inside) != 0)
+            _torn = RT_TRUE;
+        rt_rwlock_release(&_rwlock);
+    }
+
+    rt_sem_release(&_done);
+}
+
+static void _stress_writer_entry(void *parameter)
+{
+    for (int i = 0; i < STRESS_LOOPS / 4; i++)
+    {
+        rt_rwlock_take_write(&_rwlock, RT_WAITING_FOREVER);
+        if (rt_atomic_add(&_inside, 1) != 0 || rt_rwlock_get_readers(&_rwlock) != 0)
+            _torn = RT_TRUE;
+        _data[0]++;
+        rt_thread_yield();
+        _data[1]++;
+        rt_atomic_sub(&_inside, 1);
+        rt_rwlock_release(&_rwlock);
+    }
+
+    rt_sem_release(&_done);
+}
+
+static void test_rwlock_stress(void)
+{
+    rt_uint8_t priority = _prio_self() + 1;
+    int i;
+
+    rt_rwlock_init(&_rwlock, "rw_st");
+    rt_sem_init(&_done, "rw_done", 0, RT_IPC_FLAG_PRIO);
+    _data[0] = _data[1] = 0;
+    rt_atomic_store(&_inside, 0);
+    _torn = RT_FALSE;
+
+    for (i = 0; i < STRESS_READERS; i++)
+        uassert_not_null(_spawn("rw_sr", _stress_reader_entry, RT_NULL, priority));
+    for (i = 0; i < 2; i++)
+        uassert_not_null(_spawn("rw_sw", _stress_writer_entry, RT_NULL, priority));
+
+    for (i = 0; i < STRESS_READERS + 2; i++)
+        uassert_int_equal(rt_sem_take(&_done, 10 * RT_TICK_PER_SECOND), RT_EOK);
+
+    uassert_false(_torn);
+    uassert_int_equal(_data[0], 2 * (STRESS_LOOPS / 4));
+    uassert_int_equal(rt_atomic_load(&_rwlock.state), 0);
+
+    rt_sem_detach(&_done);
+    rt_rwlock_detach(&_rwlock);
+}
+
+static rt_err_t utest_tc_init(void)
+{
+    return RT_EOK;
+}
+
+static rt_err_t utest_tc_cleanup(void)
+{
+    return RT_EOK;
+}
+
+static void testcase(void)
+{
+    UTEST_UNIT_RUN(test_rwlock_create);
+    UTEST_UNIT_RUN(test_rwlock_single_thread);
+    UTEST_UNIT_RUN(test_rwlock_writer_preferred);
+    UTEST_UNIT_RUN(test_rwlock_priority_inherit);
+    UTEST_UNIT_RUN(test_rwlock_stress);
+}
+UTEST_TC_EXPORT(testcase, "core.rwlock", utest_tc_init, utest_tc_cleanup, 30);
@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2006-2026, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-19     proyrb       the first version for deadline class utest
+ */
+#include <rtthread.h>
+#include "utest.h"
+
+#define THREAD_STACKSIZE        UTEST_THR_STACK_SIZE
+#define CALIBRATE_TICKS         20
+
+/*
+ * Two periodic tasks with a utilization of about 0.9: schedulable under EDF,
+ * while under rate monotonic priorities the second one misses its deadline
+ * each time its release falls behind two jobs of the first one.
+ */
+struct periodic_task
+{
+    const char *name;
+    rt_tick_t period;
+    rt_tick_t runtime;
+    rt_uint32_t jobs;
+
+    rt_thread_t thread;
+    rt_bool_t edf;
+    rt_uint32_t misses;
+};
+
+static struct periodic_task task_set[] =
+{
+    {"dl_t1", 50, 25, 14},
+    {"dl_t2", 70, 30, 10},
+};
+
+#define TASK_COUNT              (sizeof(task_set) / sizeof(task_set[0]))
+
+static struct rt_semaphore done_sem;
+static rt_uint32_t loops_per_tick;
+
+/* busy loop for about the given number of ticks of cpu time */
+static void burn(rt_tick_t ticks)
+{
+    volatile rt_uint32_t loops = ticks * loops_per_tick;
+
+    while (loops--);
+}
+
+static void calibrate(void)
+{
+    volatile rt_uint32_t loops = 0;
+    rt_tick_t start;
+
+    start = rt_tick_get();
+    while (rt_tick_get() == start);
+    start = rt_tick_get();
+    while (rt_tick_get() - start < CALIBRATE_TICKS)
+        loops++;
+
+    /* the measuring loop is heavier than the burning one, this errs long */
+    loops_per_tick = loops / CALIBRATE_TICKS;
+}
+
+static void periodic_entry(void *parameter)
+{
+    struct periodic_task *task = (struct periodic_task *)parameter;
+    struct rt_sched_deadline_stat stat;
+    rt_tick_t release = rt_tick_get();
+    rt_uint32_t job;
+
+    for (job = 0; job < task->jobs; job++)
+    {
+        /* one tick below the budget absorbs calibration error */
+        burn(task->runtime - 1);
+
+        if (task->edf)
+        {
+            rt_thread_wait_period();
+        }
+        else
+        {
+            if (rt_tick_get() - release > task->period)
+                task->misses++;
+            rt_thread_delay_until(&release, task->period);
+        }
+    }
+
+    if (task->edf && rt_thread_get_deadline_stat(rt_thread_self(), &stat) == RT_EOK)
+        task->misses = stat.misses;
+
+    rt_sem_release(&done_sem);
+}
+
+static rt_uint32_t run_task_set(rt_bool_t edf)
+{
+    struct rt_sched_deadline_attr attr;
+    rt_uint32_t misses = 0;
+    rt_size_t i;
+
+    for (i = 0; i < TASK_COUNT; i++)
+    {
+        struct periodic_task *task = &task_set[i];
+
+        task->edf = edf;
+        task->misses = 0;
+        /* rate monotonic: the shorter period gets the higher priority */
+        task->thread = rt_thread_create(task->name, periodic_entry, task, THREAD_STACKSIZE,
+                                        RT_SCHED_DEADLINE_PRIORITY + i, 10);
+        uassert_not_null(task->thread);
+
+        if (edf)
+        {
+            attr.period = task->period;
+            attr.runtime = task->runtime;
+            attr.deadline = 0;
+            uassert_int_equal(rt_thread_set_deadline(task->thread, &attr), RT_EOK);
+        }
+    }
+
+    for (i = 0; i < TASK_COUNT; i++)
+        rt_thread_startup(task_set[i].thread);
+    for (i = 0; i < TASK_COUNT; i++)
+        rt_sem_take(&done_sem, RT_WAITING_FOREVER);
+
+    for (i = 0; i < TASK_COUNT; i++)
+        misses += task_set[i].misses;
+    return misses;
+}
+
+static void test_deadline_admission(void)
+{
+    struct rt_sched_deadline_attr attr;
+    rt_thread_t t1, t2;
+
+    t1 = rt_thread_create("dl_a1", periodic_entry, RT_NULL, THREAD_STACKSIZE, UTEST_THR_PRIORITY, 10);
+    t2 = rt_thread_create("dl_a2", periodic_entry, RT_NULL, THREAD_STACKSIZE, UTEST_THR_PRIORITY, 10);
+
+    /* runtime <= deadline <= period */
+    attr.period = 10;
+    attr.runtime = 11;
+    attr.deadline = 0;
+    uassert_int_equal(rt_thread_set_deadline(t1, &attr), -RT_EINVAL);
+    attr.runtime = 2;
+    attr.deadline = 20;
+    uassert_int_equal(rt_thread_set_deadline(t1, &attr), -RT_EINVAL);
+
+    /* half of the cpu each does not leave room for the fixed priority threads */
+    attr.runtime = 5;
+    attr.deadline = 0;
+    uassert_int_equal(rt_thread_set_deadline(t1, &attr), RT_EOK);
+    uassert_int_equal(rt_thread_set_deadline(t2, &attr), -RT_EFULL);
+
+    /* a constrained deadline is accounted by density */
+    attr.runtime = 2;
+    attr.deadline = 4;
+    uassert_int_equal(rt_thread_set_deadline(t2, &attr), -RT_EFULL);
+    attr.period = 100;
+    attr.deadline = 10;
+    uassert_int_equal(rt_thread_set_deadline(t2, &attr), RT_EOK);
+
+    /* leaving the class gives the bandwidth back and restores the priority */
+    uassert_int_equal(rt_thread_set_deadline(t1, RT_NULL), RT_EOK);
+    uassert_int_equal(RT_SCHED_PRIV(t1).current_priority, UTEST_THR_PRIORITY);
+    attr.period = 10;
+    attr.runtime = 5;
+    attr.deadline = 0;
+    uassert_int_equal(rt_thread_set_deadline(t1, &attr), RT_EOK);
+
+    /* deleting a thread gives its bandwidth back as well */
+    rt_thread_delete(t1);
+    t1 = rt_thread_create("dl_a3", periodic_entry, RT_NULL, THREAD_STACKSIZE, UTEST_THR_PRIORITY, 10);
+    uassert_int_equal(rt_thread_set_deadline(t1, &attr), RT_EOK);
+
+    rt_thread_delete(t1);
+    rt_thread_delete(t2);
+}
+
+static struct rt_sched_deadline_stat overrun_stat;
+
+static void overrun_entry(void *parameter)
+{
+    int job;
+
+    for (job = 0; job < 2; job++)
+    {
+        burn(6);
+        rt_thread_wait_period();
+    }
+
+    /* the counters are gone once the thread exits */
+    rt_thread_get_deadline_stat(rt_thread_self(), &overrun_stat);
+    rt_sem_release(&done_sem);
+}
+
+static void test_deadline_overrun(void)
+{
+    struct rt_sched_deadline_attr attr = {50, 2, 0};
+    rt_thread_t thread;
+
+    thread = rt_thread_create("dl_ovr", overrun_entry, RT_NULL, THREAD_STACKSIZE, UTEST_THR_PRIORITY, 10);
+    uassert_int_equal(rt_thread_set_deadline(thread, &attr), RT_EOK);
+    rt_thread_startup(thread);
+    rt_sem_take(&done_sem, RT_WAITING_FOREVER);
+
+    /* each job burns about three budgets */
+    uassert_int_equal(overrun_stat.jobs, 2);
+    uassert_true(overrun_stat.overruns >= 2);
+}
+
+static void test_deadline_task_set(void)
+{
+    rt_uint32_t edf_misses, fixed_misses;
+
+    fixed_misses = run_task_set(RT_FALSE);
+    edf_misses = run_task_set(RT_TRUE);
+
+    rt_kprintf("deadline misses: fixed priority %d, earliest deadline first %d\n",
+               fixed_misses, edf_misses);
+    uassert_int_equal(edf_misses, 0);
+}
+
+static rt_err_t utest_tc_init(void)
+{
+    rt_sem_init(&done_sem, "dl_done", 0, RT_IPC_FLAG_FIFO);
+    calibrate();
+    return RT_EOK;
+}
+
+static rt_err_t utest_tc_cleanup(void)
+{
+    rt_sem_detach(&done_sem);
+    return RT_EOK;
+}
+
+static void testcase(void)
+{
+    UTEST_UNIT_RUN(test_deadline_admission);
+    UTEST_UNIT_RUN(test_deadline_overrun);
+    UTEST_UNIT_RUN(test_deadline_task_set);
+}
+UTEST_TC_EXPORT(testcase, "core.sched_deadline", utest_tc_init, utest_tc_cleanup, 30);
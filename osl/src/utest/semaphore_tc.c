@@ -6,6 +6,8 @@
  * Change Logs:
  * Date           Author       Notes
  * 2021-08-12     luckyzjq     the first version
+ * 2026-10-19     proyrb       add waiter order test for priority queued semaphore
+ * 2026-10-19     proyrb       add test for deleting a waiter overtaken by others
  */
 
 #include <rtthread.h>
@@ -515,6 +517,103 @@ static void test_dynamic_semaphore_release_isr(void)
     uassert_true(RT_TRUE);
 }
 
+#define PRIO_WAITER_NUM     9
+
+static volatile int prio_woken;
+static rt_uint8_t prio_order[PRIO_WAITER_NUM];
+
+static void prio_waiter_entry(void *parameter)
+{
+    /* a waiter with a timeout leaves the middle of the queue early */
+    if (rt_sem_take(dynamic_semaphore, (rt_ubase_t)parameter & 0x80 ? rt_tick_from_millisecond(5) : RT_WAITING_FOREVER) == RT_EOK)
+        prio_order[prio_woken++] = (rt_ubase_t)parameter & 0x7f;
+}
+
+static void test_dynamic_semaphore_prio_order(void)
+{
+    /* queued in this order, the timed one is dropped in between */
+    static const rt_uint8_t raise[PRIO_WAITER_NUM] = {1, 3, 2, 3, 1, 2, 3, 2, 2};
+    static const rt_uint8_t expect[PRIO_WAITER_NUM - 1] = {1, 3, 6, 2, 5, 7, 0, 4};
+    rt_uint8_t priority = RT_SCHED_PRIV(rt_thread_self()).current_priority;
+    rt_thread_t thread;
+    int i;
+
+    dynamic_semaphore = rt_sem_create("prio_sem", 0, RT_IPC_FLAG_PRIO);
+    uassert_not_null(dynamic_semaphore);
+    if (dynamic_semaphore == RT_NULL)
+        return;
+    prio_woken = 0;
+
+    /* each waiter runs and blocks right away */
+    for (i = 0; i < PRIO_WAITER_NUM; i++)
+    {
+        thread = rt_thread_create("prio_w", prio_waiter_entry,
+                                  (void *)(rt_ubase_t)(i == PRIO_WAITER_NUM - 1 ? 0x80 | i : i),
+                                  2048, priority - raise[i], 10);
+        uassert_not_null(thread);
+        if (thread)
+            rt_thread_startup(thread);
+    }
+    rt_thread_mdelay(20);
+
+    /* highest priority first, the order of arrival within one priority */
+    for (i = 0; i < PRIO_WAITER_NUM - 1; i++)
+        rt_sem_release(dynamic_semaphore);
+    uassert_int_equal(prio_woken, PRIO_WAITER_NUM - 1);
+    for (i = 0; i < PRIO_WAITER_NUM - 1; i++)
+        uassert_int_equal(prio_order[i], expect[i]);
+
+    rt_sem_delete(dynamic_semaphore);
+}
+
+static void test_dynamic_semaphore_delete_waiter(void)
+{
+    /* the first one is queued alone, then the others overtake it and it is deleted */
+    static const rt_uint8_t raise[] = {1, 3, 2, 1};
+    static const rt_uint8_t expect[] = {1, 2, 3};
+    rt_uint8_t priority = RT_SCHED_PRIV(rt_thread_self()).current_priority;
+    rt_thread_t thread, first = RT_NULL;
+    rt_size_t i;
+
+    dynamic_semaphore = rt_sem_create("prio_sem", 0, RT_IPC_FLAG_PRIO);
+    uassert_not_null(dynamic_semaphore);
+    if (dynamic_semaphore == RT_NULL)
+        return;
+    prio_woken = 0;
+
+    for (i = 0; i < sizeof(raise) / sizeof(raise[0]); i++)
+    {
+        thread = rt_thread_create("prio_w", prio_waiter_entry, (void *)(rt_ubase_t)i,
+                                  2048, priority - raise[i], 10);
+        uassert_not_null(thread);
+        if (thread == RT_NULL)
+            continue;
+        if (i == 0)
+            first = thread;
+        rt_thread_startup(thread);
+        rt_thread_mdelay(2);
+    }
+
+    /* its memory is handed out again before the others are woken */
+    uassert_int_equal(rt_thread_delete(first), RT_EOK);
+    rt_thread_mdelay(20);
+    for (i = 0; i < 4; i++)
+    {
+        thread = rt_thread_create("prio_r", prio_waiter_entry, RT_NULL, 2048, priority, 10);
+        if (thread)
+            rt_thread_delete(thread);
+    }
+    rt_thread_mdelay(20);
+
+    for (i = 0; i < sizeof(expect) / sizeof(expect[0]); i++)
+        rt_sem_release(dynamic_semaphore);
+    uassert_int_equal(prio_woken, sizeof(expect) / sizeof(expect[0]));
+    for (i = 0; i < sizeof(expect) / sizeof(expect[0]); i++)
+        uassert_int_equal(prio_order[i], expect[i]);
+
+    rt_sem_delete(dynamic_semaphore);
+}
+
 #endif /* RT_USING_HEAP */
 
 static rt_err_t utest_tc_init(void)
@@ -553,6 +652,8 @@ static void testcase(void)
     UTEST_UNIT_RUN(test_dynamic_semaphore_trytake);
     UTEST_UNIT_RUN(test_dynamic_semaphore_control);
     UTEST_UNIT_RUN(test_dynamic_semaphore_release_isr);
+    UTEST_UNIT_RUN(test_dynamic_semaphore_prio_order);
+    UTEST_UNIT_RUN(test_dynamic_semaphore_delete_waiter);
 #endif /* RT_USING_HEAP */
 }
 UTEST_TC_EXPORT(testcase, "core.semaphore", utest_tc_init, utest_tc_cleanup, 1000);
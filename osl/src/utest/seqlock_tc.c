@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2006-2026, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-19     proyrb       the first version for sequence lock utest
+ */
+#include <rtthread.h>
+#include "utest.h"
+
+#ifdef ARCH_CPU_64BIT
+#define THREAD_STACKSIZE    8192
+#else
+#define THREAD_STACKSIZE    4096
+#endif
+
+#define STRESS_READERS      3
+#define STRESS_LOOPS        5000
+
+struct snapshot
+{
+    rt_uint32_t seq;
+    rt_uint32_t value[6];
+    rt_uint32_t check;
+};
+
+static struct rt_seqlock _seqlock;
+static struct snapshot _shared;
+static struct rt_semaphore _done;
+static volatile rt_bool_t _torn;
+static volatile rt_bool_t _stop;
+
+static void _snapshot_fill(struct snapshot *snap, rt_uint32_t seq)
+{
+    snap->seq = seq;
+    snap->check = seq;
+    for (int i = 0; i < 6; i++)
+    {
+        snap->value[i] = seq * (i + 1);
+        snap->check ^= snap->value[i];
+    }
+}
+
+static rt_bool_t _snapshot_valid(const struct snapshot *snap)
+{
+    rt_uint32_t check = snap->seq;
+
+    for (int i = 0; i < 6; i++)
+    {
+        if (snap->value[i] != snap->seq * (i + 1))
+            return RT_FALSE;
+        check ^= snap->value[i];
+    }
+
+    return check == snap->check;
+}
+
+static void test_seqlock_create(void)
+{
+#ifdef RT_USING_HEAP
+    rt_seqlock_t seqlock;
+
+    seqlock = rt_seqlock_create("sq_dyn");
+    uassert_not_null(seqlock);
+    uassert_int_equal(rt_object_get_type(&seqlock->parent), RT_Object_Class_SeqLock);
+    uassert_int_equal(rt_seqlock_delete(seqlock), RT_EOK);
+#endif /* RT_USING_HEAP */
+
+    uassert_int_equal(rt_seqlock_init(&_seqlock, "sq_st"), RT_EOK);
+    uassert_true(rt_object_is_systemobject(&_seqlock.parent));
+    uassert_int_equal(rt_seqlock_detach(&_seqlock), RT_EOK);
+}
+
+static void test_seqlock_single_thread(void)
+{
+    struct snapshot snap;
+    rt_uint32_t start;
+    rt_base_t level;
+    rt_err_t ret;
+
+    rt_seqlock_init(&_seqlock, "sq_st");
+    _snapshot_fill(&_shared, 0);
+
+    start = rt_seqlock_read_begin(&_seqlock);
+    uassert_int_equal(start, 0);
+    uassert_false(rt_seqlock_read_retry(&_seqlock, start));
+
+    /* a write between begin and retry makes the reader repeat */
+    _snapshot_fill(&snap, 1);
+    rt_seqlock_write(&_seqlock, &_shared, &snap, sizeof(snap));
+    uassert_true(rt_seqlock_read_retry(&_seqlock, start));
+    uassert_int_equal(rt_seqlock_read_begin(&_seqlock), 2);
+
+    rt_memset(&snap, 0, sizeof(snap));
+    uassert_int_equal(rt_seqlock_read(&_seqlock, &snap, &_shared, sizeof(snap), RT_WAITING_NO), RT_EOK);
+    uassert_int_equal(snap.seq, 1);
+    uassert_true(_snapshot_valid(&snap));
+
+    /* no snapshot while a write is open */
+    level = rt_seqlock_write_begin(&_seqlock);
+    _shared.value[0] = 0;
+    ret = rt_seqlock_read(&_seqlock, &snap, &_shared, sizeof(snap), RT_WAITING_NO);
+    start = rt_seqlock_read_begin(&_seqlock);
+    _shared.value[0] = 1;
+    rt_seqlock_write_end(&_seqlock, level);
+    uassert_int_equal(ret, -RT_ETIMEOUT);
+    uassert_true(rt_seqlock_read_retry(&_seqlock, start));
+
+    rt_seqlock_detach(&_seqlock);
+}
+
+static void _stress_reader_entry(void *parameter)
+{
+    struct snapshot snap;
+
+    for (int i = 0; i < STRESS_LOOPS; i++)
+    {
+        if (rt_seqlock_read(&_seqlock, &snap, &_shared, sizeof(snap), RT_WAITING_FOREVER) != RT_EOK ||
+            !_snapshot_valid(&snap))
+        {
+            _torn = RT_TRUE;
+        }
+        if ((i & 63) == 0)
+            rt_thread_yield();
+    }
+
+    rt_sem_release(&_done);
+}
+
+static void _stress_writer_entry(void *parameter)
+{
+    struct snapshot snap;
+    rt_uint32_t seq = 0;
+
+    while (!_stop)
+    {
+        _snapshot_fill(&snap, ++seq);
+        rt_seqlock_write(&_seqlock, &_shared, &snap, sizeof(snap));
+        rt_thread_yield();
+    }
+
+    rt_sem_release(&_done);
+}
+
+static void test_seqlock_stress(void)
+{
+    rt_uint8_t priority = RT_SCHED_PRIV(rt_thread_self()).current_priority + 1;
+    rt_thread_t thread;
+    int i;
+
+    rt_seqlock_init(&_seqlock, "sq_st");
+    rt_sem_init(&_done, "sq_done", 0, RT_IPC_FLAG_PRIO);
+    _snapshot_fill(&_shared, 0);
+    _torn = RT_FALSE;
+    _stop = RT_FALSE;
+
+    for (i = 0; i <= STRESS_READERS; i++)
+    {
+        thread = rt_thread_create(i < STRESS_READERS ? "sq_r" : "sq_w",
+                                  i < STRESS_READERS ? _stress_reader_entry : _stress_writer_entry,
+                                  RT_NULL, THREAD_STACKSIZE, priority, 10);
+        uassert_not_null(thread);
+        rt_thread_startup(thread);
+    }
+
+    for (i = 0; i < STRESS_READERS; i++)
+        uassert_int_equal(rt_sem_take(&_done, 10 * RT_TICK_PER_SECOND), RT_EOK);
+    _stop = RT_TRUE;
+    uassert_int_equal(rt_sem_take(&_done, RT_TICK_PER_SECOND), RT_EOK);
+
+    uassert_false(_torn);
+    uassert_int_equal(rt_seqlock_read_begin(&_seqlock) & 1, 0);
+
+    rt_sem_detach(&_done);
+    rt_seqlock_detach(&_seqlock);
+}
+
+static rt_err_t utest_tc_init(void)
+{
+    return RT_EOK;
+}
+
+static rt_err_t utest_tc_cleanup(void)
+{
+    return RT_EOK;
+}
+
+static void testcase(void)
+{
+    UTEST_UNIT_RUN(test_seqlock_create);
+    UTEST_UNIT_RUN(test_seqlock_single_thread);
+    UTEST_UNIT_RUN(test_seqlock_stress);
+}
+UTEST_TC_EXPORT(testcase, "core.seqlock", utest_tc_init, utest_tc_cleanup, 30);
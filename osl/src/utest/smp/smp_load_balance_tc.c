@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2006-2026, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-19     proyrb       the first version
+ */
+
+#include <rtthread.h>
+#include "utest.h"
+
+/**
+ * @brief   Unbound threads piled up on one core are spread over all cores.
+ *
+ * @note    Create two busy threads per core, all bound to core 0 so that their
+ *          ready queue is there, then unbind them at once. Each thread counts
+ *          loops until the run ends. The total must scale with the number of
+ *          cores compared to one thread alone (throughput), and no thread may
+ *          fall far behind the others (fairness). With RT_SCHED_USING_BALANCE
+ *          the migration counters must show the threads moving.
+ */
+
+#define THREAD_STACK_SIZE UTEST_THR_STACK_SIZE
+/* just above idle, the busy threads never starve the test thread */
+#define THREAD_PRIORITY   (RT_THREAD_PRIORITY_MAX - 2)
+#define THREAD_COUNT      (RT_CPUS_NR * 2)
+#define RUN_TICKS         (RT_TICK_PER_SECOND * 2)
+
+static rt_thread_t          threads[THREAD_COUNT];
+static volatile rt_uint32_t loops[THREAD_COUNT];
+static volatile int         stop_flag;
+static struct rt_semaphore  done_sem;
+
+static void thread_entry(void *parameter)
+{
+    int index = (int)(rt_ubase_t)parameter;
+
+    while (!stop_flag)
+    {
+        loops[index]++;
+    }
+
+    rt_sem_release(&done_sem);
+}
+
+static rt_uint32_t run_threads(int count, rt_tick_t ticks)
+{
+    rt_uint32_t total = 0;
+    char thread_name[RT_NAME_MAX];
+    int i;
+
+    stop_flag = 0;
+    for (i = 0; i < count; i++)
+    {
+        loops[i] = 0;
+        rt_snprintf(thread_name, sizeof(thread_name), "lb%d", i);
+        threads[i] = rt_thread_create(thread_name, thread_entry, (void *)(rt_ubase_t)i,
+                                      THREAD_STACK_SIZE, THREAD_PRIORITY, 5);
+        uassert_not_null(threads[i]);
+        rt_thread_control(threads[i], RT_THREAD_CTRL_BIND_CPU, (void *)0);
+        rt_thread_startup(threads[i]);
+    }
+
+    /* release the whole backlog of core 0 */
+    for (i = 0; i < count; i++)
+    {
+        rt_thread_control(threads[i], RT_THREAD_CTRL_BIND_CPU, (void *)RT_CPUS_NR);
+    }
+
+    rt_thread_delay(ticks);
+    stop_flag = 1;
+
+    for (i = 0; i < count; i++)
+    {
+        rt_sem_take(&done_sem, RT_WAITING_FOREVER);
+        total += loops[i];
+    }
+
+    return total;
+}
+
+static void load_balance_tc(void)
+{
+    rt_uint32_t single, total, min, max;
+    int i;
+#ifdef RT_SCHED_USING_BALANCE
+    struct rt_sched_balance_stat stat;
+    rt_uint32_t migrations = 0;
+#endif /* RT_SCHED_USING_BALANCE */
+
+    /* baseline, one thread alone */
+    single = run_threads(1, RUN_TICKS);
+
+    total = run_threads(THREAD_COUNT, RUN_TICKS);
+
+    min = max = loops[0];
+    for (i = 1; i < THREAD_COUNT; i++)
+    {
+        if (loops[i] < min)
+            min = loops[i];
+        if (loops[i] > max)
+            max = loops[i];
+    }
+
+    rt_kprintf("single %u, total %u on %d cores, per thread %u..%u\n",
+               single, total, RT_CPUS_NR, min, max);
+
+    /* at least half of the ideal speedup */
+    uassert_true((rt_uint64_t)total * 2 >= (rt_uint64_t)single * RT_CPUS_NR);
+    /* with two threads per core nobody gets less than a quarter of the best */
+    uassert_true((rt_uint64_t)min * 4 >= max);
+
+#ifdef RT_SCHED_USING_BALANCE
+    for (i = 0; i < RT_CPUS_NR; i++)
+    {
+        uassert_int_equal(rt_scheduler_get_balance_stat(i, &stat), RT_EOK);
+        rt_kprintf("cpu%d: wake %u, idle %u, tick %u, queued %u\n", i,
+                   stat.wake_migrations, stat.idle_pulls, stat.tick_pulls, stat.nr_queued);
+        migrations += stat.wake_migrations + stat.idle_pulls + stat.tick_pulls;
+    }
+    uassert_true(migrations > 0);
+    uassert_int_equal(rt_scheduler_get_balance_stat(RT_CPUS_NR, &stat), -RT_EINVAL);
+#endif /* RT_SCHED_USING_BALANCE */
+}
+
+static rt_err_t utest_tc_init(void)
+{
+    rt_kprintf("[Test case]: unbound threads are balanced over the cores\r\n");
+    return rt_sem_init(&done_sem, "lb_done", 0, RT_IPC_FLAG_PRIO);
+}
+
+static rt_err_t utest_tc_cleanup(void)
+{
+    return rt_sem_detach(&done_sem);
+}
+
+static void testcase(void)
+{
+    UTEST_UNIT_RUN(load_balance_tc);
+}
+UTEST_TC_EXPORT(testcase, "core.smp_load_balance", utest_tc_init, utest_tc_cleanup, 10);
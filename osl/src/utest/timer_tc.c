@@ -703,6 +703,121 @@ static void test_timer_stress(void)
     LOG_I("success after %lu iterations", iters);
 }
 
+#ifdef RT_USING_TIMER_SLACK
+#define SLACK_TEST_MS 2000
+
+/* a mix like the periodic timers of a board: GUI tick, refresh, polls and kicks */
+typedef struct slack_timer_struct
+{
+    struct rt_timer timer;
+    rt_uint32_t period_ms;
+    rt_uint32_t slack_ms;
+    rt_tick_t due;                /* when the timer should have fired without slack */
+    rt_tick_t late;               /* worst lateness */
+    rt_ubase_t callbacks;
+} slack_timer_struct;
+
+static slack_timer_struct slack_timers[] = {
+    {.period_ms = 5,    .slack_ms = 1},
+    {.period_ms = 20,   .slack_ms = 4},
+    {.period_ms = 33,   .slack_ms = 4},
+    {.period_ms = 50,   .slack_ms = 8},
+    {.period_ms = 100,  .slack_ms = 15},
+    {.period_ms = 500,  .slack_ms = 50},
+    {.period_ms = 1000, .slack_ms = 200},
+};
+#define SLACK_TIMERS (sizeof(slack_timers) / sizeof(slack_timers[0]))
+
+static rt_tick_t slack_last_tick;
+static rt_ubase_t slack_wakeups;
+
+static void timer_slack(void *param)
+{
+    slack_timer_struct *st = (slack_timer_struct *)param;
+    rt_tick_t now = rt_tick_get();
+
+    st->due += st->timer.init_tick;
+    if (now - st->due > st->late)
+        st->late = now - st->due;
+    st->callbacks++;
+
+    /* timeouts handled in the same tick share one wakeup */
+    if (now != slack_last_tick)
+    {
+        slack_last_tick = now;
+        slack_wakeups++;
+    }
+}
+
+static rt_ubase_t timer_slack_run(rt_bool_t with_slack, rt_ubase_t *callbacks)
+{
+    slack_timer_struct *st;
+    rt_tick_t slack;
+    rt_base_t level;
+    int i;
+
+    slack_wakeups = 0;
+    slack_last_tick = rt_tick_get() - 1;
+    for (i = 0; i < SLACK_TIMERS; i++)
+    {
+        st = &slack_timers[i];
+        st->late = 0;
+        st->callbacks = 0;
+        rt_timer_init(&st->timer, "slack", timer_slack, st,
+                      rt_tick_from_millisecond(st->period_ms),
+                      RT_TIMER_FLAG_PERIODIC | RT_TIMER_FLAG_HARD_TIMER);
+        slack = with_slack ? rt_tick_from_millisecond(st->slack_ms) : 0;
+        uassert_true(rt_timer_control(&st->timer, RT_TIMER_CTRL_SET_SLACK, &slack) == RT_EOK);
+
+        /* no tick between taking the start time and starting */
+        level = rt_hw_interrupt_disable();
+        st->due = rt_tick_get();
+        rt_timer_start(&st->timer);
+        rt_hw_interrupt_enable(level);
+        rt_thread_delay(1);
+    }
+
+    rt_thread_mdelay(SLACK_TEST_MS);
+
+    for (i = 0; i < SLACK_TIMERS; i++)
+    {
+        st = &slack_timers[i];
+        rt_timer_detach(&st->timer);
+
+        slack = with_slack ? rt_tick_from_millisecond(st->slack_ms) : 0;
+        uassert_true(st->late <= slack);
+        if (with_slack)
+        {
+            /* the period does not stretch by the lateness */
+            uassert_true(st->callbacks + 1 >= callbacks[i]);
+        }
+        else
+        {
+            callbacks[i] = st->callbacks;
+        }
+    }
+
+    return slack_wakeups;
+}
+
+static void test_timer_slack(void)
+{
+    rt_ubase_t callbacks[SLACK_TIMERS];
+    rt_ubase_t exact, coalesced;
+    rt_tick_t slack = 0;
+
+    rt_timer_init(&slack_timers[0].timer, "slack", timer_slack, RT_NULL, 10, RT_TIMER_FLAG_ONE_SHOT);
+    uassert_true(rt_timer_control(&slack_timers[0].timer, RT_TIMER_CTRL_GET_SLACK, &slack) == RT_EOK);
+    uassert_true(slack == 0);
+    rt_timer_detach(&slack_timers[0].timer);
+
+    exact = timer_slack_run(RT_FALSE, callbacks);
+    coalesced = timer_slack_run(RT_TRUE, callbacks);
+    LOG_I("timer slack: %d wakeups exact, %d with slack", exact, coalesced);
+    uassert_true(coalesced < exact);
+}
+#endif /* RT_USING_TIMER_SLACK */
+
 static rt_err_t utest_tc_init(void)
 {
     timer.dynamic_timer = RT_NULL;
@@ -739,6 +854,10 @@ static void testcase(void)
     UTEST_UNIT_RUN(test_dynamic_timer_op_in_callback);
     PRINT_PROGRESS(__LINE__);
 #endif /* RT_USING_HEAP */
+#ifdef RT_USING_TIMER_SLACK
+    UTEST_UNIT_RUN(test_timer_slack);
+    PRINT_PROGRESS(__LINE__);
+#endif /* RT_USING_TIMER_SLACK */
     UTEST_UNIT_RUN(test_timer_stress);
     PRINT_PROGRESS(__LINE__);
 }
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2006-2026, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-19     proyrb       the first version for workpool utest
+ */
+#include <rtthread.h>
+#include "utest.h"
+
+#define THREAD_PRIORITY         25
+#define THREAD_STACKSIZE        (UTEST_THR_STACK_SIZE * 2)
+#define WORKER_COUNT            2
+#define TASK_COUNT              32
+#define FIB_N                   18
+#define FIB_SERIAL              8
+#define FANOUT_COUNT            200
+
+static rt_workpool_t pool;
+static rt_atomic_t counter;
+
+static void count_task(void *parameter)
+{
+    rt_atomic_add(&counter, 1);
+}
+
+static void test_workpool_submit(void)
+{
+    struct rt_workpool_group group;
+    struct rt_workpool_task tasks[TASK_COUNT];
+    int i;
+
+    rt_atomic_store(&counter, 0);
+    uassert_int_equal(rt_workpool_group_init(&group, "tc_grp"), RT_EOK);
+    for (i = 0; i < TASK_COUNT; i++)
+        rt_workpool_submit(pool, &group, &tasks[i], count_task, RT_NULL);
+
+    uassert_int_equal(rt_workpool_group_wait(pool, &group, RT_WAITING_FOREVER), RT_EOK);
+    uassert_int_equal(rt_atomic_load(&counter), TASK_COUNT);
+    uassert_int_equal(rt_workpool_group_detach(&group), RT_EOK);
+}
+
+struct fib_arg
+{
+    int n;
+    int result;
+};
+
+static int fib_serial(int n)
+{
+    return n < 2 ? n : fib_serial(n - 1) + fib_serial(n - 2);
+}
+
+/* forks both halves on the pool and joins them from inside a worker */
+static void fib_task(void *parameter)
+{
+    struct fib_arg *arg = (struct fib_arg *)parameter;
+    struct fib_arg left, right;
+    struct rt_workpool_task tasks[2];
+    struct rt_workpool_group group;
+
+    if (arg->n < FIB_SERIAL)
+    {
+        arg->result = fib_serial(arg->n);
+        return;
+    }
+
+    left.n = arg->n - 1;
+    right.n = arg->n - 2;
+    rt_workpool_group_init(&group, "fib");
+    rt_workpool_submit(pool, &group, &tasks[0], fib_task, &left);
+    rt_workpool_submit(pool, &group, &tasks[1], fib_task, &right);
+    rt_workpool_group_wait(pool, &group, RT_WAITING_FOREVER);
+    rt_workpool_group_detach(&group);
+
+    arg->result = left.result + right.result;
+}
+
+static void test_workpool_fork_join(void)
+{
+    struct rt_workpool_group group;
+    struct rt_workpool_task task;
+    struct fib_arg arg;
+
+    arg.n = FIB_N;
+    rt_workpool_group_init(&group, "tc_grp");
+    rt_workpool_submit(pool, &group, &task, fib_task, &arg);
+    uassert_int_equal(rt_workpool_group_wait(pool, &group, RT_WAITING_FOREVER), RT_EOK);
+    rt_workpool_group_detach(&group);
+
+    uassert_int_equal(arg.result, fib_serial(FIB_N));
+}
+
+static struct rt_workpool_task fanout_tasks[FANOUT_COUNT];
+
+/* pushes more children than a deque holds, the rest run inline */
+static void fanout_task(void *parameter)
+{
+    struct rt_workpool_group *group = (struct rt_workpool_group *)parameter;
+    int i;
+
+    for (i = 0; i < FANOUT_COUNT; i++)
+        rt_workpool_submit(pool, group, &fanout_tasks[i], count_task, RT_NULL);
+}
+
+static void test_workpool_overflow(void)
+{
+    struct rt_workpool_group group;
+    struct rt_workpool_task task;
+
+    rt_atomic_store(&counter, 0);
+    rt_workpool_group_init(&group, "tc_grp");
+    rt_workpool_submit(pool, &group, &task, fanout_task, &group);
+    uassert_int_equal(rt_workpool_group_wait(pool, &group, RT_WAITING_FOREVER), RT_EOK);
+    rt_workpool_group_detach(&group);
+
+    uassert_int_equal(rt_atomic_load(&counter), FANOUT_COUNT);
+}
+
+static struct rt_semaphore block_sem;
+
+static void block_task(void *parameter)
+{
+    rt_sem_take(&block_sem, RT_WAITING_FOREVER);
+}
+
+static void test_workpool_timeout(void)
+{
+    struct rt_workpool_group group;
+    struct rt_workpool_task task;
+
+    rt_sem_init(&block_sem, "tc_blk", 0, RT_IPC_FLAG_FIFO);
+    rt_workpool_group_init(&group, "tc_grp");
+    rt_workpool_submit(pool, &group, &task, block_task, RT_NULL);
+
+    /* let a worker pick the task up instead of running it here */
+    rt_thread_mdelay(10);
+    uassert_int_equal(rt_workpool_group_wait(pool, &group, 10), -RT_ETIMEOUT);
+    uassert_int_equal(rt_workpool_group_detach(&group), -RT_EBUSY);
+
+    rt_sem_release(&block_sem);
+    uassert_int_equal(rt_workpool_group_wait(pool, &group, RT_WAITING_FOREVER), RT_EOK);
+    uassert_int_equal(rt_workpool_group_detach(&group), RT_EOK);
+    rt_sem_detach(&block_sem);
+}
+
+static rt_err_t utest_tc_init(void)
+{
+    pool = rt_workpool_create("tc_wp", WORKER_COUNT, THREAD_STACKSIZE, THREAD_PRIORITY, 0);
+    return pool == RT_NULL ? -RT_ENOMEM : RT_EOK;
+}
+
+static rt_err_t utest_tc_cleanup(void)
+{
+    rt_workpool_delete(pool);
+    return RT_EOK;
+}
+
+static void testcase(void)
+{
+    UTEST_UNIT_RUN(test_workpool_submit);
+    UTEST_UNIT_RUN(test_workpool_fork_join);
+    UTEST_UNIT_RUN(test_workpool_overflow);
+    UTEST_UNIT_RUN(test_workpool_timeout);
+}
+UTEST_TC_EXPORT(testcase, "core.workpool", utest_tc_init, utest_tc_cleanup, 10);
@@ -0,0 +1,600 @@
+/*
+ * Copyright (c) 2006-2026, RT-Thread Development Team
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * File      : workpool.c
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-19     proyrb       first implementation, work stealing thread pool
+ */
+
+#include <rthw.h>
+#include <rtthread.h>
+
+#ifdef RT_USING_WORKPOOL
+
+#if !defined(RT_USING_HEAP) || !defined(RT_USING_SEMAPHORE)
+#error "RT_USING_WORKPOOL requires RT_USING_HEAP and RT_USING_SEMAPHORE"
+#endif
+
+#define DBG_TAG           "kernel.workpool"
+#define DBG_LVL           DBG_INFO
+#include <rtdbg.h>
+
+/* capacity of each worker deque, must be a power of two */
+#ifndef RT_WORKPOOL_DEQUE_SIZE
+#define RT_WORKPOOL_DEQUE_SIZE      64
+#endif
+
+#if (RT_WORKPOOL_DEQUE_SIZE & (RT_WORKPOOL_DEQUE_SIZE - 1)) != 0
+#error "RT_WORKPOOL_DEQUE_SIZE must be a power of two"
+#endif
+
+#define DEQUE_MASK          (RT_WORKPOOL_DEQUE_SIZE - 1)
+
+/* a steal lost the race against another thief or the owner */
+#define DEQUE_ABORT         ((struct rt_workpool_task *)1)
+
+/* added to the pending count of a group while a thread sleeps on it */
+#define GROUP_WAITING       ((rt_atomic_t)1 << (sizeof(rt_atomic_t) * 8 - 2))
+
+/* the indices wrap, compare them through their distance */
+#define DEQUE_DIFF(a, b)    ((rt_base_t)((rt_ubase_t)(a) - (rt_ubase_t)(b)))
+
+#ifdef RT_USING_SMP
+/* the cpus a worker can be bound to */
+#if RT_CPUS_NR >= 32
+#define WORKPOOL_CPU_MASK_ALL   0xffffffffu
+#else
+#define WORKPOOL_CPU_MASK_ALL   ((1u << RT_CPUS_NR) - 1)
+#endif
+#endif /* RT_USING_SMP */
+
+/*
+ * Chase-Lev deque, after "Correct and Efficient Work-Stealing for Weak
+ * Memory Models" (Le et al.). All accesses use the sequentially consistent
+ * rt_atomic operations, which also covers the fences of the paper.
+ */
+
+/* owner only */
+static rt_bool_t _deque_push(struct rt_workpool_deque *deque, struct rt_workpool_task *task)
+{
+    rt_atomic_t bottom = rt_atomic_load(&deque->bottom);
+    rt_atomic_t top = rt_atomic_load(&deque->top);
+
+    if (DEQUE_DIFF(bottom, top) >= RT_WORKPOOL_DEQUE_SIZE)
+        return RT_FALSE;
+
+    rt_atomic_store(&deque->buffer[bottom & DEQUE_MASK], (rt_atomic_t)task);
+    rt_atomic_store(&deque->bottom, (rt_atomic_t)((rt_ubase_t)bottom + 1));
+
+    return RT_TRUE;
+}
+
+/* owner only, takes the most recently pushed task */
+static struct rt_workpool_task *_deque_take(struct rt_workpool_deque *deque)
+{
+    struct rt_workpool_task *task = RT_NULL;
+    rt_atomic_t bottom, top;
+
+    bottom = (rt_atomic_t)((rt_ubase_t)rt_atomic_load(&deque->bottom) - 1);
+    rt_atomic_store(&deque->bottom, bottom);
+    top = rt_atomic_load(&deque->top);
+
+    if (DEQUE_DIFF(bottom, top) >= 0)
+    {
+        task = (struct rt_workpool_task *)rt_atomic_load(&deque->buffer[bottom & DEQUE_MASK]);
+        if (bottom == top)
+        {
+            /* the last task, race the thieves for it */
+            if (!rt_atomic_compare_exchange_strong(&deque->top, &top, (rt_atomic_t)((rt_ubase_t)top + 1)))
+                task = RT_NULL;
+            rt_atomic_store(&deque->bottom, (rt_atomic_t)((rt_ubase_t)bottom + 1));
+        }
+    }
+    else
+    {
+        rt_atomic_store(&deque->bottom, (rt_atomic_t)((rt_ubase_t)bottom + 1));
+    }
+
+    return task;
+}
+
+/* any thread, takes the oldest task */
+static struct rt_workpool_task *_deque_steal(struct rt_workpool_deque *deque)
+{
+    struct rt_workpool_task *task;
+    rt_atomic_t top, bottom;
+
+    top = rt_atomic_load(&deque->top);
+    bottom = rt_atomic_load(&deque->bottom);
+    if (DEQUE_DIFF(bottom, top) <= 0)
+        return RT_NULL;
+
+    task = (struct rt_workpool_task *)rt_atomic_load(&deque->buffer[top & DEQUE_MASK]);
+    if (!rt_atomic_compare_exchange_strong(&deque->top, &top, (rt_atomic_t)((rt_ubase_t)top + 1)))
+        return DEQUE_ABORT;
+
+    return task;
+}
+
+static struct rt_workpool_worker *_worker_self(rt_workpool_t pool)
+{
+    rt_thread_t self = rt_thread_self();
+    int index;
+
+    for (index = 0; index < pool->worker_count; index++)
+    {
+        if (pool->workers[index].thread == self)
+            return &pool->workers[index];
+    }
+    return RT_NULL;
+}
+
+static struct rt_workpool_task *_inject_pop(rt_workpool_t pool)
+{
+    struct rt_workpool_task *task = RT_NULL;
+    rt_base_t level;
+
+    if (rt_list_isempty(&pool->inject))
+        return RT_NULL;
+
+    level = rt_spin_lock_irqsave(&pool->spinlock);
+    if (!rt_list_isempty(&pool->inject))
+    {
+        task = rt_list_first_entry(&pool->inject, struct rt_workpool_task, list);
+        rt_list_remove(&task->list);
+    }
+    rt_spin_unlock_irqrestore(&pool->spinlock, level);
+
+    return task;
+}
+
+/*
+ * Look for work: the own deque first, then the tasks submitted from outside
+ * the pool, then the deques of the other workers starting at a random one.
+ * self is RT_NULL when a thread outside the pool helps while it waits.
+ */
+static struct rt_workpool_task *_find_task(rt_workpool_t pool, struct rt_workpool_worker *self)
+{
+    struct rt_workpool_task *task;
+    rt_uint32_t start, index;
+    rt_bool_t retry;
+
+    if (self != RT_NULL)
+    {
+        task = _deque_take(&self->deque);
+        if (task != RT_NULL)
+            return task;
+    }
+
+    task = _inject_pop(pool);
+    if (task != RT_NULL)
+        return task;
+
+    if (self != RT_NULL)
+    {
+        self->seed = self->seed * 1103515245u + 12345u;
+        start = (self->seed >> 16) % pool->worker_count;
+    }
+    else
+    {
+        start = 0;
+    }
+
+    do
+    {
+        retry = RT_FALSE;
+        for (index = 0; index < pool->worker_count; index++)
+        {
+            struct rt_workpool_worker *victim = &pool->workers[(start + index) % pool->worker_count];
+
+            if (victim == self)
+                continue;
+
+            task = _deque_steal(&victim->deque);
+            if (task == DEQUE_ABORT)
+            {
+                retry = RT_TRUE;
+                continue;
+            }
+            if (task != RT_NULL)
+            {
+                if (self != RT_NULL)
+                    self->steal_count++;
+                return task;
+            }
+        }
+    } while (retry);
+
+    return RT_NULL;
+}
+
+static void _task_run(struct rt_workpool_task *task, struct rt_workpool_worker *self)
+{
+    struct rt_workpool_group *group = task->group;
+
+    /* the task may be reused by its function, read everything first */
+    task->func(task->parameter);
+    if (self != RT_NULL)
+        self->exec_count++;
+
+    /* the group may be gone once pending drops to zero unless someone waits on it */
+    if (group != RT_NULL && rt_atomic_sub(&group->pending, 1) == GROUP_WAITING + 1)
+        rt_sem_release(&group->done);
+}
+
+/*
+ * Every sleeping worker registers in idle before its last look for work.
+ * A submitter that sees a registration claims it by decrementing idle and
+ * posts one wake token, so neither the task nor the token gets lost.
+ */
+static void _pool_wake(rt_workpool_t pool)
+{
+    rt_atomic_t idle = rt_atomic_load(&pool->idle);
+
+    while (idle > 0)
+    {
+        if (rt_atomic_compare_exchange_strong(&pool->idle, &idle, idle - 1))
+        {
+            rt_sem_release(&pool->wake);
+            return;
+        }
+    }
+}
+
+static void _worker_sleep(rt_workpool_t pool, struct rt_workpool_worker *self)
+{
+    struct rt_workpool_task *task;
+    rt_atomic_t idle;
+
+    rt_atomic_add(&pool->idle, 1);
+
+    task = _find_task(pool, self);
+    if (task != RT_NULL)
+    {
+        /* withdraw the registration unless a submitter claimed it already */
+        idle = rt_atomic_load(&pool->idle);
+        while (idle > 0)
+        {
+            if (rt_atomic_compare_exchange_strong(&pool->idle, &idle, idle - 1))
+                break;
+        }
+        if (idle == 0)
+            rt_sem_take(&pool->wake, RT_WAITING_FOREVER);
+
+        _task_run(task, self);
+        return;
+    }
+
+    if (!rt_atomic_load(&pool->exiting))
+        rt_sem_take(&pool->wake, RT_WAITING_FOREVER);
+}
+
+static void _worker_entry(void *parameter)
+{
+    struct rt_workpool_worker *self = (struct rt_workpool_worker *)parameter;
+    rt_workpool_t pool = self->pool;
+    struct rt_workpool_task *task;
+
+    while (!rt_atomic_load(&pool->exiting))
+    {
+        task = _find_task(pool, self);
+        if (task != RT_NULL)
+            _task_run(task, self);
+        else
+            _worker_sleep(pool, self);
+    }
+
+    rt_sem_release(&pool->exit);
+}
+
+/**
+ * @brief   This function creates a pool of worker threads.
+ *
+ * @note    On SMP systems the workers are bound round robin to the cpus set in
+ *          cpu_mask, cpus outside RT_CPUS_NR are ignored. A cpu_mask of 0,
+ *          or one with no cpu below RT_CPUS_NR, leaves placement to the
+ *          scheduler. The mask has no effect on a
+ *          single core system.
+ *
+ * @param   name is the name of the pool, workers are named after it.
+ *
+ * @param   worker_count is the number of worker threads.
+ *
+ * @param   stack_size is the stack size of each worker.
+ *
+ * @param   priority is the priority of the workers.
+ *
+ * @param   cpu_mask is the affinity hint of the workers.
+ *
+ * @return  the created pool, or RT_NULL on failure.
+ */
+rt_workpool_t rt_workpool_create(const char *name,
+                                 rt_uint8_t  worker_count,
+                                 rt_uint32_t stack_size,
+                                 rt_uint8_t  priority,
+                                 rt_uint32_t cpu_mask)
+{
+    rt_workpool_t pool;
+    char thread_name[RT_NAME_MAX];
+    int index;
+#ifdef RT_USING_SMP
+    int cpu = -1;
+#endif /* RT_USING_SMP */
+
+    RT_ASSERT(worker_count > 0);
+    RT_DEBUG_NOT_IN_INTERRUPT;
+
+#ifdef RT_USING_SMP
+    /* a mask without any existing cpu leaves placement to the scheduler */
+    cpu_mask &= WORKPOOL_CPU_MASK_ALL;
+#endif /* RT_USING_SMP */
+
+    pool = (rt_workpool_t)rt_malloc(sizeof(struct rt_workpool) +
+                                    worker_count * sizeof(struct rt_workpool_worker));
+    if (pool == RT_NULL)
+        return RT_NULL;
+    rt_memset(pool, 0, sizeof(struct rt_workpool) + worker_count * sizeof(struct rt_workpool_worker));
+
+    rt_strncpy(pool->name, name, RT_NAME_MAX);
+    pool->workers = (struct rt_workpool_worker *)(pool + 1);
+    rt_sem_init(&pool->wake, name, 0, RT_IPC_FLAG_FIFO);
+    rt_sem_init(&pool->exit, name, 0, RT_IPC_FLAG_FIFO);
+    rt_spin_lock_init(&pool->spinlock);
+    rt_list_init(&pool->inject);
+
+    for (index = 0; index < worker_count; index++)
+    {
+        struct rt_workpool_worker *worker = &pool->workers[index];
+
+        worker->pool = pool;
+        worker->seed = (rt_uint32_t)index * 2654435761u + 1;
+        worker->deque.buffer = (rt_atomic_t *)rt_malloc(RT_WORKPOOL_DEQUE_SIZE * sizeof(rt_atomic_t));
+        if (worker->deque.buffer == RT_NULL)
+            goto __fail;
+
+        rt_snprintf(thread_name, sizeof(thread_name), "%.*s%d", RT_NAME_MAX - 4, name, index);
+        worker->thread = rt_thread_create(thread_name, _worker_entry, worker,
+                                          stack_size, priority, 10);
+        if (worker->thread == RT_NULL)
+            goto __fail;
+
+#ifdef RT_USING_SMP
+        if (cpu_mask != 0)
+        {
+            /* next cpu of the mask, wrapping around */
+            do
+            {
+                cpu = (cpu + 1) % RT_CPUS_NR;
+            } while (!(cpu_mask & (1u << cpu)));
+            rt_sched_thread_bind_cpu(worker->thread, cpu);
+        }
+#else
+        RT_UNUSED(cpu_mask);
+#endif /* RT_USING_SMP */
+    }
+    pool->worker_count = worker_count;
+
+    for (index = 0; index < worker_count; index++)
+        rt_thread_startup(pool->workers[index].thread);
+
+    return pool;
+
+__fail:
+    LOG_E("pool %s: no memory for worker %d", name, index);
+    for (index = 0; index < worker_count; index++)
+    {
+        if (pool->workers[index].thread != RT_NULL)
+            rt_thread_delete(pool->workers[index].thread);
+        if (pool->workers[index].deque.buffer != RT_NULL)
+            rt_free(pool->workers[index].deque.buffer);
+    }
+    rt_sem_detach(&pool->wake);
+    rt_sem_detach(&pool->exit);
+    rt_free(pool);
+
+    return RT_NULL;
+}
+RTM_EXPORT(rt_workpool_create);
+
+/**
+ * @brief   This function stops the workers and frees the pool.
+ *
+ * @note    Tasks that are still queued are dropped without running, the
+ *          caller has to join its groups first.
+ *
+ * @param   pool is the pool to delete, it must not be called from a worker.
+ *
+ * @return  RT_EOK on success.
+ */
+rt_err_t rt_workpool_delete(rt_workpool_t pool)
+{
+    int index;
+
+    RT_ASSERT(pool != RT_NULL);
+    RT_ASSERT(_worker_self(pool) == RT_NULL);
+    RT_DEBUG_NOT_IN_INTERRUPT;
+
+    rt_atomic_store(&pool->exiting, 1);
+    for (index = 0; index < pool->worker_count; index++)
+        rt_sem_release(&pool->wake);
+    for (index = 0; index < pool->worker_count; index++)
+        rt_sem_take(&pool->exit, RT_WAITING_FOREVER);
+
+    /* the workers have returned from their entries and will be reclaimed by the idle thread */
+    for (index = 0; index < pool->worker_count; index++)
+        rt_free(pool->workers[index].deque.buffer);
+    rt_sem_detach(&pool->wake);
+    rt_sem_detach(&pool->exit);
+    rt_free(pool);
+
+    return RT_EOK;
+}
+RTM_EXPORT(rt_workpool_delete);
+
+/**
+ * @brief   This function queues a task on the pool.
+ *
+ * @note    A worker pushes onto its own deque so nested fork/join stays local,
+ *          other threads queue on the shared injection list. When the deque
+ *          of the worker is full the task runs at once on the caller.
+ *
+ * @param   pool is the target pool.
+ *
+ * @param   group is the group the task belongs to, may be RT_NULL.
+ *
+ * @param   task is the task storage, it must stay valid until the task has run.
+ *
+ * @param   func is the task function.
+ *
+ * @param   parameter is passed to func.
+ *
+ * @return  RT_EOK on success.
+ */
+rt_err_t rt_workpool_submit(rt_workpool_t pool,
+                            struct rt_workpool_group *group,
+                            struct rt_workpool_task *task,
+                            void (*func)(void *parameter),
+                            void *parameter)
+{
+    struct rt_workpool_worker *self;
+    rt_base_t level;
+
+    RT_ASSERT(pool != RT_NULL);
+    RT_ASSERT(task != RT_NULL);
+    RT_ASSERT(func != RT_NULL);
+
+    task->func = func;
+    task->parameter = parameter;
+    task->group = group;
+    if (group != RT_NULL)
+        rt_atomic_add(&group->pending, 1);
+
+    self = _worker_self(pool);
+    if (self != RT_NULL)
+    {
+        if (!_deque_push(&self->deque, task))
+        {
+            _task_run(task, self);
+            return RT_EOK;
+        }
+    }
+    else
+    {
+        level = rt_spin_lock_irqsave(&pool->spinlock);
+        rt_list_insert_before(&pool->inject, &task->list);
+        rt_spin_unlock_irqrestore(&pool->spinlock, level);
+    }
+
+    _pool_wake(pool);
+
+    return RT_EOK;
+}
+RTM_EXPORT(rt_workpool_submit);
+
+/**
+ * @brief   This function initializes a task group.
+ *
+ * @param   group is the group to initialize.
+ *
+ * @param   name is the name of the semaphore the joining thread sleeps on.
+ *
+ * @return  RT_EOK on success.
+ */
+rt_err_t rt_workpool_group_init(struct rt_workpool_group *group, const char *name)
+{
+    RT_ASSERT(group != RT_NULL);
+
+    rt_atomic_store(&group->pending, 0);
+
+    return rt_sem_init(&group->done, name, 0, RT_IPC_FLAG_FIFO);
+}
+RTM_EXPORT(rt_workpool_group_init);
+
+/**
+ * @brief   This function detaches a task group with no pending tasks.
+ *
+ * @param   group is the group to detach.
+ *
+ * @return  RT_EOK on success, -RT_EBUSY if tasks are still pending.
+ */
+rt_err_t rt_workpool_group_detach(struct rt_workpool_group *group)
+{
+    RT_ASSERT(group != RT_NULL);
+
+    if (rt_atomic_load(&group->pending) != 0)
+        return -RT_EBUSY;
+
+    return rt_sem_detach(&group->done);
+}
+RTM_EXPORT(rt_workpool_group_detach);
+
+/**
+ * @brief   This function waits until all tasks of a group have finished.
+ *
+ * @note    While tasks of the pool are queued the caller runs them itself, so
+ *          a worker can fork and join recursively without starving the pool.
+ *          The timeout only applies once there is nothing left to help with.
+ *
+ * @param   pool is the pool the tasks were submitted to.
+ *
+ * @param   group is the group to join.
+ *
+ * @param   timeout is the timeout in ticks, or RT_WAITING_FOREVER.
+ *
+ * @return  RT_EOK when the group is done, -RT_ETIMEOUT on timeout.
+ */
+rt_err_t rt_workpool_group_wait(rt_workpool_t pool, struct rt_workpool_group *group, rt_int32_t timeout)
+{
+    struct rt_workpool_worker *self;
+    struct rt_workpool_task *task;
+    rt_atomic_t pending;
+    rt_err_t result;
+
+    RT_ASSERT(pool != RT_NULL);
+    RT_ASSERT(group != RT_NULL);
+    RT_DEBUG_NOT_IN_INTERRUPT;
+
+    self = _worker_self(pool);
+    while (rt_atomic_load(&group->pending) != 0)
+    {
+        task = _find_task(pool, self);
+        if (task == RT_NULL)
+            break;
+        _task_run(task, self);
+    }
+
+    if (rt_atomic_load(&group->pending) == 0)
+        return RT_EOK;
+
+    if (rt_atomic_add(&group->pending, GROUP_WAITING) == 0)
+    {
+        /* the last task finished in between */
+        rt_atomic_sub(&group->pending, GROUP_WAITING);
+        return RT_EOK;
+    }
+
+    result = rt_sem_take(&group->done, timeout);
+    if (result != RT_EOK)
+    {
+        pending = rt_atomic_load(&group->pending);
+        while (pending != GROUP_WAITING)
+        {
+            if (rt_atomic_compare_exchange_strong(&group->pending, &pending, pending - GROUP_WAITING))
+                return result;
+        }
+        /* the last task finished right after the timeout, consume its post */
+        result = rt_sem_take(&group->done, RT_WAITING_FOREVER);
+    }
+    rt_atomic_sub(&group->pending, GROUP_WAITING);
+
+    return result;
+}
+RTM_EXPORT(rt_workpool_group_wait);
+
+#endif /* RT_USING_WORKPOOL */
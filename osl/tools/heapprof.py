@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2006-2026, RT-Thread Development Team
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Change Logs:
+# Date           Author       Notes
+# 2026-10-19     proyrb       first version
+#
+# Render the output of `heapprof dump` captured from the console.
+#
+#   heapprof.py log.txt --elf app.elf --folded live > heap.folded
+#   flamegraph.pl heap.folded > heap.svg
+#   heapprof.py log.txt --elf app.elf --top 20
+#
+
+import argparse
+import subprocess
+import sys
+
+METRICS = {"live": 0, "count": 1, "bytes": 2}
+
+
+def parse(lines):
+    header = {}
+    sites = []
+    for line in lines:
+        line = line.strip()
+        if line.startswith("# heapprof"):
+            for item in line.split()[2:]:
+                key, _, value = item.partition("=")
+                header[key] = int(value)
+            sites = []
+            continue
+        fields = line.rsplit(" ", 3)
+        if len(fields) != 4 or not header:
+            continue
+        try:
+            values = [int(v) for v in fields[1:]]
+        except ValueError:
+            continue
+        sites.append((fields[0].split(";"), values))
+    return header, sites
+
+
+def resolve(elf, sites):
+    addrs = sorted({f for stack, _ in sites for f in stack if f.startswith("0x")})
+    if not elf or not addrs:
+        return {}
+    out = subprocess.run(["arm-none-eabi-addr2line", "-f", "-s", "-e", elf] + addrs,
+                         capture_output=True, text=True, check=True).stdout.splitlines()
+    names = {}
+    for index, addr in enumerate(addrs):
+        func, loc = out[2 * index], out[2 * index + 1]
+        names[addr] = func if func != "??" else addr
+        if loc and not loc.startswith("??"):
+            names[addr] += "(" + loc + ")"
+    return names
+
+
+def main():
+    parser = argparse.ArgumentParser(description="render heapprof dumps")
+    parser.add_argument("log", nargs="?", type=argparse.FileType("r"), default=sys.stdin)
+    parser.add_argument("--elf", help="image used to resolve return addresses")
+    parser.add_argument("--folded", choices=METRICS.keys(),
+                        help="print folded stacks weighted by the metric")
+    parser.add_argument("--top", type=int, default=10, help="rows of the table")
+    args = parser.parse_args()
+
+    header, sites = parse(args.log)
+    if not header:
+        sys.exit("no heapprof dump found")
+    names = resolve(args.elf, sites)
+    seconds = header.get("ticks", 0) / float(header.get("hz", 1)) or 1.0
+
+    if args.folded:
+        for stack, values in sites:
+            weight = values[METRICS[args.folded]]
+            if weight:
+                print(";".join(names.get(f, f) for f in stack), weight)
+        return
+
+    print("%10s %8s %10s %12s  %s" % ("live", "allocs", "bytes", "bytes/s", "site"))
+    for stack, (live, count, total) in sorted(sites, key=lambda s: -s[1][0])[:args.top]:
+        print("%10d %8d %10d %12.1f  %s" % (live, count, total, total / seconds,
+                                          " <- ".join(names.get(f, f) for f in reversed(stack))))
+    if header.get("untracked"):
+        print("%d blocks were not tracked, raise RT_HEAPPROF_LIVE_MAX" % header["untracked"])
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,189 @@
+/**
+ * @file bench_common.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "bench_common.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint8_t draw_buf[BENCH_HOR_RES * BENCH_BUF_ROWS * BENCH_PX_SIZE];
+static uint16_t frame_ref[BENCH_VER_RES][BENCH_HOR_RES];
+
+static lv_obj_t * main_cont;
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+uint16_t bench_frame_buf[BENCH_VER_RES][BENCH_HOR_RES];
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/*`LV_LOG_PRINT_CB` of lv_conf.h*/
+void print(lv_log_level_t level, const char * buf)
+{
+    if(level >= LV_LOG_LEVEL_WARN) fputs(buf, stderr);
+}
+
+lv_display_t * bench_display_create(lv_display_flush_cb_t flush_cb)
+{
+    lv_display_t * disp = lv_display_create(BENCH_HOR_RES, BENCH_VER_RES);
+    lv_display_set_flush_cb(disp, flush_cb);
+    lv_display_set_buffers(disp, draw_buf, NULL, sizeof(draw_buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+    return disp;
+}
+
+void bench_ui_load(lv_display_t * disp)
+{
+    ui_init();
+    lv_screen_load(ui_entry_screen);
+    main_cont = lv_obj_get_child(ui_entry_screen, 0);
+    lv_refr_now(disp);
+}
+
+lv_obj_t * bench_get_main_cont(void)
+{
+    return main_cont;
+}
+
+void bench_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+    bench_frame_copy(area, px_map);
+    lv_display_flush_ready(disp);
+}
+
+void bench_flush_discard_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+    LV_UNUSED(area);
+    LV_UNUSED(px_map);
+    lv_display_flush_ready(disp);
+}
+
+void bench_frame_copy(const lv_area_t * area, const uint8_t * px_map)
+{
+    int32_t w = lv_area_get_width(area);
+    int32_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        memcpy(&bench_frame_buf[y][area->x1], px_map, w * BENCH_PX_SIZE);
+        px_map += w * BENCH_PX_SIZE;
+    }
+}
+
+void bench_frame_keep(void)
+{
+    memcpy(frame_ref, bench_frame_buf, sizeof(frame_ref));
+}
+
+uint32_t bench_frame_diff(uint32_t * diff_max)
+{
+    uint32_t cnt = 0;
+    uint32_t y, x;
+    for(y = 0; y < BENCH_VER_RES; y++) {
+        for(x = 0; x < BENCH_HOR_RES; x++) {
+            uint16_t a = bench_frame_buf[y][x];
+            uint16_t b = frame_ref[y][x];
+            if(a == b) continue;
+
+            cnt++;
+            if(diff_max == NULL) continue;
+
+            int32_t d[3] = {(a >> 11) - (b >> 11), ((a >> 5) & 0x3F) - ((b >> 5) & 0x3F), (a & 0x1F) - (b & 0x1F)};
+            uint32_t i;
+            for(i = 0; i < 3; i++) {
+                uint32_t d_abs = LV_ABS(d[i]);
+                if(d_abs > *diff_max) *diff_max = d_abs;
+            }
+        }
+    }
+    return cnt;
+}
+
+uint32_t bench_frame_checksum(void)
+{
+    const uint8_t * p = (const uint8_t *)bench_frame_buf;
+    uint32_t hash = 2166136261u;
+    uint32_t i;
+    for(i = 0; i < sizeof(bench_frame_buf); i++) {
+        hash ^= p[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+void bench_refresh(lv_display_t * disp, bench_update_cb_t update_cb, uint32_t frames)
+{
+    uint32_t f;
+    for(f = 0; f < frames; f++) {
+        update_cb();
+        lv_refr_now(disp);
+    }
+}
+
+double bench_refresh_ms(lv_display_t * disp, bench_update_cb_t update_cb, uint32_t frames)
+{
+    uint64_t start = bench_now_ns();
+    bench_refresh(disp, update_cb, frames);
+    return (bench_now_ns() - start) / 1e6 / frames;
+}
+
+void bench_update_redraw(void)
+{
+    lv_obj_invalidate(main_cont);
+}
+
+void bench_update_charts(void)
+{
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_count(main_cont); i++) {
+        lv_obj_t * child = lv_obj_get_child(main_cont, i);
+        if(!lv_obj_check_type(child, &lv_chart_class)) continue;
+
+        lv_chart_series_t * ser = lv_chart_get_series_next(child, NULL);
+        if(ser) lv_chart_set_next_value(child, ser, (int32_t)lv_rand(40, 60));
+    }
+
+    lv_obj_invalidate(main_cont);
+}
+
+void bench_update_timer(void)
+{
+    update_chart_timer_cb(NULL);
+}
+
+void bench_update_screen(void)
+{
+    lv_obj_invalidate(lv_screen_active());
+}
+
+uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
@@ -0,0 +1,171 @@
+/**
+ * @file bench_common.h
+ *
+ * The fixture shared by the host benchmarks of svl/bench.
+ *
+ * The display matches the target: 1280x800 RGB565 rendered in partial mode
+ * into a 128 row buffer. The scenarios update the entry screen of svl/gui
+ * like the app does.
+ *
+ * Every benchmark is built the same way, only its options and linker flags
+ * differ. They are given at the top of each one as arguments of `bench`:
+ *
+ *   bench() {
+ *     cc -O2 $2 -DLV_CONF_INCLUDE_SIMPLE -Imdl/lvgl -Isvl/gui svl/bench/$1.c \
+ *        svl/bench/bench_common.c $(find svl/gui mdl/lvgl/src -name '*.c') \
+ *        $3 -lpthread -lm -o $1 && ./$1
+ *   }
+ */
+
+#ifndef BENCH_COMMON_H
+#define BENCH_COMMON_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lvgl.h"
+#include "ui.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define BENCH_HOR_RES       1280
+#define BENCH_VER_RES       800
+#define BENCH_BUF_ROWS      128
+#define BENCH_PX_SIZE       2
+
+/*Frames drawn before the timed ones to fill the caches*/
+#define BENCH_WARM_UP_FRAMES    5
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*Changes the screen before a frame is drawn*/
+typedef void (*bench_update_cb_t)(void);
+
+typedef struct {
+    const char * name;
+    bench_update_cb_t update_cb;
+} bench_scenario_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/*Created by ui_init(), not exported by the generated headers*/
+extern lv_obj_t * ui_entry_screen;
+
+/*The last frame flushed by `bench_flush_cb()` or `bench_frame_copy()`*/
+extern uint16_t bench_frame_buf[BENCH_VER_RES][BENCH_HOR_RES];
+
+/**
+ * Create the display of the target with a partial draw buffer
+ * @param flush_cb  the flush callback, e.g. `bench_flush_cb`
+ * @return          the new display
+ */
+lv_display_t * bench_display_create(lv_display_flush_cb_t flush_cb);
+
+/**
+ * Create the UI, load the entry screen and draw it once
+ * @param disp      the display of `bench_display_create()`
+ */
+void bench_ui_load(lv_display_t * disp);
+
+/**
+ * Get the container of the entry screen which the app invalidates
+ * @return          the main container, NULL before `bench_ui_load()`
+ */
+lv_obj_t * bench_get_main_cont(void);
+
+/**
+ * Copy the flushed pixels to the frame buffer and tell the display they are flushed
+ */
+void bench_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
+
+/**
+ * Only tell the display the pixels are flushed, when the frame doesn't matter
+ */
+void bench_flush_discard_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
+
+/**
+ * Copy flushed pixels to the frame buffer, for flush callbacks of their own
+ * @param area      the flushed area
+ * @param px_map    the RGB565 pixels of the area
+ */
+void bench_frame_copy(const lv_area_t * area, const uint8_t * px_map);
+
+/**
+ * Keep the frame buffer as the reference of `bench_frame_diff()`
+ */
+void bench_frame_keep(void);
+
+/**
+ * Compare the frame buffer with the kept reference frame
+ * @param diff_max  store the largest difference of a color channel, can be NULL
+ * @return          number of pixels which differ
+ */
+uint32_t bench_frame_diff(uint32_t * diff_max);
+
+/**
+ * FNV-1a of the frame buffer, tells if two builds draw the same
+ * @return          the checksum
+ */
+uint32_t bench_frame_checksum(void);
+
+/**
+ * Update the screen and draw it, frame by frame
+ * @param disp      the display to draw
+ * @param update_cb called before each frame
+ * @param frames    number of frames
+ */
+void bench_refresh(lv_display_t * disp, bench_update_cb_t update_cb, uint32_t frames);
+
+/**
+ * Time `bench_refresh()`
+ * @param disp      the display to draw
+ * @param update_cb called before each frame
+ * @param frames    number of frames
+ * @return          the time of a frame in ms
+ */
+double bench_refresh_ms(lv_display_t * disp, bench_update_cb_t update_cb, uint32_t frames);
+
+/**
+ * The app invalidates the main container, nothing changed
+ */
+void bench_update_redraw(void);
+
+/**
+ * New chart points, then the main container is invalidated like by the app
+ */
+void bench_update_charts(void);
+
+/**
+ * The timer of the app: new chart points and new statistics in the sidebar
+ */
+void bench_update_timer(void);
+
+/**
+ * Invalidate the whole active screen
+ */
+void bench_update_screen(void);
+
+/**
+ * Get a monotonic time
+ * @return          the time in ns
+ */
+uint64_t bench_now_ns(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*BENCH_COMMON_H*/
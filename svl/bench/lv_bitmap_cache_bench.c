@@ -0,0 +1,136 @@
+/**
+ * @file lv_bitmap_cache_bench.c
+ *
+ * Host benchmark of drawing the static parts of the entry screen from cached
+ * bitmaps (`LV_OBJ_FLAG_CACHE_BITMAP`).
+ *
+ * Every child of the main container except the charts is flagged: the sidebar
+ * with the channel statistics, the title and the chart labels. Each scenario
+ * is run with the cache disabled and enabled. After each run with the cache
+ * the screen is drawn once more without it: the two frames are compared pixel
+ * by pixel, also telling the largest difference of a color channel.
+ *
+ *   bench lv_bitmap_cache_bench "-DLV_OBJ_BITMAP_CACHE_SIZE=0x400000 -DLV_DRAW_SW_SUPPORT_ARGB8888=1 \
+ *         -DLV_MEM_SIZE=0x1000000"
+ *
+ * Usage: lv_bitmap_cache_bench [frames]
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "lvgl.h"
+#include "lvgl_private.h"
+#include "bench_common.h"
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void run(lv_display_t * disp, const bench_scenario_t * scenario, uint32_t frames, bool cache);
+static uint32_t compare(lv_display_t * disp, uint32_t * diff_max);
+static void update_sidebar(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const bench_scenario_t scenarios[] = {
+    {"sidebar", update_sidebar},
+    {"redraw", bench_update_redraw},
+    {"charts", bench_update_charts},
+    {"timer", bench_update_timer},
+};
+
+static lv_obj_t * sidebar;
+static uint32_t cache_size;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(int argc, char ** argv)
+{
+    uint32_t frames = argc > 1 ? (uint32_t)atoi(argv[1]) : 100;
+
+    lv_init();
+
+    lv_display_t * disp = bench_display_create(bench_flush_cb);
+    bench_ui_load(disp);
+
+    /*Cache everything which is not redrawn in every update*/
+    lv_obj_t * main_cont = bench_get_main_cont();
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_count(main_cont); i++) {
+        lv_obj_t * child = lv_obj_get_child(main_cont, i);
+        if(!lv_obj_check_type(child, &lv_chart_class)) lv_obj_add_flag(child, LV_OBJ_FLAG_CACHE_BITMAP);
+        if(sidebar == NULL && lv_obj_get_child_count(child) > 0) sidebar = child;
+    }
+
+    lv_obj_bitmap_cache_stats_t stats;
+    lv_obj_bitmap_cache_get_stats(&stats);
+    cache_size = stats.max_size;
+    if(cache_size == 0) {
+        fprintf(stderr, "build with LV_OBJ_BITMAP_CACHE_SIZE > 0\n");
+        return 1;
+    }
+
+    printf("frames: %u, cache: %u bytes\n", frames, cache_size);
+    printf("%-8s %6s %10s %8s %8s %9s %8s %8s\n", "scenario", "cache", "ms/frame", "hit", "miss", "kbytes",
+           "diff px", "diff max");
+
+    uint32_t s;
+    for(s = 0; s < sizeof(scenarios) / sizeof(scenarios[0]); s++) {
+        run(disp, &scenarios[s], frames, false);
+        run(disp, &scenarios[s], frames, true);
+    }
+
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void run(lv_display_t * disp, const bench_scenario_t * scenario, uint32_t frames, bool cache)
+{
+    lv_obj_bitmap_cache_resize(cache ? cache_size : 0, true);
+
+    /*Also fills the cache*/
+    bench_refresh(disp, scenario->update_cb, BENCH_WARM_UP_FRAMES);
+    lv_obj_bitmap_cache_reset_stats();
+
+    double ms = bench_refresh_ms(disp, scenario->update_cb, frames);
+
+    lv_obj_bitmap_cache_stats_t stats;
+    lv_obj_bitmap_cache_get_stats(&stats);
+
+    uint32_t diff_cnt = 0;
+    uint32_t diff_max = 0;
+    if(cache) diff_cnt = compare(disp, &diff_max);
+
+    printf("%-8s %6s %10.3f %8u %8u %9u %8u %8u\n", scenario->name, cache ? "on" : "off", ms,
+           stats.hit_cnt, stats.miss_cnt, stats.size / 1024, diff_cnt, diff_max);
+}
+
+/*Draw the last frame again without the cache and compare it with the one drawn with the cache*/
+static uint32_t compare(lv_display_t * disp, uint32_t * diff_max)
+{
+    lv_obj_invalidate(ui_entry_screen);
+    lv_refr_now(disp);
+    bench_frame_keep();
+
+    lv_obj_bitmap_cache_resize(0, true);
+    lv_obj_invalidate(ui_entry_screen);
+    lv_refr_now(disp);
+
+    return bench_frame_diff(diff_max);
+}
+
+/*Only the sidebar is redrawn, nothing changed, e.g. a popup above it closed.
+ *Invalidating the sidebar itself would mean it has changed.*/
+static void update_sidebar(void)
+{
+    lv_inv_area(lv_obj_get_display(sidebar), &sidebar->coords);
+}
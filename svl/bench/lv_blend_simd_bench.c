@@ -0,0 +1,262 @@
+/**
+ * @file lv_blend_simd_bench.c
+ *
+ * Host test and benchmark of the RGB565 blend kernels.
+ *
+ * Every fill and RGB565 image kernel the software renderer can pick is run
+ * through `lv_draw_sw_blend_color_to_rgb565()` and
+ * `lv_draw_sw_blend_image_to_rgb565()` on many widths, alignments, strides,
+ * opacities and masks, and has to match a per-pixel `lv_color_16_16_mix()`
+ * bit by bit. Then each kernel is timed on a 1280x128 draw buffer against
+ * that per-pixel loop.
+ *
+ * The backend is chosen at build time, build once with the plain C blend
+ * and once per instruction set:
+ *
+ *   for f in "-DLV_USE_DRAW_SW_ASM=0" "-DLV_USE_DRAW_SW_ASM=3" "-DLV_USE_DRAW_SW_ASM=3 -mavx2"; do
+ *     bench lv_blend_simd_bench "$f"
+ *   done
+ *
+ * Usage: lv_blend_simd_bench [rounds]
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "lvgl.h"
+#include "lvgl_private.h"
+#include "src/draw/sw/blend/lv_draw_sw_blend_to_rgb565.h"
+#include "src/draw/sw/blend/simd/lv_blend_simd.h"
+#include "bench_common.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/*A band of the draw buffer*/
+#define BENCH_W             BENCH_HOR_RES
+#define BENCH_H             BENCH_BUF_ROWS
+/*Room for misaligned starts and padded strides*/
+#define BENCH_PAD           8
+#define BENCH_BUF_PX        ((BENCH_W + BENCH_PAD) * BENCH_H)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef enum {
+    MASK_NONE,
+    MASK_RANDOM,    /*Every value, e.g. a gradient or a shadow*/
+    MASK_GLYPH,     /*Mostly empty or covered with short edges, like text*/
+} mask_type_t;
+
+typedef struct {
+    const char * name;
+    bool image;
+    bool opa;
+    mask_type_t mask;
+} kernel_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void blend(const kernel_t * k, uint16_t * dest, int32_t w, int32_t h, int32_t dest_stride,
+                  const uint16_t * src, int32_t src_stride, const lv_opa_t * mask, int32_t mask_stride,
+                  uint16_t color, lv_opa_t opa);
+static void blend_ref(const kernel_t * k, uint16_t * dest, int32_t w, int32_t h, int32_t dest_stride,
+                      const uint16_t * src, int32_t src_stride, const lv_opa_t * mask, int32_t mask_stride,
+                      uint16_t color, lv_opa_t opa);
+static bool check(const kernel_t * k);
+static double mpx_per_s(const kernel_t * k, bool ref, uint32_t rounds);
+static void fill_mask(lv_opa_t * mask, uint32_t cnt, mask_type_t type);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const kernel_t kernels[] = {
+    {"fill",                false, false, MASK_NONE},
+    {"fill opa",            false, true,  MASK_NONE},
+    {"fill mask",           false, false, MASK_RANDOM},
+    {"fill glyph",          false, false, MASK_GLYPH},
+    {"fill mask opa",       false, true,  MASK_RANDOM},
+    {"fill glyph opa",      false, true,  MASK_GLYPH},
+    {"image",               true,  false, MASK_NONE},
+    {"image opa",           true,  true,  MASK_NONE},
+    {"image mask",          true,  false, MASK_RANDOM},
+    {"image mask opa",      true,  true,  MASK_RANDOM},
+};
+
+static uint16_t dest_buf[BENCH_BUF_PX];
+static uint16_t ref_buf[BENCH_BUF_PX];
+static uint16_t src_buf[BENCH_BUF_PX];
+static lv_opa_t mask_buf[BENCH_BUF_PX];
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(int argc, char ** argv)
+{
+    uint32_t rounds = argc > 1 ? (uint32_t)atoi(argv[1]) : 200;
+
+    lv_init();
+    srand(1);
+
+#if LV_BLEND_SIMD_AVX2 && LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_SIMD
+    const char * backend = "AVX2";
+#elif LV_BLEND_SIMD_SSE2 && LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_SIMD
+    const char * backend = "SSE2";
+#elif LV_BLEND_SIMD_DSP && LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_SIMD
+    const char * backend = "DSP";
+#else
+    const char * backend = "C";
+#endif
+
+    printf("blend: %s, %dx%d px, %u rounds\n", backend, BENCH_W, BENCH_H, rounds);
+    printf("%-16s %6s %14s %14s %8s\n", "kernel", "same", "Mpx/s (ref)", "Mpx/s (blend)", "speedup");
+
+    bool ok = true;
+    uint32_t i;
+    for(i = 0; i < sizeof(kernels) / sizeof(kernels[0]); i++) {
+        const kernel_t * k = &kernels[i];
+        bool same = check(k);
+        double ref = mpx_per_s(k, true, rounds);
+        double res = mpx_per_s(k, false, rounds);
+        printf("%-16s %6s %14.1f %14.1f %7.2fx\n", k->name, same ? "yes" : "NO", ref, res, res / ref);
+        if(!same) ok = false;
+    }
+
+    return ok ? 0 : 1;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/*Go through the blend entry of the renderer, it picks the kernel by the mask and the opacity*/
+static void blend(const kernel_t * k, uint16_t * dest, int32_t w, int32_t h, int32_t dest_stride,
+                  const uint16_t * src, int32_t src_stride, const lv_opa_t * mask, int32_t mask_stride,
+                  uint16_t color, lv_opa_t opa)
+{
+    if(k->image) {
+        lv_draw_sw_blend_image_dsc_t dsc = {
+            .dest_buf = dest, .dest_w = w, .dest_h = h, .dest_stride = dest_stride * 2,
+            .mask_buf = mask, .mask_stride = mask_stride,
+            .src_buf = src, .src_stride = src_stride * 2, .src_color_format = LV_COLOR_FORMAT_RGB565,
+            .opa = opa, .blend_mode = LV_BLEND_MODE_NORMAL,
+        };
+        lv_draw_sw_blend_image_to_rgb565(&dsc);
+    }
+    else {
+        lv_draw_sw_blend_fill_dsc_t dsc = {
+            .dest_buf = dest, .dest_w = w, .dest_h = h, .dest_stride = dest_stride * 2,
+            .mask_buf = mask, .mask_stride = mask_stride,
+            /*Exactly `color` again after `lv_color_to_u16()`*/
+            .color = lv_color_make((color >> 11) << 3, ((color >> 5) & 0x3F) << 2, (color & 0x1F) << 3),
+            .opa = opa,
+        };
+        lv_draw_sw_blend_color_to_rgb565(&dsc);
+    }
+}
+
+static void blend_ref(const kernel_t * k, uint16_t * dest, int32_t w, int32_t h, int32_t dest_stride,
+                      const uint16_t * src, int32_t src_stride, const lv_opa_t * mask, int32_t mask_stride,
+                      uint16_t color, lv_opa_t opa)
+{
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w; x++) {
+            uint16_t fg = k->image ? src[x] : color;
+            lv_opa_t mix = mask ? (opa >= LV_OPA_MAX ? mask[x] : LV_OPA_MIX2(mask[x], opa)) : opa;
+            dest[x] = lv_color_16_16_mix(fg, dest[x], mix);
+        }
+        dest += dest_stride;
+        if(src) src += src_stride;
+        if(mask) mask += mask_stride;
+    }
+}
+
+/*Compare with the reference on every width up to 70 at every alignment, with padded strides and many opacities*/
+static bool check(const kernel_t * k)
+{
+    int32_t w;
+    for(w = 1; w <= 70; w++) {
+        int32_t h = 1 + w % 3;
+        int32_t dest_stride = w + w % 5;
+        int32_t src_stride = w + w % 3;
+        int32_t mask_stride = w + w % 7;
+        int32_t ofs;
+        for(ofs = 0; ofs < 4; ofs++) {
+            uint32_t t;
+            for(t = 0; t < 16; t++) {
+                lv_opa_t opa = k->opa ? (lv_opa_t)(t * 17 % LV_OPA_MAX) : LV_OPA_COVER;
+                uint16_t color = (uint16_t)rand();
+                uint32_t i;
+                for(i = 0; i < (uint32_t)(dest_stride * h + BENCH_PAD); i++) {
+                    dest_buf[i] = ref_buf[i] = (uint16_t)rand();
+                    src_buf[i] = (uint16_t)rand();
+                }
+                fill_mask(mask_buf, mask_stride * h + BENCH_PAD, k->mask);
+
+                /*Different offsets misalign the destination, the source and the mask against each other*/
+                const uint16_t * src = k->image ? &src_buf[(ofs + 1) % 4] : NULL;
+                const lv_opa_t * mask = k->mask != MASK_NONE ? &mask_buf[(ofs + 2) % 4] : NULL;
+                blend(k, &dest_buf[ofs], w, h, dest_stride, src, src_stride, mask, mask_stride, color, opa);
+                blend_ref(k, &ref_buf[ofs], w, h, dest_stride, src, src_stride, mask, mask_stride, color, opa);
+
+                for(i = 0; i < (uint32_t)(dest_stride * h + BENCH_PAD); i++) {
+                    if(dest_buf[i] != ref_buf[i]) {
+                        printf("%s: w %d, ofs %d, opa %d: px %u is 0x%04x instead of 0x%04x\n",
+                               k->name, w, ofs, opa, i, dest_buf[i], ref_buf[i]);
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+static double mpx_per_s(const kernel_t * k, bool ref, uint32_t rounds)
+{
+    uint32_t i;
+    for(i = 0; i < BENCH_BUF_PX; i++) {
+        dest_buf[i] = (uint16_t)rand();
+        src_buf[i] = (uint16_t)rand();
+    }
+    fill_mask(mask_buf, BENCH_BUF_PX, k->mask);
+
+    const uint16_t * src = k->image ? src_buf : NULL;
+    const lv_opa_t * mask = k->mask != MASK_NONE ? mask_buf : NULL;
+    lv_opa_t opa = k->opa ? LV_OPA_50 : LV_OPA_COVER;
+
+    uint64_t start = bench_now_ns();
+    for(i = 0; i < rounds; i++) {
+        if(ref) blend_ref(k, dest_buf, BENCH_W, BENCH_H, BENCH_W, src, BENCH_W, mask, BENCH_W, 0x1234, opa);
+        else blend(k, dest_buf, BENCH_W, BENCH_H, BENCH_W, src, BENCH_W, mask, BENCH_W, 0x1234, opa);
+    }
+    double ms = (bench_now_ns() - start) / 1e6;
+
+    return (double)BENCH_W * BENCH_H * rounds / ms / 1e3;
+}
+
+static void fill_mask(lv_opa_t * mask, uint32_t cnt, mask_type_t type)
+{
+    uint32_t i = 0;
+    if(type == MASK_RANDOM) {
+        for(i = 0; i < cnt; i++) mask[i] = (lv_opa_t)rand();
+        return;
+    }
+
+    /*Runs of empty and covered pixels with a few anti-aliased ones between them*/
+    while(i < cnt) {
+        uint32_t run = 1 + rand() % 12;
+        lv_opa_t v = (rand() & 1) ? LV_OPA_COVER : LV_OPA_TRANSP;
+        while(run-- && i < cnt) mask[i++] = v;
+        uint32_t aa = rand() % 3;
+        while(aa-- && i < cnt) mask[i++] = (lv_opa_t)rand();
+    }
+}
@@ -0,0 +1,217 @@
+/**
+ * @file lv_draw_index_bench.c
+ *
+ * Host benchmark of the draw task index on the svl screens.
+ *
+ * The draw tasks of the entry screen are recorded once, then lists of
+ * 100..5000 tasks are replayed from them into a layer. Four simulated draw
+ * units pick the independent tasks the way the software renderer does and
+ * the oldest running one finishes in each round. The task picking is timed
+ * with the layer's task index and with the linear walk over the older tasks
+ * it replaced, and the two dispatch orders have to be identical.
+ *
+ *   bench lv_draw_index_bench "-DLV_USE_OS=LV_OS_PTHREAD -DLV_MEM_SIZE=0x2000000"
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "lvgl.h"
+#include "lvgl_private.h"
+#include "bench_common.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define BENCH_REC_MAX       4096
+#define BENCH_TASK_MAX      5000
+#define BENCH_UNITS         4
+
+/*No real draw unit has this ID so they leave the replayed tasks alone*/
+#define BENCH_UNIT_ID       0xB0
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void record_tree(lv_obj_t * obj);
+static void record_event_cb(lv_event_t * e);
+static uint32_t replay(uint32_t task_cnt, bool linear, uint32_t * order, double * pick_ms);
+static lv_draw_task_t * linear_next_available_task(lv_layer_t * layer, lv_draw_task_t * t_prev);
+static bool linear_is_independent(lv_layer_t * layer, lv_draw_task_t * t_check);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint8_t draw_buf[BENCH_HOR_RES * BENCH_VER_RES * BENCH_PX_SIZE];
+static const uint32_t task_cnts[] = {100, 500, 1000, 2000, 5000};
+
+static lv_area_t rec_areas[BENCH_REC_MAX];
+static uint32_t rec_cnt;
+
+static uint32_t order_index[BENCH_TASK_MAX];
+static uint32_t order_linear[BENCH_TASK_MAX];
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(void)
+{
+    lv_init();
+
+    /*Render the whole screen in one go to record every task once*/
+    lv_display_t * disp = lv_display_create(BENCH_HOR_RES, BENCH_VER_RES);
+    lv_display_set_flush_cb(disp, bench_flush_discard_cb);
+    lv_display_set_buffers(disp, draw_buf, NULL, sizeof(draw_buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+
+    ui_init();
+    lv_screen_load(ui_entry_screen);
+    record_tree(ui_entry_screen);
+    lv_obj_invalidate(ui_entry_screen);
+    lv_refr_now(disp);
+
+    printf("recorded %u draw tasks of the entry screen, %d units\n", rec_cnt, BENCH_UNITS);
+    if(rec_cnt == 0) return 1;
+
+    printf("%6s %12s %12s %8s\n", "tasks", "ms (linear)", "ms (index)", "same");
+
+    uint32_t i;
+    for(i = 0; i < sizeof(task_cnts) / sizeof(task_cnts[0]); i++) {
+        double linear_ms = 0;
+        double index_ms = 0;
+        uint32_t linear_cnt = replay(task_cnts[i], true, order_linear, &linear_ms);
+        uint32_t index_cnt = replay(task_cnts[i], false, order_index, &index_ms);
+
+        bool same = linear_cnt == index_cnt;
+        uint32_t j;
+        for(j = 0; same && j < index_cnt; j++) {
+            if(order_linear[j] != order_index[j]) same = false;
+        }
+
+        printf("%6u %12.3f %12.3f %8s\n", task_cnts[i], linear_ms, index_ms, same ? "yes" : "NO");
+        if(!same) return 1;
+    }
+
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void record_tree(lv_obj_t * obj)
+{
+    lv_obj_add_flag(obj, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+    lv_obj_add_event_cb(obj, record_event_cb, LV_EVENT_DRAW_TASK_ADDED, NULL);
+
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_count(obj); i++) {
+        record_tree(lv_obj_get_child(obj, i));
+    }
+}
+
+static void record_event_cb(lv_event_t * e)
+{
+    lv_draw_task_t * t = lv_event_get_draw_task(e);
+    if(rec_cnt < BENCH_REC_MAX) rec_areas[rec_cnt++] = t->_real_area;
+}
+
+/**
+ * Dispatch a replayed task list
+ * @param task_cnt  number of tasks to add, the recorded ones are repeated
+ * @param linear    true: walk all the older tasks to find the independent ones
+ * @param order     store the tasks in the order they were taken
+ * @param pick_ms   time spent with finding the tasks
+ * @return          number of tasks taken
+ */
+static uint32_t replay(uint32_t task_cnt, bool linear, uint32_t * order, double * pick_ms)
+{
+    lv_area_t screen_area;
+    lv_area_set(&screen_area, 0, 0, BENCH_HOR_RES - 1, BENCH_VER_RES - 1);
+
+    lv_layer_t layer;
+    lv_layer_init(&layer);
+    layer.buf_area = screen_area;
+    layer._clip_area = screen_area;
+    layer.phy_clip_area = screen_area;
+
+    uint32_t i;
+    for(i = 0; i < task_cnt; i++) {
+        lv_draw_task_t * t = lv_draw_add_task(&layer, &rec_areas[i % rec_cnt], LV_DRAW_TASK_TYPE_FILL);
+        t->preferred_draw_unit_id = BENCH_UNIT_ID;
+        ((lv_draw_dsc_base_t *)t->draw_dsc)->id1 = i;
+    }
+
+    lv_draw_task_t * running[BENCH_UNITS];
+    uint32_t running_cnt = 0;
+    uint32_t order_cnt = 0;
+    *pick_ms = 0;
+
+    while(layer.draw_task_head) {
+        /*Let the free units take tasks, starting from the previously taken one*/
+        lv_draw_task_t * t = NULL;
+        while(running_cnt < BENCH_UNITS) {
+            uint64_t start = bench_now_ns();
+            t = linear ? linear_next_available_task(&layer, t) :
+                lv_draw_get_next_available_task(&layer, t, BENCH_UNIT_ID);
+            *pick_ms += (bench_now_ns() - start) / 1e6;
+            if(t == NULL) break;
+
+            t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+            running[running_cnt++] = t;
+            order[order_cnt++] = ((lv_draw_dsc_base_t *)t->draw_dsc)->id1;
+        }
+
+        /*The oldest task is finished*/
+        LV_ASSERT(running_cnt > 0);
+        running[0]->state = LV_DRAW_TASK_STATE_READY;
+        for(i = 1; i < running_cnt; i++) running[i - 1] = running[i];
+        running_cnt--;
+
+        lv_draw_dispatch_layer(NULL, &layer);
+    }
+
+    return order_cnt;
+}
+
+/*`lv_draw_get_next_available_task()` without the task index*/
+static lv_draw_task_t * linear_next_available_task(lv_layer_t * layer, lv_draw_task_t * t_prev)
+{
+    if(layer->draw_task_head) {
+        lv_draw_task_t * t = layer->draw_task_head;
+        if(t->state != LV_DRAW_TASK_STATE_QUEUED &&
+           t->area.x1 <= 0 && t->area.x2 >= BENCH_HOR_RES - 1 &&
+           t->area.y1 <= 0 && t->area.y2 >= BENCH_VER_RES - 1) {
+            return NULL;
+        }
+    }
+
+    lv_draw_task_t * t = t_prev ? t_prev->next : layer->draw_task_head;
+    while(t) {
+        if(t->state == LV_DRAW_TASK_STATE_QUEUED &&
+           (t->preferred_draw_unit_id == LV_DRAW_UNIT_NONE || t->preferred_draw_unit_id == BENCH_UNIT_ID) &&
+           linear_is_independent(layer, t)) {
+            return t;
+        }
+        t = t->next;
+    }
+
+    return NULL;
+}
+
+static bool linear_is_independent(lv_layer_t * layer, lv_draw_task_t * t_check)
+{
+    lv_draw_task_t * t = layer->draw_task_head;
+    while(t && t != t_check) {
+        if(t->state != LV_DRAW_TASK_STATE_READY) {
+            lv_area_t a;
+            if(lv_area_intersect(&a, &t->_real_area, &t_check->_real_area)) return false;
+        }
+        t = t->next;
+    }
+
+    return true;
+}
@@ -0,0 +1,164 @@
+/**
+ * @file lv_draw_task_pool_bench.c
+ *
+ * Host benchmark of cutting the draw tasks from chunks
+ * (`LV_DRAW_TASK_POOL_CHUNK_SIZE`) instead of allocating each from the heap.
+ *
+ * Each scenario counts per frame the CPU time, the calls of LVGL's heap and
+ * the time spent in them, with the 64 kB heap of the target. The heap is
+ * wrapped with the linker to count and time it. After the timed frames some
+ * more are drawn while the heap is inspected at every flush, when the draw
+ * tasks of a band are allocated: the largest fragmentation and the smallest
+ * biggest free block tell how much the tasks fragment the heap. A checksum of
+ * the last frame of each scenario tells if the builds draw the same.
+ *
+ * The chunk size is configured at build time, build once without and once
+ * with chunks. With `LV_OS_PTHREAD` the tasks are drawn on a thread, so more
+ * of them are alive at the same time, like on the target. They don't fit into
+ * 64 kB on the host even without chunks, so give them a larger heap:
+ *
+ *   for os in "LV_OS_NONE" "LV_OS_PTHREAD -DLV_MEM_SIZE=0x100000"; do
+ *     for n in 0 2048; do
+ *       bench lv_draw_task_pool_bench "-DLV_USE_OS=$os -DLV_DRAW_TASK_POOL_CHUNK_SIZE=$n" \
+ *             "-Wl,--wrap=lv_malloc_core,--wrap=lv_realloc_core,--wrap=lv_free_core"
+ *     done
+ *   done
+ *
+ * Usage: lv_draw_task_pool_bench [frames]
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "lvgl.h"
+#include "lvgl_private.h"
+#include "bench_common.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define BENCH_MEM_FRAMES    20
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void run(lv_display_t * disp, const bench_scenario_t * scenario, uint32_t frames);
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
+
+void * __real_lv_malloc_core(size_t size);
+void * __real_lv_realloc_core(void * p, size_t new_size);
+void __real_lv_free_core(void * p);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const bench_scenario_t scenarios[] = {
+    {"redraw", bench_update_redraw},
+    {"timer", bench_update_timer},
+};
+
+static uint64_t heap_cnt;
+static uint64_t heap_ns;
+static bool mem_check;
+static uint32_t frag_max;
+static uint32_t biggest_min;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void * __wrap_lv_malloc_core(size_t size)
+{
+    uint64_t start = bench_now_ns();
+    void * p = __real_lv_malloc_core(size);
+    heap_ns += bench_now_ns() - start;
+    heap_cnt++;
+    return p;
+}
+
+void * __wrap_lv_realloc_core(void * p, size_t new_size)
+{
+    uint64_t start = bench_now_ns();
+    void * new_p = __real_lv_realloc_core(p, new_size);
+    heap_ns += bench_now_ns() - start;
+    heap_cnt++;
+    return new_p;
+}
+
+void __wrap_lv_free_core(void * p)
+{
+    uint64_t start = bench_now_ns();
+    __real_lv_free_core(p);
+    heap_ns += bench_now_ns() - start;
+    heap_cnt++;
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t frames = argc > 1 ? (uint32_t)atoi(argv[1]) : 100;
+
+    lv_init();
+
+    lv_display_t * disp = bench_display_create(flush_cb);
+    bench_ui_load(disp);
+
+    printf("frames: %u, os: %d, chunk: %u bytes, heap: %u bytes\n", frames, LV_USE_OS,
+           (uint32_t)LV_DRAW_TASK_POOL_CHUNK_SIZE, (uint32_t)LV_MEM_SIZE);
+    printf("%-8s %9s %9s %9s %8s %8s %8s %7s %7s %7s %8s %10s\n", "scenario", "ms/frame", "heap/frm", "heap us",
+           "tasks", "task max", "live max", "chunks", "allocs", "frag %", "biggest", "checksum");
+
+    uint32_t s;
+    for(s = 0; s < sizeof(scenarios) / sizeof(scenarios[0]); s++) {
+        run(disp, &scenarios[s], frames);
+    }
+
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void run(lv_display_t * disp, const bench_scenario_t * scenario, uint32_t frames)
+{
+    bench_refresh(disp, scenario->update_cb, BENCH_WARM_UP_FRAMES);
+
+    lv_draw_task_pool_reset_stats();
+    heap_cnt = 0;
+    heap_ns = 0;
+
+    double ms = bench_refresh_ms(disp, scenario->update_cb, frames);
+    double heap_per_frame = (double)heap_cnt / frames;
+    double heap_us = heap_ns / 1e3 / frames;
+
+    lv_draw_task_pool_stats_t stats;
+    lv_draw_task_pool_get_stats(&stats);
+
+    /*Inspect the heap while the tasks of the bands are allocated*/
+    mem_check = true;
+    frag_max = 0;
+    biggest_min = UINT32_MAX;
+    bench_refresh(disp, scenario->update_cb, BENCH_MEM_FRAMES);
+    mem_check = false;
+
+    printf("%-8s %9.3f %9.1f %9.1f %8.1f %8u %8u %7u %7u %7u %8u %10.8x\n", scenario->name, ms,
+           heap_per_frame, heap_us, (double)stats.task_cnt / frames, stats.frame_task_max, stats.task_live_max,
+           stats.chunk_max, stats.chunk_alloc_cnt, frag_max, biggest_min, bench_frame_checksum());
+}
+
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+    bench_frame_copy(area, px_map);
+
+    if(mem_check) {
+        lv_mem_monitor_t mon;
+        lv_mem_monitor(&mon);
+        if(mon.frag_pct > frag_max) frag_max = mon.frag_pct;
+        if(mon.free_biggest_size < biggest_min) biggest_min = mon.free_biggest_size;
+    }
+
+    lv_display_flush_ready(disp);
+}
@@ -0,0 +1,112 @@
+/**
+ * @file lv_font_cache_bench.c
+ *
+ * Host benchmark of the glyph ID and decoded bitmap caches of the built-in
+ * fonts.
+ *
+ * A screen of labels mixing the most common CJK characters with
+ * ASCII is rendered in Source Han Sans SC 16 with every combination of the
+ * two caches. The glyph ID cache is turned off by using a copy of the font
+ * without a `cache`, the bitmap cache by resizing it to 0 bytes.
+ *
+ *   bench lv_font_cache_bench "-DLV_FONT_SOURCE_HAN_SANS_SC_16_CJK=1 \
+ *         -DLV_FONT_FMT_TXT_BITMAP_CACHE_SIZE=0x40000 -DLV_MEM_SIZE=0x800000"
+ *
+ * Usage: lv_font_cache_bench [frames]
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "lvgl.h"
+#include "bench_common.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define BENCH_LABEL_CNT     32
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/*Only letters the font has, so no fallback is searched*/
+static const char * texts[] = {
+    "的一是不了人我在有他中大来上国和也子时道出要就你",
+    "Temperature 23.5 C, humidity 41 %, pressure 1013 hPa",
+    "系统正常，当前温度二十三度，百分之四十一。",
+    "Firmware v2.1.0 / build 0x3F2A / 日期 2026",
+    "我在国家研究所工作了十年，很好",
+    "Error 404: 文件不在, please check the path",
+};
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(int argc, char ** argv)
+{
+    uint32_t frames = argc > 1 ? (uint32_t)atoi(argv[1]) : 50;
+
+    lv_init();
+
+    lv_display_t * disp = bench_display_create(bench_flush_discard_cb);
+
+    /*The same font without the glyph ID cache*/
+    lv_font_fmt_txt_dsc_t dsc_no_cache = *(const lv_font_fmt_txt_dsc_t *)lv_font_source_han_sans_sc_16_cjk.dsc;
+    dsc_no_cache.cache = NULL;
+    lv_font_t font_no_cache = lv_font_source_han_sans_sc_16_cjk;
+    font_no_cache.dsc = &dsc_no_cache;
+
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_set_flex_flow(scr, LV_FLEX_FLOW_COLUMN);
+    lv_obj_set_style_pad_row(scr, 2, 0);
+
+    uint32_t i;
+    for(i = 0; i < BENCH_LABEL_CNT; i++) {
+        const char * txt = texts[i % (sizeof(texts) / sizeof(texts[0]))];
+        lv_obj_t * label = lv_label_create(scr);
+        lv_label_set_text_fmt(label, "%s  %s  %s", txt, txt, txt);
+    }
+
+    lv_font_fmt_txt_cache_stats_t stats;
+    lv_font_fmt_txt_cache_get_stats(&stats);
+    uint32_t bitmap_cache_size = stats.max_size;
+    lv_font_fmt_txt_glyph_cache_t * id_cache = ((const lv_font_fmt_txt_dsc_t *)
+                                                lv_font_source_han_sans_sc_16_cjk.dsc)->cache;
+
+    printf("frames: %u, bitmap cache: %u bytes\n", frames, bitmap_cache_size);
+    printf("%-6s %-6s %10s %12s %12s %10s\n", "ids", "bitmap", "ms/frame", "id hit/miss", "bmp hit/miss", "bmp bytes");
+
+    uint32_t c;
+    for(c = 0; c < 4; c++) {
+        bool ids = c & 1;
+        bool bitmaps = c & 2;
+        if(bitmaps && bitmap_cache_size == 0) continue;
+
+        lv_obj_set_style_text_font(scr, ids ? &lv_font_source_han_sans_sc_16_cjk : &font_no_cache, 0);
+        lv_font_fmt_txt_cache_resize(bitmaps ? bitmap_cache_size : 0, true);
+
+        /*Warm up, then count only the steady state*/
+        lv_refr_now(disp);
+        lv_font_fmt_txt_cache_reset_stats();
+        id_cache->hit_cnt = 0;
+        id_cache->miss_cnt = 0;
+
+        double ms = bench_refresh_ms(disp, bench_update_screen, frames);
+        lv_font_fmt_txt_cache_get_stats(&stats);
+
+        printf("%-6s %-6s %10.3f %5u/%-6u %5u/%-6u %10u\n", ids ? "on" : "off", bitmaps ? "on" : "off", ms,
+               id_cache->hit_cnt / frames, id_cache->miss_cnt / frames,
+               stats.hit_cnt / frames, stats.miss_cnt / frames, stats.size);
+    }
+
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
@@ -0,0 +1,187 @@
+/**
+ * @file lv_inv_merge_bench.c
+ *
+ * Host benchmark of merging the invalidated areas by their cost.
+ *
+ * The invalidated areas of a few updates of the entry screen are recorded
+ * first, then every trace is replayed frame by frame with the overlapping
+ * join of LVGL and with a few area costs. The flush holds the CPU as long as
+ * the LCD bus would, with a fixed time per call and per pixel.
+ *
+ *   bench lv_inv_merge_bench "-DLV_MEM_SIZE=0x800000"
+ *
+ * Usage: lv_inv_merge_bench [frames] [flush ns per pixel] [flush us per call]
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "lvgl.h"
+#include "lvgl_private.h"
+#include "bench_common.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define BENCH_TRACE_MAX     256
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    const char * name;
+    bool labels;
+    bool charts;
+    bool timer;
+    lv_area_t areas[BENCH_TRACE_MAX];
+    uint32_t cnt;
+} trace_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void record(lv_display_t * disp, trace_t * trace);
+static void update_tree(lv_obj_t * obj, const trace_t * trace);
+static void replay(lv_display_t * disp, const trace_t * trace, uint32_t frames);
+static void invalidate_area_cb(lv_event_t * e);
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
+static void busy_wait_ns(uint64_t ns);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint32_t flush_ns_per_px = 10;
+static uint32_t flush_us_per_call = 20;
+
+/*In pixels, 0 is the overlapping join*/
+static const uint32_t costs[] = {0, BENCH_HOR_RES * 4, BENCH_HOR_RES * 16, BENCH_HOR_RES * 64};
+
+static trace_t traces[] = {
+    {.name = "labels", .labels = true},
+    {.name = "charts", .charts = true},
+    {.name = "both", .labels = true, .charts = true},
+    {.name = "timer", .timer = true},
+};
+
+static trace_t * recording;
+static uint32_t flush_cnt;
+static uint64_t flush_px;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(int argc, char ** argv)
+{
+    uint32_t frames = argc > 1 ? (uint32_t)atoi(argv[1]) : 50;
+    if(argc > 2) flush_ns_per_px = (uint32_t)atoi(argv[2]);
+    if(argc > 3) flush_us_per_call = (uint32_t)atoi(argv[3]);
+
+    lv_init();
+
+    lv_display_t * disp = bench_display_create(flush_cb);
+    lv_display_add_event_cb(disp, invalidate_area_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+    bench_ui_load(disp);
+
+    printf("frames: %u, flush: %u ns/px + %u us/call\n", frames, flush_ns_per_px, flush_us_per_call);
+    printf("%-8s %6s %8s %8s %10s %10s\n", "trace", "areas", "cost", "flushes", "kpx/frame", "ms/frame");
+
+    uint32_t t;
+    for(t = 0; t < sizeof(traces) / sizeof(traces[0]); t++) {
+        record(disp, &traces[t]);
+
+        uint32_t c;
+        for(c = 0; c < sizeof(costs) / sizeof(costs[0]); c++) {
+            lv_display_set_area_merge_cost(disp, costs[c]);
+
+            /*Warm up, then count only the steady state*/
+            replay(disp, &traces[t], 1);
+            flush_cnt = 0;
+            flush_px = 0;
+
+            uint64_t start = bench_now_ns();
+            replay(disp, &traces[t], frames);
+            double ms = (bench_now_ns() - start) / 1e6 / frames;
+
+            printf("%-8s %6u %8u %8.1f %10.1f %10.3f\n", traces[t].name, traces[t].cnt, costs[c],
+                   (double)flush_cnt / frames, flush_px / 1e3 / frames, ms);
+        }
+    }
+
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/*Run one update of the screen and keep the areas it invalidates*/
+static void record(lv_display_t * disp, trace_t * trace)
+{
+    trace->cnt = 0;
+    recording = trace;
+    if(trace->timer) bench_update_timer();
+    else update_tree(ui_entry_screen, trace);
+    lv_obj_update_layout(ui_entry_screen);
+    recording = NULL;
+
+    /*Draw the new state once and drop its areas, the replay invalidates them again*/
+    lv_refr_now(disp);
+}
+
+static void update_tree(lv_obj_t * obj, const trace_t * trace)
+{
+    if(trace->labels && lv_obj_check_type(obj, &lv_label_class)) {
+        lv_label_set_text_fmt(obj, "Value: %d", (int)lv_rand(0, 100000));
+    }
+    if(trace->charts && lv_obj_check_type(obj, &lv_chart_class)) {
+        lv_chart_series_t * ser = lv_chart_get_series_next(obj, NULL);
+        if(ser) lv_chart_set_next_value(obj, ser, (int32_t)lv_rand(40, 60));
+    }
+
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_count(obj); i++) {
+        update_tree(lv_obj_get_child(obj, i), trace);
+    }
+}
+
+static void replay(lv_display_t * disp, const trace_t * trace, uint32_t frames)
+{
+    uint32_t f;
+    for(f = 0; f < frames; f++) {
+        uint32_t i;
+        for(i = 0; i < trace->cnt; i++) lv_inv_area(disp, &trace->areas[i]);
+        lv_refr_now(disp);
+    }
+}
+
+/*Only the areas of the update, not the ones asked by the refresh itself*/
+static void invalidate_area_cb(lv_event_t * e)
+{
+    if(recording == NULL || recording->cnt >= BENCH_TRACE_MAX) return;
+
+    const lv_area_t * area = lv_event_get_param(e);
+    recording->areas[recording->cnt++] = *area;
+}
+
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+    LV_UNUSED(px_map);
+
+    uint64_t px = lv_area_get_size(area);
+    flush_cnt++;
+    flush_px += px;
+    busy_wait_ns(flush_us_per_call * 1000ULL + px * flush_ns_per_px);
+
+    lv_display_flush_ready(disp);
+}
+
+/*The target copies to the LCD synchronously, so the CPU is busy for the whole flush*/
+static void busy_wait_ns(uint64_t ns)
+{
+    uint64_t end = bench_now_ns() + ns;
+    while(bench_now_ns() < end) {}
+}
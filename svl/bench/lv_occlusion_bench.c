@@ -0,0 +1,160 @@
+/**
+ * @file lv_occlusion_bench.c
+ *
+ * Host benchmark of skipping the objects covered by opaque objects drawn after
+ * them (`lv_display_set_occlusion_culling`).
+ *
+ * Each scenario is run with the culling disabled and enabled, counting per
+ * frame the CPU time, the draw tasks added, the objects skipped with their
+ * children and the objects whose main drawing was skipped. The tasks the
+ * culling saved are the difference of the two runs. After each run with the
+ * culling its last frame is compared pixel by pixel with the screen drawn
+ * without culling, and so is a whole screen drawn with culling. The draw tasks
+ * are counted by wrapping `lv_draw_add_task` with the linker:
+ *
+ *   bench lv_occlusion_bench "-DLV_MEM_SIZE=0x800000" "-Wl,--wrap=lv_draw_add_task"
+ *
+ * Usage: lv_occlusion_bench [frames]
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "lvgl.h"
+#include "lvgl_private.h"
+#include "bench_common.h"
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void run(lv_display_t * disp, const bench_scenario_t * scenario, uint32_t frames, bool culling);
+static uint32_t compare(lv_display_t * disp);
+static void update_popup(void);
+static void popup_create(void);
+
+lv_draw_task_t * __real_lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords, lv_draw_task_type_t type);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const bench_scenario_t scenarios[] = {
+    {"redraw", bench_update_redraw},
+    {"timer", bench_update_timer},
+    {"popup", update_popup},
+};
+
+static lv_obj_t * popup;
+static uint64_t task_cnt;
+static double task_cnt_off;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_draw_task_t * __wrap_lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords, lv_draw_task_type_t type)
+{
+    task_cnt++;
+    return __real_lv_draw_add_task(layer, coords, type);
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t frames = argc > 1 ? (uint32_t)atoi(argv[1]) : 100;
+
+    lv_init();
+
+    lv_display_t * disp = bench_display_create(bench_flush_cb);
+    popup_create();
+    bench_ui_load(disp);
+
+    printf("frames: %u\n", frames);
+    printf("%-8s %8s %10s %10s %8s %8s %8s %8s\n", "scenario", "culling", "ms/frame", "tasks", "skipped", "objs",
+           "mains", "diff px");
+
+    uint32_t s;
+    for(s = 0; s < sizeof(scenarios) / sizeof(scenarios[0]); s++) {
+        run(disp, &scenarios[s], frames, false);
+        run(disp, &scenarios[s], frames, true);
+    }
+
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void run(lv_display_t * disp, const bench_scenario_t * scenario, uint32_t frames, bool culling)
+{
+    lv_display_set_occlusion_culling(disp, culling);
+    bench_refresh(disp, scenario->update_cb, BENCH_WARM_UP_FRAMES);
+
+    lv_refr_reset_occlusion_stats();
+    task_cnt = 0;
+
+    double ms = bench_refresh_ms(disp, scenario->update_cb, frames);
+    double tasks = (double)task_cnt / frames;
+
+    lv_refr_occlusion_stats_t stats;
+    lv_refr_get_occlusion_stats(&stats);
+
+    uint32_t diff_cnt = 0;
+    if(culling) diff_cnt = compare(disp);
+    else task_cnt_off = tasks;
+
+    printf("%-8s %8s %10.3f %10.1f %8.1f %8.1f %8.1f %8u\n", scenario->name, culling ? "on" : "off", ms,
+           tasks, culling ? task_cnt_off - tasks : 0.0, (double)stats.obj_cnt / frames,
+           (double)stats.main_cnt / frames, diff_cnt);
+}
+
+/*Draw the last frame again without culling and compare it with the one drawn with culling,
+ *then draw the whole screen with culling and compare that too*/
+static uint32_t compare(lv_display_t * disp)
+{
+    uint32_t diff_cnt = 0;
+
+    bench_frame_keep();
+    lv_display_set_occlusion_culling(disp, false);
+    lv_obj_invalidate(ui_entry_screen);
+    lv_refr_now(disp);
+    diff_cnt += bench_frame_diff(NULL);
+
+    bench_frame_keep();
+    lv_display_set_occlusion_culling(disp, true);
+    lv_obj_invalidate(ui_entry_screen);
+    lv_refr_now(disp);
+    diff_cnt += bench_frame_diff(NULL);
+
+    return diff_cnt;
+}
+
+/*The timer of the app while an opaque dialog on the top layer covers the charts*/
+static void update_popup(void)
+{
+    if(lv_obj_has_flag(popup, LV_OBJ_FLAG_HIDDEN)) lv_obj_remove_flag(popup, LV_OBJ_FLAG_HIDDEN);
+    bench_update_timer();
+}
+
+/*A dialog with rounded corners over the charts, hidden until its scenario*/
+static void popup_create(void)
+{
+    popup = lv_obj_create(lv_layer_top());
+    lv_obj_set_pos(popup, 350, 60);
+    lv_obj_set_size(popup, 920, 720);
+    lv_obj_set_style_bg_opa(popup, LV_OPA_COVER, 0);
+    lv_obj_set_style_radius(popup, 16, 0);
+    lv_obj_set_style_shadow_width(popup, 24, 0);
+
+    lv_obj_t * label = lv_label_create(popup);
+    lv_label_set_text(label, "Calibrating channel 1, please wait...");
+    lv_obj_center(label);
+
+    lv_obj_t * btn = lv_button_create(popup);
+    lv_obj_align(btn, LV_ALIGN_BOTTOM_MID, 0, 0);
+    lv_label_set_text(lv_label_create(btn), "Cancel");
+
+    lv_obj_add_flag(popup, LV_OBJ_FLAG_HIDDEN);
+}
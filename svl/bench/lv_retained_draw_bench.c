@@ -0,0 +1,117 @@
+/**
+ * @file lv_retained_draw_bench.c
+ *
+ * Host benchmark of replaying the kept draw tasks of the objects
+ * (`LV_OBJ_RETAINED_DRAW_SIZE`) on the chart screen.
+ *
+ * Each scenario counts per frame the CPU time, the allocations of LVGL's heap
+ * and the draw tasks added. The 128 row draw buffer draws a chart in several
+ * stripes. The retained draw tasks are configured at build time, build once
+ * without and once with them. The allocations are counted by wrapping the
+ * allocator with the linker. A checksum of the last frame of each scenario
+ * tells if the two builds draw the same:
+ *
+ *   for n in 0 0x100000; do
+ *     bench lv_retained_draw_bench "-DLV_OBJ_RETAINED_DRAW_SIZE=$n -DLV_MEM_SIZE=0x800000" \
+ *           "-Wl,--wrap=lv_malloc_core,--wrap=lv_realloc_core,--wrap=lv_draw_add_task"
+ *   done
+ *
+ * Usage: lv_retained_draw_bench [frames]
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "lvgl.h"
+#include "lvgl_private.h"
+#include "bench_common.h"
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void run(lv_display_t * disp, const bench_scenario_t * scenario, uint32_t frames);
+
+void * __real_lv_malloc_core(size_t size);
+void * __real_lv_realloc_core(void * p, size_t new_size);
+lv_draw_task_t * __real_lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords, lv_draw_task_type_t type);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const bench_scenario_t scenarios[] = {
+    {"redraw", bench_update_redraw},
+    {"charts", bench_update_charts},
+    {"timer", bench_update_timer},
+};
+
+static uint64_t alloc_cnt;
+static uint64_t task_cnt;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void * __wrap_lv_malloc_core(size_t size)
+{
+    alloc_cnt++;
+    return __real_lv_malloc_core(size);
+}
+
+void * __wrap_lv_realloc_core(void * p, size_t new_size)
+{
+    alloc_cnt++;
+    return __real_lv_realloc_core(p, new_size);
+}
+
+lv_draw_task_t * __wrap_lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords, lv_draw_task_type_t type)
+{
+    task_cnt++;
+    return __real_lv_draw_add_task(layer, coords, type);
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t frames = argc > 1 ? (uint32_t)atoi(argv[1]) : 100;
+
+    lv_init();
+
+    lv_display_t * disp = bench_display_create(bench_flush_cb);
+    bench_ui_load(disp);
+
+    printf("frames: %u, retained draw: %u bytes\n", frames, (uint32_t)LV_OBJ_RETAINED_DRAW_SIZE);
+    printf("%-8s %10s %10s %10s %8s %8s %8s %9s %10s\n", "scenario", "ms/frame", "allocs", "tasks", "records",
+           "replays", "skipped", "kbytes", "checksum");
+
+    uint32_t s;
+    for(s = 0; s < sizeof(scenarios) / sizeof(scenarios[0]); s++) {
+        run(disp, &scenarios[s], frames);
+    }
+
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void run(lv_display_t * disp, const bench_scenario_t * scenario, uint32_t frames)
+{
+    bench_refresh(disp, scenario->update_cb, BENCH_WARM_UP_FRAMES);
+
+    lv_obj_retained_draw_reset_stats();
+    alloc_cnt = 0;
+    task_cnt = 0;
+
+    double ms = bench_refresh_ms(disp, scenario->update_cb, frames);
+
+    lv_obj_retained_draw_stats_t stats;
+    lv_obj_retained_draw_get_stats(&stats);
+
+    printf("%-8s %10.3f %10.1f %10.1f %8.1f %8.1f %8.1f %9u %10.8x\n", scenario->name, ms,
+           (double)alloc_cnt / frames, (double)task_cnt / frames, (double)stats.record_cnt / frames,
+           (double)stats.replay_cnt / frames, (double)stats.skip_cnt / frames, stats.size / 1024,
+           bench_frame_checksum());
+}
@@ -0,0 +1,112 @@
+/**
+ * @file lv_style_cache_bench.c
+ *
+ * Host benchmark of the resolved style cache on the svl screens.
+ *
+ * For each screen the common properties of every object are looked up for
+ * the parts which have styles, then the whole screen is redrawn. The cache is
+ * configured at build time, build once without and once with it:
+ *
+ *   for n in 0 0x40000; do
+ *     bench lv_style_cache_bench "-DLV_OBJ_STYLE_RESOLVED_CACHE_SIZE=$n -DLV_MEM_SIZE=0x800000"
+ *   done
+ *
+ * Usage: lv_style_cache_bench [rounds]
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "lvgl.h"
+#include "lvgl_private.h"
+#include "bench_common.h"
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static uint32_t lookup_tree(lv_obj_t * obj);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/*What the draw and layout code asks most*/
+static const lv_style_prop_t props[] = {
+    LV_STYLE_BG_COLOR, LV_STYLE_BG_OPA, LV_STYLE_BG_GRAD_DIR, LV_STYLE_BG_IMAGE_SRC,
+    LV_STYLE_BORDER_WIDTH, LV_STYLE_BORDER_COLOR, LV_STYLE_BORDER_OPA, LV_STYLE_BORDER_SIDE,
+    LV_STYLE_OUTLINE_WIDTH, LV_STYLE_SHADOW_WIDTH, LV_STYLE_RADIUS, LV_STYLE_CLIP_CORNER,
+    LV_STYLE_PAD_TOP, LV_STYLE_PAD_BOTTOM, LV_STYLE_PAD_LEFT, LV_STYLE_PAD_RIGHT,
+    LV_STYLE_WIDTH, LV_STYLE_HEIGHT, LV_STYLE_OPA, LV_STYLE_TRANSFORM_ROTATION,
+    LV_STYLE_TEXT_COLOR, LV_STYLE_TEXT_FONT, LV_STYLE_TEXT_OPA, LV_STYLE_TEXT_LETTER_SPACE,
+};
+
+static const lv_part_t parts[] = {LV_PART_MAIN, LV_PART_SCROLLBAR, LV_PART_INDICATOR, LV_PART_KNOB};
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(int argc, char ** argv)
+{
+    uint32_t rounds = argc > 1 ? (uint32_t)atoi(argv[1]) : 50;
+
+    lv_init();
+
+    lv_display_t * disp = bench_display_create(bench_flush_discard_cb);
+
+    ui_init();
+    ui_Screen1_screen_init();
+
+    lv_obj_t * screens[] = {ui_entry_screen, ui_Screen1};
+    const char * names[] = {"entry", "Screen1"};
+
+    printf("resolved style cache: %d bytes, %u rounds\n", LV_OBJ_STYLE_RESOLVED_CACHE_SIZE, rounds);
+    printf("%-8s %10s %14s %12s\n", "screen", "lookups", "ns/lookup", "ms/frame");
+
+    uint32_t s;
+    for(s = 0; s < sizeof(screens) / sizeof(screens[0]); s++) {
+        lv_screen_load(screens[s]);
+        lv_refr_now(disp);
+
+        uint32_t cnt = 0;
+        uint32_t i;
+        uint64_t start = bench_now_ns();
+        for(i = 0; i < rounds; i++) cnt += lookup_tree(screens[s]);
+        double lookup_ms = (bench_now_ns() - start) / 1e6;
+
+        double frame_ms = bench_refresh_ms(disp, bench_update_screen, rounds);
+
+        printf("%-8s %10u %14.2f %12.3f\n", names[s], cnt / rounds, lookup_ms * 1e6 / cnt, frame_ms);
+    }
+
+#if LV_OBJ_STYLE_RESOLVED_CACHE_SIZE > 0
+    printf("cache used: %u bytes\n", LV_GLOBAL_DEFAULT()->style_resolved_cache_size);
+#endif
+
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static uint32_t lookup_tree(lv_obj_t * obj)
+{
+    uint32_t cnt = 0;
+    uint32_t p, i;
+    for(p = 0; p < sizeof(parts) / sizeof(parts[0]); p++) {
+        for(i = 0; i < sizeof(props) / sizeof(props[0]); i++) {
+            volatile lv_style_value_t v = lv_obj_get_style_prop(obj, parts[p], props[i]);
+            LV_UNUSED(v);
+            cnt++;
+        }
+    }
+
+    for(i = 0; i < lv_obj_get_child_count(obj); i++) {
+        cnt += lookup_tree(lv_obj_get_child(obj, i));
+    }
+
+    return cnt;
+}
@@ -0,0 +1,159 @@
+/**
+ * @file lv_tile_bench.c
+ *
+ * Host benchmark of tile-parallel rendering on the svl screens.
+ *
+ * The flush copies to the frame buffer on its own thread and takes as long
+ * as the LCD bus would, so a tile flushed early really overlaps with the
+ * rendering of the next ones.
+ *
+ * The number of draw units is fixed at build time, build once per count:
+ *
+ *   for n in 1 2 4; do
+ *     bench lv_tile_bench "-DLV_USE_OS=LV_OS_PTHREAD -DLV_DRAW_SW_DRAW_UNIT_CNT=$n -DLV_MEM_SIZE=0x800000"
+ *   done
+ *
+ * Usage: lv_tile_bench [frames] [flush ns per pixel]
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "lvgl.h"
+#include "bench_common.h"
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static uint32_t tick_get_cb(void);
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
+static void * flush_thread(void * arg);
+static double frame_ms(lv_display_t * disp, uint32_t frames);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const uint32_t tile_cnts[] = {1, 2, 4, 8, 16};
+static uint32_t flush_ns_per_px = 10;
+
+/*The pending flush, handed over to the flush thread*/
+static pthread_mutex_t flush_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t flush_cond = PTHREAD_COND_INITIALIZER;
+static lv_display_t * flush_disp;
+static lv_area_t flush_area;
+static uint8_t * flush_px;
+static volatile int flush_busy;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(int argc, char ** argv)
+{
+    uint32_t frames = argc > 1 ? (uint32_t)atoi(argv[1]) : 50;
+    if(argc > 2) flush_ns_per_px = (uint32_t)atoi(argv[2]);
+
+    lv_init();
+    lv_tick_set_cb(tick_get_cb);
+
+    lv_display_t * disp = bench_display_create(flush_cb);
+
+    pthread_t thread;
+    pthread_create(&thread, NULL, flush_thread, NULL);
+
+    ui_init();
+    ui_Screen1_screen_init();
+
+    lv_obj_t * screens[] = {ui_entry_screen, ui_Screen1};
+    const char * names[] = {"entry", "Screen1"};
+
+    printf("draw units: %d, flush: %u ns/px\n", LV_DRAW_SW_DRAW_UNIT_CNT, flush_ns_per_px);
+    printf("%-8s %6s %12s %12s\n", "screen", "tiles", "ms (whole)", "ms (tiles)");
+
+    uint32_t s;
+    for(s = 0; s < sizeof(screens) / sizeof(screens[0]); s++) {
+        lv_screen_load(screens[s]);
+        lv_refr_now(disp);
+
+        uint32_t t;
+        for(t = 0; t < sizeof(tile_cnts) / sizeof(tile_cnts[0]); t++) {
+            lv_display_set_tile_cnt(disp, tile_cnts[t]);
+
+            lv_display_set_tile_flush(disp, false);
+            double whole = frame_ms(disp, frames);
+            lv_display_set_tile_flush(disp, true);
+            double tiles = frame_ms(disp, frames);
+
+            printf("%-8s %6u %12.3f %12.3f\n", names[s], tile_cnts[t], whole, tiles);
+        }
+    }
+
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static uint32_t tick_get_cb(void)
+{
+    return (uint32_t)(bench_now_ns() / 1000000);
+}
+
+static double frame_ms(lv_display_t * disp, uint32_t frames)
+{
+    uint64_t start = bench_now_ns();
+    bench_refresh(disp, bench_update_screen, frames);
+    /*The last flush is part of the frame*/
+    while(flush_busy);
+
+    return (bench_now_ns() - start) / 1e6 / frames;
+}
+
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+    flush_busy = 1;
+    pthread_mutex_lock(&flush_lock);
+    flush_area = *area;
+    flush_px = px_map;
+    flush_disp = disp;
+    pthread_cond_signal(&flush_cond);
+    pthread_mutex_unlock(&flush_lock);
+}
+
+/*Copy to the frame buffer and hold the bus for as long as the LCD would*/
+static void * flush_thread(void * arg)
+{
+    LV_UNUSED(arg);
+
+    while(1) {
+        pthread_mutex_lock(&flush_lock);
+        while(flush_disp == NULL) pthread_cond_wait(&flush_cond, &flush_lock);
+        lv_display_t * disp = flush_disp;
+        lv_area_t area = flush_area;
+        uint8_t * px = flush_px;
+        flush_disp = NULL;
+        pthread_mutex_unlock(&flush_lock);
+
+        struct timespec end;
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        bench_frame_copy(&area, px);
+
+        /*Sleep instead of spinning: like a DMA transfer it leaves the CPU to the draw units*/
+        uint64_t ns = end.tv_nsec + (uint64_t)lv_area_get_size(&area) * flush_ns_per_px;
+        end.tv_sec += ns / 1000000000;
+        end.tv_nsec = ns % 1000000000;
+        while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &end, NULL));
+
+        flush_busy = 0;
+        lv_display_flush_ready(disp);
+    }
+
+    return NULL;
+}